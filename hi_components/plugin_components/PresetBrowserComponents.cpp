@@ -178,7 +178,9 @@ void TagList::toggleTag(Tag* n)
 
 		PresetBrowser::DataBaseHelpers::writeTagsInXml(currentFile, currentlyActiveTags);
 
-		parent->getMainController()->getUserPresetHandler().getTagDataBase().buildDataBase(true);
+		auto& db = parent->getMainController()->getUserPresetHandler().getTagDataBase();
+		db.invalidateFile(currentFile);
+		db.buildDataBase(true);
 
 		for (auto l : listeners)
 		{
@@ -261,20 +263,10 @@ int PresetBrowserColumn::ColumnListModel::getNumRows()
 
 			bool matchesTags = currentlyActiveTags.size() == 0;
 
-			auto hash = allFiles[i].hashCode64();
-
 			if (currentlyActiveTags.size() > 0)
 			{
-				const auto& cachedTags = getCachedTags();
-
-				for (auto& t : cachedTags)
-				{
-					if (t.hashCode == hash)
-					{
-						matchesTags = t.shown;
-						break;
-					}
-				}
+				if (auto t = parent->getMainController()->getUserPresetHandler().getTagDataBase().getCachedTag(allFiles[i]))
+					matchesTags = t->shown;
 			}
 
 			if (matchesWildcard && matchesTags)
@@ -357,23 +349,7 @@ void PresetBrowserColumn::ColumnListModel::updateTags(const StringArray& newSele
 	for (auto s : newSelection)
 		currentlyActiveTags.add(Identifier(s));
 
-	
-
-	auto& cachedTags = parent->getMainController()->getUserPresetHandler().getTagDataBase().getCachedTags();
-
-	for (auto& t : cachedTags)
-	{
-		t.shown = true;
-
-		for (auto st : currentlyActiveTags)
-		{
-			if (!t.tags.contains(st))
-			{
-				t.shown = false;
-				break;
-			}
-		}
-	}
+	parent->getMainController()->getUserPresetHandler().getTagDataBase().setActiveTags(currentlyActiveTags);
 }
 
 void PresetBrowserColumn::ColumnListModel::paintListBoxItem(int rowNumber, Graphics &g, int width, int height, bool rowIsSelected)
@@ -210,6 +210,8 @@ void VoiceCpuBpmComponent::timerCallback()
 
 			bpmLabel->setText(String(mc->getBpm(), 0), dontSendNotification);
 
+			cpuSlider->setTooltip(getCpuUsageTooltip(mc));
+
 			const bool midiFlag = mc->checkAndResetMidiInputFlag();
 
 			Colour c = midiFlag ? Colour(SIGNAL_COLOUR) : Colours::white.withAlpha(0.6f);
@@ -222,6 +224,23 @@ void VoiceCpuBpmComponent::timerCallback()
 	}
 }
 
+String VoiceCpuBpmComponent::getCpuUsageTooltip(MainController* mc)
+{
+	String s;
+
+	s << "CPU: " << String(mc->getCpuUsage(), 1) << "%";
+
+	auto handler = mc->getMainSynthChain()->getHandler();
+
+	for (int i = 0; i < handler->getNumProcessors(); i++)
+	{
+		if (auto child = dynamic_cast<ModulatorSynth*>(handler->getProcessor(i)))
+			s << "\n" << child->getId() << ": " << String(child->getCpuUsage(), 1) << "%";
+	}
+
+	return s;
+}
+
 void VoiceCpuBpmComponent::resized()
 {
 	panicButton->setBounds(0, 0, 12, 12);
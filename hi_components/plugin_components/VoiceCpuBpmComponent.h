@@ -89,6 +89,9 @@ private:
 
 	bool preloadActive = false;
 
+	/** Creates a tooltip with the CPU usage of every child synth of the main chain. */
+	static String getCpuUsageTooltip(MainController* mc);
+
 	// ================================================================================================================
 
 	Array<WeakReference<MainController>> mainControllers;
@@ -259,6 +259,15 @@ Enable this to add a glitch detector to some performance crititcal functions
 #define USE_GLITCH_DETECTION 0
 #endif
 
+/** Config: HISE_ENABLE_AUDIO_PROFILER
+
+Set this to 0 to remove the scopes of the AudioThreadProfiler from the audio rendering. 
+The profiler is disabled at runtime by default, so there's no need to do this unless you want to squeeze out the last bit of performance.
+*/
+#ifndef HISE_ENABLE_AUDIO_PROFILER
+#define HISE_ENABLE_AUDIO_PROFILER 1
+#endif
+
 /** Config: ENABLE_PLOTTER
 
 Set this to 0 to deactivate the plotter data collection
@@ -393,6 +402,15 @@ some weird side effects in the streaming engine).
 #define HISE_MAX_PROCESSING_BLOCKSIZE 512
 #endif
 
+/** Config: HISE_NUM_PRELOAD_THREADS
+
+The number of worker threads that are used for preloading the samples of a sample map in parallel. The parallel
+preloading is only used in the SSD disk mode, set this to 1 to always preload the samples one after another.
+*/
+#ifndef HISE_NUM_PRELOAD_THREADS
+#define HISE_NUM_PRELOAD_THREADS 4
+#endif
+
 /** Config: ENABLE_CPU_MEASUREMENT
 
 Set this to 0 to deactivate the CPU peak meter.
@@ -890,6 +890,7 @@ String DebugLogger::getNameForLocation(Location l)
 		RETURN_CASE_STRING_LOCATION(SampleMapLoading);
 		RETURN_CASE_STRING_LOCATION(SampleMapLoadingFromFile);
 		RETURN_CASE_STRING_LOCATION(SamplePreloadThread);
+		RETURN_CASE_STRING_LOCATION(MonoEffectRendering);
         RETURN_CASE_STRING_LOCATION(numLocations);
 	}
 
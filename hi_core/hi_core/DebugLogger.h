@@ -113,6 +113,7 @@ public:
 		SampleMapLoading,
 		SampleMapLoadingFromFile,
 		SamplePreloadThread,
+		MonoEffectRendering,
 		numLocations
 	};
 
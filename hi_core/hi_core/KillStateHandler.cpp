@@ -39,6 +39,9 @@ MainController::KillStateHandler::KillStateHandler(MainController* mc_) :
 {
 	audioThreads.ensureStorageAllocated(16);
 
+	for (auto& id : realtimeWorkerThreads)
+		id.store(nullptr);
+
 	threadIds[TargetThread::AudioThread] = nullptr;
 	threadIds[TargetThread::SampleLoadingThread] = mc->getSampleManager().getGlobalSampleThreadPool()->getThreadId();
 	threadIds[TargetThread::ScriptingThread] = mc->javascriptThreadPool->getThreadId();
@@ -539,6 +542,12 @@ juce::Array<MultithreadedQueueHelpers::PublicToken> MainController::KillStateHan
 	MultithreadedQueueHelpers::PublicToken audioThreadToken;
 	audioThreadToken.canBeProducer = producerFlags & QueueProducerFlags::AudioThreadIsProducer;
 	audioThreadToken.threadIds.insertArray(0, audioThreads.getRawDataPointer(), audioThreads.size());
+
+	for (const auto& id : realtimeWorkerThreads)
+	{
+		if (auto workerId = id.load())
+			audioThreadToken.threadIds.add(workerId);
+	}
 	audioThreadToken.threadName = "AudioThread";
 
 	MultithreadedQueueHelpers::PublicToken messageThreadToken;
@@ -587,7 +596,7 @@ MainController::KillStateHandler::TargetThread MainController::KillStateHandler:
 
 	auto threadId = Thread::getCurrentThreadId();
 
-	if (audioThreads.contains(threadId))
+	if (audioThreads.contains(threadId) || isRealtimeWorkerThread(threadId))
 		return TargetThread::AudioThread;
 	else if (threadId == threadIds[(int)TargetThread::SampleLoadingThread])
 		return TargetThread::SampleLoadingThread;
@@ -629,6 +638,46 @@ void MainController::KillStateHandler::removeThreadIdFromAudioThreadList()
 	audioThreads.removeAllInstancesOf(threadId);
 }
 
+void MainController::KillStateHandler::addRealtimeWorkerThreadId()
+{
+	auto threadId = Thread::getCurrentThreadId();
+
+	for (auto& id : realtimeWorkerThreads)
+	{
+		void* expected = nullptr;
+
+		if (id.compare_exchange_strong(expected, threadId))
+			return;
+	}
+
+	// Increase NumMaxRealtimeWorkerThreads
+	jassertfalse;
+}
+
+void MainController::KillStateHandler::removeRealtimeWorkerThreadId()
+{
+	auto threadId = Thread::getCurrentThreadId();
+
+	for (auto& id : realtimeWorkerThreads)
+	{
+		void* expected = threadId;
+
+		if (id.compare_exchange_strong(expected, nullptr))
+			return;
+	}
+}
+
+bool MainController::KillStateHandler::isRealtimeWorkerThread(void* threadId) const noexcept
+{
+	for (const auto& id : realtimeWorkerThreads)
+	{
+		if (id.load() == threadId)
+			return true;
+	}
+
+	return false;
+}
+
 void MainController::KillStateHandler::initAudioThreadId()
 {
 	addThreadIdToAudioThreadList();
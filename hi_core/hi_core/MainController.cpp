@@ -116,6 +116,9 @@ MainController::~MainController()
 	javascriptThreadPool->cancelAllJobs();
 	sampleManager->cancelAllJobs();
 
+	currentRealtimeWorkerPool.store(nullptr);
+	realtimeWorkerPool = nullptr;
+
 	Logger::setCurrentLogger(nullptr);
 	logger = nullptr;
 	masterReference.clear();
@@ -759,6 +762,33 @@ float MainController::getVoiceAmountMultiplier() const
 	}
 }
 
+hise::RealtimeWorkerPool* MainController::getRealtimeWorkerPool()
+{
+	if (auto p = currentRealtimeWorkerPool.load())
+		return p;
+
+	// Multiple containers might be prepared on different threads at the same time
+	ScopedLock sl(realtimeWorkerPoolLock);
+
+	if (realtimeWorkerPool == nullptr)
+	{
+		jassert(getKillStateHandler().getCurrentThread() != KillStateHandler::AudioThread);
+
+		// Register the workers as audio threads so that the lock checks treat them like the audio callback
+		realtimeWorkerPool = new RealtimeWorkerPool(HISE_NUM_REALTIME_WORKER_THREADS, [this](bool threadStarted)
+		{
+			if (threadStarted)
+				getKillStateHandler().addRealtimeWorkerThreadId();
+			else
+				getKillStateHandler().removeRealtimeWorkerThreadId();
+		});
+
+		currentRealtimeWorkerPool.store(realtimeWorkerPool.get());
+	}
+
+	return realtimeWorkerPool.get();
+}
+
 #if HISE_INCLUDE_RLOTTIE
 hise::RLottieManager::Ptr MainController::getRLottieManager()
 {
@@ -789,6 +819,7 @@ void MainController::processBlockCommon(AudioSampleBuffer &buffer, MidiBuffer &m
 	getSampleManager().handleNonRealtimeState();
 
 	ADD_GLITCH_DETECTOR(getMainSynthChain(), DebugLogger::Location::MainRenderCallback);
+	ADD_AUDIO_PROFILER_SCOPE(getMainSynthChain(), DebugLogger::Location::MainRenderCallback);
     
 	getDebugLogger().checkAudioCallbackProperties(thisAsProcessor->getSampleRate(), numSamplesThisBlock);
 
@@ -192,6 +192,12 @@ public:
 		/** returns a pointer to the thread pool that streams the samples from disk. */
 		SampleThreadPool *getGlobalSampleThreadPool() { return samplerLoaderThreadPool; }
 
+		/** Returns the thread pool that is used for preloading the samples in parallel.
+		*
+		*	This returns nullptr if the parallel preloading is not available (HDD mode or HISE_NUM_PRELOAD_THREADS < 2). 
+		*/
+		ThreadPool* getPreloadThreadPool();
+
 		/** returns a pointer to the global sample pool */
 		ModulatorSamplerSoundPool *getModulatorSamplerSoundPool2() const;
 
@@ -357,6 +363,7 @@ public:
 		ValueTree sampleMaps;
 
 		ScopedPointer<SampleThreadPool> samplerLoaderThreadPool;
+		ScopedPointer<ThreadPool> preloadThreadPool;
 
 		bool hddMode = false;
 		bool skipPreloading = false;
@@ -742,6 +749,13 @@ public:
 			ValueTree newPreset;
 		};
 
+		/** A database of the tags of every user preset below the root directory.
+
+			The tags are stored in an index file in the root directory along with the
+			modification time and size of each preset so that a rebuild only needs to
+			parse the presets that have changed since the last time. Every tag gets a
+			bit in a mask so that filtering the presets is a simple bit operation.
+		*/
 		struct TagDataBase
 		{
 			struct CachedTag
@@ -749,37 +763,78 @@ public:
 				int64 hashCode;
 				Array<Identifier> tags;
 				bool shown = false;
+
+				File file;
+				int64 modificationTime = 0;
+				int64 fileSize = 0;
+				BigInteger tagMask;
 			};
 
 			void setRootDirectory(const File& newRoot);;
 
+			/** Updates the database. If force is true, it will rescan the root directory
+			    and reparse every preset that has been modified.
+			*/
 			void buildDataBase(bool force = false);
 
+			/** Sets the tags that a preset needs to have in order to be shown. */
+			void setActiveTags(const Array<Identifier>& newActiveTags);
+
+			/** Returns the cached entry for the given preset file or nullptr if it's not in the database. */
+			const CachedTag* getCachedTag(const File& presetFile) const;
+
+			/** Marks the entry of the given preset as outdated so that the next rebuild parses it again.
+			
+				Call this after changing the tags of a preset, as the modification time and size
+				might not be enough to detect the change.
+			*/
+			void invalidateFile(const File& presetFile);
+
 			/** If you want to use the tag system, supply a list of Strings and it will
 			create the tags automatically.
+
+			This is usually called from the scripting thread, so the tag masks will be
+			rebuilt by the next call on the message thread.
 			*/
 			void setTagList(const StringArray& newTagList)
 			{
 				tagList = newTagList;
+				tagMasksDirty = true;
 			}
 
 			/** @internal */
 			const StringArray& getTagList() const { return tagList; }
 
 			const Array<CachedTag>& getCachedTags() const { return cachedTags; }
-			Array<CachedTag>& getCachedTags() { return cachedTags; }
 
 		private:
 
+			static constexpr int IndexFileVersion = 2;
+
+			File getIndexFile() const { return root.getChildFile("tag_index.dat"); }
+
+			bool loadIndex(HashMap<int64, int>& lookup);
+			void saveIndex() const;
+
+			void updateTagMasks();
+			void updateShownState();
+			int getTagBit(const Identifier& id);
+
 			StringArray tagList;
 
 			File root;
 
 			Array<CachedTag> cachedTags;
+			HashMap<int64, int> cacheIndex;
+
+			Array<Identifier> tagBits;
+			Array<Identifier> activeTags;
+			BigInteger activeMask;
 
 			void buildInternal();
 
 			bool dirty = true;
+			std::atomic<bool> tagMasksDirty = { false };
 		};
 
 		/** A class that will be notified about user preset changes. */
@@ -1217,6 +1272,15 @@ public:
 
 		void removeThreadIdFromAudioThreadList();
 
+		/** Registers the current thread as realtime worker thread, which is treated like the audio thread.
+		*
+		*	Unlike addThreadIdToAudioThreadList() this uses a fixed slot array, so the workers can register
+		*	themselves while the audio thread calls getCurrentThread().
+		*/
+		void addRealtimeWorkerThreadId();
+
+		void removeRealtimeWorkerThreadId();
+
 		bool test() const noexcept override;
 
 		void warn(int operationType) override;
@@ -1321,6 +1385,11 @@ public:
 		MainController* mc;
 		void* threadIds[(int)TargetThread::numTargetThreads];
 		Array<void*> audioThreads;
+
+		bool isRealtimeWorkerThread(void* threadId) const noexcept;
+
+		static constexpr int NumMaxRealtimeWorkerThreads = 16;
+		std::atomic<void*> realtimeWorkerThreads[NumMaxRealtimeWorkerThreads];
 	};
 
 	MainController();
@@ -1362,6 +1431,9 @@ public:
 	JavascriptThreadPool& getJavascriptThreadPool() noexcept { return *javascriptThreadPool.get(); }
 	const JavascriptThreadPool& getJavascriptThreadPool() const noexcept { return *javascriptThreadPool.get(); }
 
+	/** Returns the worker pool that is used to render voices in parallel. The pool is created when this is called for the first time, so don't call this on the audio thread. */
+	RealtimeWorkerPool* getRealtimeWorkerPool();
+
 	PooledUIUpdater* getGlobalUIUpdater() { return &globalUIUpdater; }
 	const PooledUIUpdater* getGlobalUIUpdater() const { return &globalUIUpdater; }
 
@@ -1942,6 +2014,10 @@ private:
 
 	ScopedPointer<JavascriptThreadPool> javascriptThreadPool;
 
+	CriticalSection realtimeWorkerPoolLock;
+	ScopedPointer<RealtimeWorkerPool> realtimeWorkerPool;
+	std::atomic<RealtimeWorkerPool*> currentRealtimeWorkerPool = { nullptr };
+
 	friend class UserPresetHandler;
     friend class PresetLoadingThread;
 	friend class DelayedRenderer;
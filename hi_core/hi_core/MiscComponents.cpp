@@ -1082,11 +1082,368 @@ void DrawActions::BlendingLayer::perform(Graphics& g)
 	gin::applyBlend(imageToBlendOn, blendSource, blendMode, alpha);
 }
 
+DrawActions::Command DrawActions::Command::create(Type t)
+{
+	Command c;
+	memset(&c, 0, sizeof(Command));
+	c.type = t;
+	return c;
+}
+
+DrawActions::Command DrawActions::Command::fillAll(Colour colour)
+{
+	auto c = create(Type::fillAll);
+	c.argb = colour.getARGB();
+	return c;
+}
+
+DrawActions::Command DrawActions::Command::setColour(Colour colour)
+{
+	auto c = create(Type::setColour);
+	c.argb = colour.getARGB();
+	return c;
+}
+
+DrawActions::Command DrawActions::Command::setOpacity(float alpha)
+{
+	auto c = create(Type::setOpacity);
+	c.data[0] = alpha;
+	return c;
+}
+
+DrawActions::Command DrawActions::Command::fillRect(Rectangle<float> area)
+{
+	auto c = create(Type::fillRect);
+	c.data[0] = area.getX(); c.data[1] = area.getY();
+	c.data[2] = area.getWidth(); c.data[3] = area.getHeight();
+	return c;
+}
+
+DrawActions::Command DrawActions::Command::drawRect(Rectangle<float> area, float borderSize)
+{
+	auto c = fillRect(area);
+	c.type = Type::drawRect;
+	c.data[4] = borderSize;
+	return c;
+}
+
+DrawActions::Command DrawActions::Command::fillEllipse(Rectangle<float> area)
+{
+	auto c = fillRect(area);
+	c.type = Type::fillEllipse;
+	return c;
+}
+
+DrawActions::Command DrawActions::Command::drawEllipse(Rectangle<float> area, float lineThickness)
+{
+	auto c = drawRect(area, lineThickness);
+	c.type = Type::drawEllipse;
+	return c;
+}
+
+DrawActions::Command DrawActions::Command::fillRoundedRect(Rectangle<float> area, float cornerSize, uint8 roundedCorners)
+{
+	auto c = fillRect(area);
+	c.type = Type::fillRoundedRect;
+	c.data[4] = cornerSize;
+	c.roundedCorners = roundedCorners;
+	return c;
+}
+
+DrawActions::Command DrawActions::Command::drawRoundedRect(Rectangle<float> area, float cornerSize, float borderSize, uint8 roundedCorners)
+{
+	auto c = fillRoundedRect(area, cornerSize, roundedCorners);
+	c.type = Type::drawRoundedRect;
+	c.data[5] = borderSize;
+	return c;
+}
+
+DrawActions::Command DrawActions::Command::drawHorizontalLine(int y, float left, float right)
+{
+	auto c = create(Type::drawHorizontalLine);
+	c.data[0] = (float)y; c.data[1] = left; c.data[2] = right;
+	return c;
+}
+
+DrawActions::Command DrawActions::Command::drawVerticalLine(int x, float top, float bottom)
+{
+	auto c = create(Type::drawVerticalLine);
+	c.data[0] = (float)x; c.data[1] = top; c.data[2] = bottom;
+	return c;
+}
+
+DrawActions::Command DrawActions::Command::drawLine(float x1, float y1, float x2, float y2, float lineThickness)
+{
+	auto c = create(Type::drawLine);
+	c.data[0] = x1; c.data[1] = y1;
+	c.data[2] = x2; c.data[3] = y2;
+	c.data[4] = lineThickness;
+	return c;
+}
+
+void DrawActions::Command::perform(Graphics& g) const
+{
+	Rectangle<float> area(data[0], data[1], data[2], data[3]);
+
+	auto performRounded = [&](bool fill)
+	{
+		if (roundedCorners == 0xF)
+		{
+			if (fill)
+				g.fillRoundedRectangle(area, data[4]);
+			else
+				g.drawRoundedRectangle(area, data[4], data[5]);
+		}
+		else if (roundedCorners == 0)
+		{
+			if (fill)
+				g.fillRect(area);
+			else
+				g.drawRect(area, data[5]);
+		}
+		else
+		{
+			Path p;
+			p.addRoundedRectangle(area.getX(), area.getY(), area.getWidth(), area.getHeight(), data[4], data[4],
+								  (roundedCorners & 1) != 0, (roundedCorners & 2) != 0, 
+								  (roundedCorners & 4) != 0, (roundedCorners & 8) != 0);
+
+			if (fill)
+				g.fillPath(p);
+			else
+				g.strokePath(p, PathStrokeType(data[5]));
+		}
+	};
+
+	switch (type)
+	{
+	case Type::fillAll:				g.fillAll(Colour(argb)); break;
+	case Type::setColour:			g.setColour(Colour(argb)); break;
+	case Type::setOpacity:			g.setOpacity(data[0]); break;
+	case Type::fillRect:			g.fillRect(area); break;
+	case Type::drawRect:			g.drawRect(area, data[4]); break;
+	case Type::fillEllipse:			g.fillEllipse(area); break;
+	case Type::drawEllipse:			g.drawEllipse(area, data[4]); break;
+	case Type::fillRoundedRect:		performRounded(true); break;
+	case Type::drawRoundedRect:		performRounded(false); break;
+	case Type::drawHorizontalLine:	g.drawHorizontalLine((int)data[0], data[1], data[2]); break;
+	case Type::drawVerticalLine:	g.drawVerticalLine((int)data[0], data[1], data[2]); break;
+	case Type::drawLine:			g.drawLine(data[0], data[1], data[2], data[3], data[4]); break;
+	default:						jassertfalse; break;
+	}
+}
+
+juce::Rectangle<float> DrawActions::Command::getBounds() const
+{
+	switch (type)
+	{
+	case Type::fillRect:
+	case Type::fillEllipse:
+	case Type::fillRoundedRect:
+		return Rectangle<float>(data[0], data[1], data[2], data[3]).expanded(1.0f);
+	case Type::drawRect:
+	case Type::drawEllipse:
+		return Rectangle<float>(data[0], data[1], data[2], data[3]).expanded(data[4] + 1.0f);
+	case Type::drawRoundedRect:
+		return Rectangle<float>(data[0], data[1], data[2], data[3]).expanded(data[5] + 1.0f);
+	case Type::drawHorizontalLine:
+		return Rectangle<float>::leftTopRightBottom(data[1], data[0], data[2], data[0] + 1.0f).expanded(1.0f);
+	case Type::drawVerticalLine:
+		return Rectangle<float>::leftTopRightBottom(data[0], data[1], data[0] + 1.0f, data[2]).expanded(1.0f);
+	case Type::drawLine:
+		return Rectangle<float>(Point<float>(data[0], data[1]), Point<float>(data[2], data[3])).expanded(data[4] + 1.0f);
+	default:
+		return {};
+	}
+}
+
+void DrawActions::Handler::addCommand(const Command& c)
+{
+	numCommandsThisFrame++;
+
+	if (auto layer = layerStack.getLast())
+	{
+		auto cb = dynamic_cast<CommandBuffer*>(layer->getLastDrawAction());
+
+		if (cb == nullptr)
+		{
+			// Layers own their actions, so we can't use the pool here
+			cb = new CommandBuffer();
+			layer->addDrawAction(cb);
+			numAllocationsThisFrame++;
+		}
+
+		cb->addCommand(c);
+	}
+	else
+	{
+		auto cb = dynamic_cast<CommandBuffer*>(currentActions.getLast().get());
+
+		if (cb == nullptr)
+		{
+			cb = getFreeCommandBuffer();
+			currentActions.add(cb);
+		}
+
+		cb->addCommand(c);
+	}
+}
+
+DrawActions::CommandBuffer* DrawActions::Handler::getFreeCommandBuffer()
+{
+	// If the pool holds the only reference, the buffer is neither used by the current
+	// frame nor by the renderer, so we can reuse its storage.
+	for (auto cb : commandBufferPool)
+	{
+		if (cb->getReferenceCount() == 1)
+		{
+			cb->clear();
+			return cb;
+		}
+	}
+
+	numAllocationsThisFrame++;
+	return commandBufferPool.add(new CommandBuffer());
+}
+
+void DrawActions::Handler::flush()
+{
+	bool needsUpdate = true;
+
+	{
+		SpinLock::ScopedLockType sl(lock);
+
+		Rectangle<float> changedArea;
+		auto diff = compareFrames(nextActions, currentActions, changedArea);
+
+		statistics.numFrames++;
+		statistics.numAllocationsLastFrame = numAllocationsThisFrame;
+		statistics.numCommandsLastFrame = numCommandsThisFrame;
+
+		if (diff == FrameDifference::Unchanged)
+		{
+			statistics.numSkippedFrames++;
+			needsUpdate = false;
+		}
+		else
+		{
+			if (diff == FrameDifference::Partial)
+			{
+				statistics.numPartialRepaints++;
+				pendingDirtyArea = pendingDirtyArea.getUnion(changedArea);
+			}
+			else
+				pendingFullRepaint = true;
+
+			nextActions.swapWith(currentActions);
+		}
+
+		currentActions.clear();
+		layerStack.clear();
+	}
+
+	if (needsUpdate)
+		triggerAsyncUpdate();
+}
+
+DrawActions::Handler::Statistics DrawActions::Handler::getStatistics()
+{
+	SpinLock::ScopedLockType sl(lock);
+
+	auto s = statistics;
+	s.numReplays = numReplays.load();
+	return s;
+}
+
+DrawActions::Handler::FrameDifference DrawActions::Handler::compareFrames(const ReferenceCountedArray<ActionBase>& oldActions, const ReferenceCountedArray<ActionBase>& newActions, Rectangle<float>& changedArea)
+{
+	if (oldActions.size() != newActions.size())
+		return FrameDifference::Full;
+
+	bool onlyCommands = true;
+	bool changed = false;
+
+	for (int i = 0; i < newActions.size(); i++)
+	{
+		auto oldAction = oldActions.getUnchecked(i);
+		auto newAction = newActions.getUnchecked(i);
+
+		auto oldBuffer = dynamic_cast<CommandBuffer*>(oldAction.get());
+		auto newBuffer = dynamic_cast<CommandBuffer*>(newAction.get());
+
+		if (oldBuffer != nullptr && newBuffer != nullptr)
+		{
+			const auto& oldCommands = oldBuffer->getCommands();
+			const auto& newCommands = newBuffer->getCommands();
+
+			if (oldCommands.size() != newCommands.size())
+				return FrameDifference::Full;
+
+			for (int j = 0; j < newCommands.size(); j++)
+			{
+				const auto& o = oldCommands.getReference(j);
+				const auto& n = newCommands.getReference(j);
+
+				if (o != n)
+				{
+					if (o.type != n.type || o.needsFullRepaint())
+						return FrameDifference::Full;
+
+					changedArea = changedArea.getUnion(o.getBounds()).getUnion(n.getBounds());
+					changed = true;
+				}
+			}
+		}
+		else
+		{
+			onlyCommands = false;
+
+			if (!newAction->isEqualTo(*oldAction))
+				return FrameDifference::Full;
+		}
+	}
+
+	if (!changed)
+		return FrameDifference::Unchanged;
+
+	// Other actions might contain transforms so we can't rely on the bounds of the commands.
+	return onlyCommands ? FrameDifference::Partial : FrameDifference::Full;
+}
+
+void DrawActions::Handler::handleAsyncUpdate()
+{
+	Rectangle<int> dirtyArea;
+	bool fullRepaint;
+
+	{
+		SpinLock::ScopedLockType sl(lock);
+
+		fullRepaint = pendingFullRepaint || pendingDirtyArea.isEmpty();
+		dirtyArea = pendingDirtyArea.getSmallestIntegerContainer();
+
+		pendingFullRepaint = false;
+		pendingDirtyArea = {};
+	}
+
+	for (auto l : listeners)
+	{
+		if (l != nullptr)
+		{
+			if (fullRepaint)
+				l->newPaintActionsAvailable();
+			else
+				l->paintActionsChangedInArea(dirtyArea);
+		}
+	}
+}
+
 void DrawActions::Handler::Iterator::render(Graphics& g, Component* c)
 {
 	if (handler->recursion)
 		return;
 
+	handler->numReplays++;
+
 	UnblurryGraphics ug(g, *c);
 
 	auto sf = ug.getTotalScaleFactor();
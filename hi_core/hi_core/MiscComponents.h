@@ -286,6 +286,12 @@ struct DrawActions
 		virtual void setCachedImage(Image& actionImage_, Image& mainImage_) { actionImage = actionImage_; mainImage = mainImage_; }
 		virtual void setScaleFactor(float sf) { scaleFactor = sf; }
 
+		/** Override this and return true if the other action will render the exact same thing. 
+		
+			This is used to skip the repaint if a paint routine creates the same actions as the last time.
+		*/
+		virtual bool isEqualTo(const ActionBase& other) const { ignoreUnused(other); return false; }
+
 	protected:
 
 		Image actionImage;
@@ -318,6 +324,100 @@ struct DrawActions
 		Rectangle<float> area;
 	};
 
+	/** A POD record for the simple drawing operations.
+	
+		Those are collected in a CommandBuffer so that a paint routine doesn't have to allocate an 
+		action object for every call and two frames can be compared with a memcmp.
+	*/
+	struct Command
+	{
+		enum class Type : uint8
+		{
+			fillAll,
+			setColour,
+			setOpacity,
+			fillRect,
+			drawRect,
+			fillEllipse,
+			drawEllipse,
+			fillRoundedRect,
+			drawRoundedRect,
+			drawHorizontalLine,
+			drawVerticalLine,
+			drawLine,
+			numTypes
+		};
+
+		static Command fillAll(Colour c);
+		static Command setColour(Colour c);
+		static Command setOpacity(float alpha);
+		static Command fillRect(Rectangle<float> area);
+		static Command drawRect(Rectangle<float> area, float borderSize);
+		static Command fillEllipse(Rectangle<float> area);
+		static Command drawEllipse(Rectangle<float> area, float lineThickness);
+
+		/** The corners are a bitmask (top left, top right, bottom left, bottom right). */
+		static Command fillRoundedRect(Rectangle<float> area, float cornerSize, uint8 roundedCorners=0xF);
+		static Command drawRoundedRect(Rectangle<float> area, float cornerSize, float borderSize, uint8 roundedCorners = 0xF);
+
+		static Command drawHorizontalLine(int y, float left, float right);
+		static Command drawVerticalLine(int x, float top, float bottom);
+		static Command drawLine(float x1, float y1, float x2, float y2, float lineThickness);
+
+		void perform(Graphics& g) const;
+
+		/** Returns true if a change of this command affects the entire component (or all following commands). */
+		bool needsFullRepaint() const noexcept { return type == Type::fillAll || type == Type::setColour || type == Type::setOpacity; }
+
+		/** Returns the area that is affected by this command. */
+		Rectangle<float> getBounds() const;
+
+		bool operator==(const Command& other) const noexcept { return memcmp(this, &other, sizeof(Command)) == 0; }
+		bool operator!=(const Command& other) const noexcept { return !(*this == other); }
+
+		Type type;
+		uint8 roundedCorners;
+		uint16 unused;
+		uint32 argb;
+		float data[6];
+
+	private:
+
+		static Command create(Type t);
+	};
+
+	/** An action that performs a list of commands. The list is reused between frames, so it won't allocate once it has grown to the required size. */
+	class CommandBuffer : public ActionBase
+	{
+	public:
+
+		using Ptr = ReferenceCountedObjectPtr<CommandBuffer>;
+
+		void perform(Graphics& g) override
+		{
+			for (const auto& c : commands)
+				c.perform(g);
+		}
+
+		bool isEqualTo(const ActionBase& other) const override
+		{
+			if (auto cb = dynamic_cast<const CommandBuffer*>(&other))
+				return commands == cb->commands;
+
+			return false;
+		}
+
+		void addCommand(const Command& c) { commands.add(c); }
+
+		void clear() { commands.clearQuick(); }
+
+		const Array<Command>& getCommands() const noexcept { return commands; }
+
+	private:
+
+		Array<Command> commands;
+	};
+
 	class ActionLayer : public ActionBase
 	{
 	public:
@@ -390,6 +490,11 @@ struct DrawActions
 			internalActions.add(a);
 		}
 
+		ActionBase* getLastDrawAction() const
+		{
+			return internalActions.getLast();
+		}
+
 		void addPostAction(PostActionBase* a)
 		{
 			postActions.add(a);
@@ -528,11 +633,25 @@ struct DrawActions
 			Handler* handler;
 		};
 
+		/** Counters for the paint routine performance. */
+		struct Statistics
+		{
+			int numFrames = 0;				 ///< the number of flushed frames
+			int numSkippedFrames = 0;		 ///< the frames that were identical to the previous frame
+			int numPartialRepaints = 0;		 ///< the frames that only repainted the changed area
+			int numReplays = 0;				 ///< the number of times the actions were rendered
+			int numAllocationsLastFrame = 0; ///< the number of action objects created in the last frame
+			int numCommandsLastFrame = 0;	 ///< the number of commands written to command buffers in the last frame
+		};
+
 		struct Listener
 		{
 			virtual ~Listener() {};
 			virtual void newPaintActionsAvailable() = 0;
 
+			/** Called instead of newPaintActionsAvailable() if only the commands in the given area have changed. */
+			virtual void paintActionsChangedInArea(Rectangle<int> area) { ignoreUnused(area); newPaintActionsAvailable(); }
+
 			JUCE_DECLARE_WEAK_REFERENCEABLE(Listener);
 		};
 
@@ -544,6 +663,8 @@ struct DrawActions
 		void beginDrawing()
 		{
 			currentActions.clear();
+			numAllocationsThisFrame = 0;
+			numCommandsThisFrame = 0;
 		}
 
 		bool beginBlendLayer(const Identifier& blendMode, float alpha);
@@ -568,24 +689,26 @@ struct DrawActions
 
 		void addDrawAction(ActionBase* newDrawAction)
 		{
+			numAllocationsThisFrame++;
+
 			if (layerStack.getLast() != nullptr)
 				layerStack.getLast()->addDrawAction(newDrawAction);
 			else
 				currentActions.add(newDrawAction);
 		}
 
-		void flush()
-		{
-			{
-				SpinLock::ScopedLockType sl(lock);
+		/** Adds a simple draw command. Consecutive commands are written into the same command buffer. */
+		void addCommand(const Command& c);
 
-				nextActions.swapWith(currentActions);
-				currentActions.clear();
-				layerStack.clear();
-			}
+		/** Hands over the actions of the current frame to the renderer. 
+		
+			If the actions are identical to the last frame, they will be discarded without 
+			a repaint. If only the bounds of some commands have changed, it will just repaint 
+			the affected area.
+		*/
+		void flush();
 
-			triggerAsyncUpdate();
-		}
+		Statistics getStatistics();
 
 		void logError(const String& message)
 		{
@@ -622,19 +745,35 @@ struct DrawActions
 		Rectangle<int> topLevelBounds;
 		float scaleFactor = 1.0f;
 
-		void handleAsyncUpdate() override
+		enum class FrameDifference
 		{
-			for (auto l : listeners)
-			{
-				if (l != nullptr)
-					l->newPaintActionsAvailable();
-			}
-		}
+			Unchanged,
+			Partial,
+			Full
+		};
+
+		static FrameDifference compareFrames(const ReferenceCountedArray<ActionBase>& oldActions, 
+											 const ReferenceCountedArray<ActionBase>& newActions, 
+											 Rectangle<float>& changedArea);
+
+		CommandBuffer* getFreeCommandBuffer();
+
+		void handleAsyncUpdate() override;
 
 		Array<WeakReference<Listener>> listeners;
 
 		SpinLock lock;
 
+		Rectangle<float> pendingDirtyArea;
+		bool pendingFullRepaint = false;
+
+		Statistics statistics;
+		int numAllocationsThisFrame = 0;
+		int numCommandsThisFrame = 0;
+		std::atomic<int> numReplays = { 0 };
+
+		ReferenceCountedArray<CommandBuffer> commandBufferPool;
+
 		ReferenceCountedArray<ActionLayer> layerStack;
 
 		ReferenceCountedArray<ActionBase> nextActions;
@@ -674,6 +813,8 @@ public:
 
 	void newPaintActionsAvailable() override { repaint(); }
 
+	void paintActionsChangedInArea(Rectangle<int> area) override { repaint(area); }
+
 	void paint(Graphics &g);
 	Colour c1, c2, borderColour;
 
@@ -64,6 +64,8 @@ MainController::SampleManager::~SampleManager()
 	internalPreloadJob.signalJobShouldExit();
 	samplerLoaderThreadPool->stopThread(2000);
 
+	preloadThreadPool = nullptr;
+
 	pendingFunctions.clear();
 
 	jassert(pendingFunctions.isEmpty());
@@ -137,6 +139,17 @@ double& MainController::SampleManager::getPreloadProgress()
 	return internalPreloadJob.progress;
 }
 
+ThreadPool* MainController::SampleManager::getPreloadThreadPool()
+{
+	if (hddMode || HISE_NUM_PRELOAD_THREADS < 2)
+		return nullptr;
+
+	if (preloadThreadPool == nullptr)
+		preloadThreadPool = new ThreadPool(HISE_NUM_PRELOAD_THREADS);
+
+	return preloadThreadPool;
+}
+
 void MainController::SampleManager::cancelAllJobs()
 {
 	internalPreloadJob.signalJobShouldExit();
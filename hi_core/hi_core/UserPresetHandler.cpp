@@ -38,11 +38,22 @@ void MainController::UserPresetHandler::TagDataBase::buildDataBase(bool force /*
 	{
 		buildInternal();
 	}
+	else if (tagMasksDirty)
+	{
+		updateTagMasks();
+	}
 }
 
 void MainController::UserPresetHandler::TagDataBase::buildInternal()
 {
-	cachedTags.clear();
+	if (cachedTags.isEmpty())
+		loadIndex(cacheIndex);
+
+	Array<CachedTag> previousTags;
+	HashMap<int64, int> previousIndex;
+
+	previousTags.swapWith(cachedTags);
+	previousIndex.swapWith(cacheIndex);
 
 	Array<File> allPresets;
 
@@ -50,27 +61,252 @@ void MainController::UserPresetHandler::TagDataBase::buildInternal()
 
 	PresetBrowser::DataBaseHelpers::cleanFileList(nullptr, allPresets);
 
+	// If a preset was removed, the amount of presets will either change or a new one will be parsed
+	bool indexChanged = allPresets.size() != previousTags.size();
+
 	for (auto f : allPresets)
 	{
-		auto sa = PresetBrowser::DataBaseHelpers::getTagsFromXml(f);
-
 		CachedTag newTag;
+		newTag.file = f;
 		newTag.hashCode = f.hashCode64();
-		for (auto t : sa)
-			newTag.tags.add(Identifier(t));
+		newTag.modificationTime = f.getLastModificationTime().toMilliseconds();
+		newTag.fileSize = f.getSize();
+
+		bool upToDate = false;
+
+		if (previousIndex.contains(newTag.hashCode))
+		{
+			auto& existing = previousTags.getReference(previousIndex[newTag.hashCode]);
+
+			upToDate = existing.file == f &&
+					   existing.modificationTime == newTag.modificationTime &&
+					   existing.fileSize == newTag.fileSize;
+
+			if (upToDate)
+				newTag.tags.swapWith(existing.tags);
+		}
+
+		if (!upToDate)
+		{
+			auto sa = PresetBrowser::DataBaseHelpers::getTagsFromXml(f);
+
+			for (auto t : sa)
+			{
+				if (t.isNotEmpty())
+					newTag.tags.add(Identifier(t));
+			}
 
+			indexChanged = true;
+		}
+
+		cacheIndex.set(newTag.hashCode, cachedTags.size());
 		cachedTags.add(std::move(newTag));
 	}
 
+	updateTagMasks();
+
+	if (indexChanged)
+		saveIndex();
+
 	dirty = false;
 }
 
+bool MainController::UserPresetHandler::TagDataBase::loadIndex(HashMap<int64, int>& lookup)
+{
+	cachedTags.clear();
+	lookup.clear();
+
+	auto indexFile = getIndexFile();
+
+	if (!indexFile.existsAsFile())
+		return false;
+
+	FileInputStream fis(indexFile);
+
+	if (fis.failedToOpen() || fis.readString() != "HiseTagIndex" || fis.readInt() != IndexFileVersion)
+		return false;
+
+	auto numEntries = fis.readInt();
+
+	auto discard = [&]()
+	{
+		// Truncated or corrupt index file, just parse everything again
+		cachedTags.clear();
+		lookup.clear();
+		return false;
+	};
+
+	for (int i = 0; i < numEntries; i++)
+	{
+		if (fis.isExhausted())
+			return discard();
+
+		CachedTag c;
+		c.file = root.getChildFile(fis.readString());
+		c.hashCode = c.file.hashCode64();
+		c.modificationTime = fis.readInt64();
+		c.fileSize = fis.readInt64();
+
+		auto numTags = fis.readInt();
+
+		for (int j = 0; j < numTags; j++)
+		{
+			if (fis.isExhausted())
+				return discard();
+
+			auto t = fis.readString();
+
+			if (t.isNotEmpty())
+				c.tags.add(Identifier(t));
+		}
+
+		lookup.set(c.hashCode, cachedTags.size());
+		cachedTags.add(std::move(c));
+	}
+
+	// The end marker catches a file that was cut off within the last entry
+	if (fis.readString() != "End")
+		return discard();
+
+	return true;
+}
+
+void MainController::UserPresetHandler::TagDataBase::saveIndex() const
+{
+	if (!root.isDirectory())
+		return;
+
+	TemporaryFile tmp(getIndexFile());
+
+	{
+		FileOutputStream fos(tmp.getFile());
+
+		if (fos.failedToOpen())
+			return;
+
+		fos.writeString("HiseTagIndex");
+		fos.writeInt(IndexFileVersion);
+		fos.writeInt(cachedTags.size());
+
+		for (const auto& c : cachedTags)
+		{
+			fos.writeString(c.file.getRelativePathFrom(root));
+			fos.writeInt64(c.modificationTime);
+			fos.writeInt64(c.fileSize);
+			fos.writeInt(c.tags.size());
+
+			for (const auto& t : c.tags)
+				fos.writeString(t.toString());
+		}
+
+		fos.writeString("End");
+
+		fos.flush();
+	}
+
+	tmp.overwriteTargetFileWithTemporary();
+}
+
+void MainController::UserPresetHandler::TagDataBase::setActiveTags(const Array<Identifier>& newActiveTags)
+{
+	if (tagMasksDirty)
+		updateTagMasks();
+
+	activeTags = newActiveTags;
+	activeMask.clear();
+
+	for (const auto& t : activeTags)
+		activeMask.setBit(getTagBit(t));
+
+	updateShownState();
+}
+
+const MainController::UserPresetHandler::TagDataBase::CachedTag* MainController::UserPresetHandler::TagDataBase::getCachedTag(const File& presetFile) const
+{
+	auto hash = presetFile.hashCode64();
+
+	if (cacheIndex.contains(hash))
+	{
+		auto& c = cachedTags.getReference(cacheIndex[hash]);
+
+		if (c.file == presetFile)
+			return &c;
+	}
+
+	return nullptr;
+}
+
+void MainController::UserPresetHandler::TagDataBase::invalidateFile(const File& presetFile)
+{
+	auto hash = presetFile.hashCode64();
+
+	if (cacheIndex.contains(hash))
+	{
+		auto& c = cachedTags.getReference(cacheIndex[hash]);
+
+		if (c.file == presetFile)
+			c.modificationTime = -1;
+	}
+}
+
+void MainController::UserPresetHandler::TagDataBase::updateTagMasks()
+{
+	tagMasksDirty = false;
+	tagBits.clear();
+
+	for (const auto& t : tagList)
+	{
+		if (t.isNotEmpty())
+			getTagBit(Identifier(t));
+	}
+
+	for (auto& c : cachedTags)
+	{
+		c.tagMask.clear();
+
+		for (const auto& t : c.tags)
+			c.tagMask.setBit(getTagBit(t));
+	}
+
+	activeMask.clear();
+
+	for (const auto& t : activeTags)
+		activeMask.setBit(getTagBit(t));
+
+	updateShownState();
+}
+
+void MainController::UserPresetHandler::TagDataBase::updateShownState()
+{
+	for (auto& c : cachedTags)
+	{
+		auto matches = c.tagMask;
+		matches &= activeMask;
+		c.shown = matches == activeMask;
+	}
+}
+
+int MainController::UserPresetHandler::TagDataBase::getTagBit(const Identifier& id)
+{
+	auto index = tagBits.indexOf(id);
+
+	if (index == -1)
+	{
+		index = tagBits.size();
+		tagBits.add(id);
+	}
+
+	return index;
+}
+
 void MainController::UserPresetHandler::TagDataBase::setRootDirectory(const File& newRoot)
 {
 
 	if (root != newRoot)
 	{
 		root = newRoot;
+		cachedTags.clear();
+		cacheIndex.clear();
 		dirty = true;
 	}
 }
@@ -885,4 +1121,186 @@ void MainController::UserPresetHandler::FactoryPaths::addRecursive(const ValueTr
 
 
 
+#if HI_RUN_UNIT_TESTS
+
+class TagDataBaseTests : public UnitTest
+{
+public:
+
+	using TagDataBase = MainController::UserPresetHandler::TagDataBase;
+
+	TagDataBaseTests() :
+		UnitTest("Testing the user preset tag database")
+	{}
+
+	void runTest() override
+	{
+		root = File::createTempFile("TagDataBaseTests");
+		root.createDirectory();
+
+		testIndexRoundTrip();
+		testIncrementalReparse();
+		testTruncatedIndex();
+		testDeferredTagList();
+
+		root.deleteRecursively();
+	}
+
+private:
+
+	File root;
+
+	File getPreset(const String& name) const { return root.getChildFile(name + ".preset"); }
+
+	void writePreset(const String& name, const String& tags)
+	{
+		XmlElement xml("Preset");
+		xml.setAttribute("Tags", tags);
+		getPreset(name).replaceWithText(xml.createDocument(""));
+	}
+
+	/** Changes the tags but keeps the size and modification time so that only an explicit invalidation detects it. */
+	void writePresetSilently(const String& name, const String& tags)
+	{
+		auto f = getPreset(name);
+		auto time = f.getLastModificationTime();
+		writePreset(name, tags);
+		f.setLastModificationTime(time);
+	}
+
+	bool hasTag(TagDataBase& db, const String& name, const Identifier& tag)
+	{
+		if (auto c = db.getCachedTag(getPreset(name)))
+			return c->tags.contains(tag);
+
+		return false;
+	}
+
+	void testIndexRoundTrip()
+	{
+		beginTest("Testing the index file round trip");
+
+		writePreset("First", "Bass;Lead");
+		writePreset("Second", "Pad");
+		writePreset("Third", "Lead");
+
+		{
+			TagDataBase db;
+			db.setRootDirectory(root);
+			db.buildDataBase();
+
+			expectEquals(db.getCachedTags().size(), 3, "entries after the first scan");
+			expect(root.getChildFile("tag_index.dat").existsAsFile(), "index file was written");
+		}
+
+		// Same size, same modification time: a database that uses the index must report the old tags
+		writePresetSilently("Second", "Key");
+
+		TagDataBase db;
+		db.setRootDirectory(root);
+		db.buildDataBase();
+
+		expectEquals(db.getCachedTags().size(), 3, "entries after loading the index");
+		expect(hasTag(db, "First", "Bass") && hasTag(db, "First", "Lead"), "tags of First");
+		expect(hasTag(db, "Second", "Pad"), "Second was restored from the index");
+		expect(!hasTag(db, "Second", "Key"), "Second wasn't parsed again");
+
+		db.setActiveTags({ Identifier("Lead") });
+
+		expect(db.getCachedTag(getPreset("First"))->shown, "First has the Lead tag");
+		expect(!db.getCachedTag(getPreset("Second"))->shown, "Second doesn't have the Lead tag");
+		expect(db.getCachedTag(getPreset("Third"))->shown, "Third has the Lead tag");
+
+		writePreset("Second", "Pad");
+	}
+
+	void testIncrementalReparse()
+	{
+		beginTest("Testing the incremental reparse");
+
+		TagDataBase db;
+		db.setRootDirectory(root);
+		db.buildDataBase();
+
+		writePresetSilently("Third", "Keys");
+		db.buildDataBase(true);
+
+		expect(hasTag(db, "Third", "Lead"), "unchanged file isn't parsed again");
+
+		db.invalidateFile(getPreset("Third"));
+		db.buildDataBase(true);
+
+		expect(hasTag(db, "Third", "Keys") && !hasTag(db, "Third", "Lead"), "invalidated file is parsed again");
+
+		writePreset("Fourth", "Bass");
+		getPreset("First").deleteFile();
+		db.buildDataBase(true);
+
+		expectEquals(db.getCachedTags().size(), 3, "entries after adding and removing a preset");
+		expect(db.getCachedTag(getPreset("First")) == nullptr, "removed preset is gone");
+		expect(hasTag(db, "Fourth", "Bass"), "new preset is parsed");
+
+		TagDataBase reloaded;
+		reloaded.setRootDirectory(root);
+		reloaded.buildDataBase();
+
+		expect(hasTag(reloaded, "Third", "Keys"), "index was updated after the reparse");
+		expect(reloaded.getCachedTag(getPreset("First")) == nullptr, "index doesn't contain the removed preset");
+	}
+
+	void testTruncatedIndex()
+	{
+		beginTest("Testing a truncated index file");
+
+		writePresetSilently("Second", "Key");
+
+		auto indexFile = root.getChildFile("tag_index.dat");
+
+		MemoryBlock mb;
+		indexFile.loadFileAsData(mb);
+		expect(mb.getSize() > 20, "index file has content");
+
+		indexFile.replaceWithData(mb.getData(), mb.getSize() - 10);
+
+		TagDataBase db;
+		db.setRootDirectory(root);
+		db.buildDataBase();
+
+		expectEquals(db.getCachedTags().size(), 3, "entries after a truncated index");
+		expect(hasTag(db, "Second", "Key"), "truncated index is discarded and every preset is parsed");
+		expect(hasTag(db, "Fourth", "Bass"), "last entry is parsed");
+
+		indexFile.replaceWithText("garbage");
+
+		TagDataBase garbage;
+		garbage.setRootDirectory(root);
+		garbage.buildDataBase();
+
+		expectEquals(garbage.getCachedTags().size(), 3, "entries after a corrupt index");
+	}
+
+	void testDeferredTagList()
+	{
+		beginTest("Testing the deferred tag mask update");
+
+		TagDataBase db;
+		db.setRootDirectory(root);
+		db.buildDataBase();
+
+		db.setActiveTags({ Identifier("Bass") });
+		expect(db.getCachedTag(getPreset("Fourth"))->shown, "Fourth is shown");
+
+		// Rebuilds the bit assignment, so the masks of the entries must follow
+		db.setTagList({ "Pad", "Key", "Bass" });
+		db.buildDataBase();
+
+		expect(db.getCachedTag(getPreset("Fourth"))->shown, "Fourth is still shown");
+		expect(!db.getCachedTag(getPreset("Third"))->shown, "Third is still hidden");
+	}
+};
+
+static TagDataBaseTests tagDataBaseTests;
+
+#endif
+
 } // namespace hise
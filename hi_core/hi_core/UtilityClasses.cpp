@@ -55,9 +55,9 @@ struct FileLimitInitialiser
 static FileLimitInitialiser fileLimitInitialiser;
 #endif
 
-double ScopedGlitchDetector::locationTimeSum[30] = { .0,.0,.0,.0,.0,.0,.0,.0,.0,.0, .0,.0,.0,.0,.0,.0,.0,.0,.0,.0, .0,.0,.0,.0,.0,.0,.0,.0,.0,.0};
-int ScopedGlitchDetector::locationIndex[30] = { 0,0,0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,0,0, };
-int ScopedGlitchDetector::lastPositiveId = 0;
+thread_local double ScopedGlitchDetector::locationTimeSum[30] = { .0,.0,.0,.0,.0,.0,.0,.0,.0,.0, .0,.0,.0,.0,.0,.0,.0,.0,.0,.0, .0,.0,.0,.0,.0,.0,.0,.0,.0,.0};
+thread_local int ScopedGlitchDetector::locationIndex[30] = { 0,0,0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,0,0, };
+thread_local int ScopedGlitchDetector::lastPositiveId = 0;
 
 ScopedGlitchDetector::ScopedGlitchDetector(Processor* const processor, int location_) :
 	location(location_),
@@ -126,6 +126,7 @@ double ScopedGlitchDetector::getAllowedPercentageForLocation(int locationId)
 	case DebugLogger::Location::SynthChainRendering:				return 0.5;
 	case DebugLogger::Location::SampleStart:						return 0.02;
 	case DebugLogger::Location::VoiceEffectRendering:				return 0.1;
+	case DebugLogger::Location::MonoEffectRendering:				return 0.1;
 	case DebugLogger::Location::ModulatorChainVoiceRendering:		return 0.05;
 	case DebugLogger::Location::ModulatorChainTimeVariantRendering: return 0.04;
 	case DebugLogger::Location::SynthVoiceRendering:				return 0.2;
@@ -138,6 +139,291 @@ double ScopedGlitchDetector::getAllowedPercentageForLocation(int locationId)
 	}
 }
 
+struct AudioThreadProfiler::ThreadData
+{
+	HeapBlock<Event> events;
+	std::atomic<int64> writeIndex = { 0 };
+	std::atomic<int64> clearIndex = { 0 };
+	std::atomic<bool> claimed = { false };
+	int depth = 0;
+	int16 index = 0;
+};
+
+static_assert((AudioThreadProfiler::NumEventsPerThread & (AudioThreadProfiler::NumEventsPerThread - 1)) == 0, "must be a power of two");
+
+static AudioThreadProfiler::ThreadData profilerThreadData[AudioThreadProfiler::MaxNumThreads];
+
+std::atomic<bool> AudioThreadProfiler::enabled = { false };
+
+void AudioThreadProfiler::ScopedEvent::begin(const Processor* p, int location_, int voiceIndex_) noexcept
+{
+	processor = p;
+	location = (int16)location_;
+	voiceIndex = (int16)voiceIndex_;
+	depth = (int16)data->depth++;
+	startTicks = Time::getHighResolutionTicks();
+}
+
+void AudioThreadProfiler::ScopedEvent::end() noexcept
+{
+	auto durationTicks = Time::getHighResolutionTicks() - startTicks;
+
+	data->depth--;
+
+	auto index = data->writeIndex.load(std::memory_order_relaxed);
+	auto& e = data->events[(int)(index & (NumEventsPerThread - 1))];
+
+	e.startTicks = startTicks;
+	e.durationTicks = durationTicks;
+	e.processor = processor;
+	e.location = location;
+	e.voiceIndex = voiceIndex;
+	e.depth = depth;
+	e.threadIndex = data->index;
+
+	data->writeIndex.store(index + 1, std::memory_order_release);
+}
+
+AudioThreadProfiler::ThreadData* AudioThreadProfiler::getThreadData() noexcept
+{
+	// Releases the slot when the thread exits so that short-lived threads 
+	// (eg. after the host restarted its audio threads) don't use up all slots.
+	// The recorded events stay in the buffer until they are overwritten.
+	struct SlotClaim
+	{
+		~SlotClaim()
+		{
+			if (data != nullptr)
+			{
+				data->depth = 0;
+				data->claimed.store(false, std::memory_order_release);
+			}
+		}
+
+		ThreadData* data = nullptr;
+		bool initialised = false;
+	};
+
+	static thread_local SlotClaim claim;
+
+	if (!claim.initialised)
+	{
+		claim.initialised = true;
+
+		for (int i = 0; i < MaxNumThreads; i++)
+		{
+			bool expected = false;
+
+			if (profilerThreadData[i].claimed.compare_exchange_strong(expected, true))
+			{
+				profilerThreadData[i].index = (int16)i;
+				claim.data = profilerThreadData + i;
+				break;
+			}
+		}
+	}
+
+	return claim.data;
+}
+
+void AudioThreadProfiler::setEnabled(bool shouldBeEnabled)
+{
+	static CriticalSection allocationLock;
+
+	ScopedLock sl(allocationLock);
+
+	if (shouldBeEnabled)
+	{
+		for (auto& d : profilerThreadData)
+		{
+			if (d.events == nullptr)
+				d.events.calloc(NumEventsPerThread);
+		}
+	}
+
+	enabled.store(shouldBeEnabled, std::memory_order_release);
+}
+
+void AudioThreadProfiler::clear()
+{
+	for (auto& d : profilerThreadData)
+		d.clearIndex.store(d.writeIndex.load());
+}
+
+Array<AudioThreadProfiler::Event> AudioThreadProfiler::getEvents()
+{
+	Array<Event> list;
+
+	for (auto& d : profilerThreadData)
+	{
+		if (d.events == nullptr)
+			continue;
+
+		auto endIndex = d.writeIndex.load(std::memory_order_acquire);
+		auto startIndex = jmax<int64>(0, d.clearIndex.load(), endIndex - NumEventsPerThread);
+
+		Array<Event> copy;
+		copy.ensureStorageAllocated((int)(endIndex - startIndex));
+
+		for (auto i = startIndex; i < endIndex; i++)
+			copy.add(d.events[(int)(i & (NumEventsPerThread - 1))]);
+
+		// Skip the events that were overwritten by the audio thread while copying. The slot of
+		// the next event (writeIndex) might be written right now, so its old content is invalid too.
+		auto firstValidIndex = d.writeIndex.load(std::memory_order_acquire) - NumEventsPerThread + 1;
+
+		for (int i = 0; i < copy.size(); i++)
+		{
+			if (startIndex + i >= firstValidIndex)
+				list.add(copy.getReference(i));
+		}
+	}
+
+	struct Sorter
+	{
+		static int compareElements(const Event& a, const Event& b)
+		{
+			if (a.startTicks < b.startTicks) return -1;
+			if (a.startTicks > b.startTicks) return 1;
+			return (int)a.depth - (int)b.depth;
+		}
+	};
+
+	Sorter s;
+	list.sort(s, true);
+
+	return list;
+}
+
+namespace AudioThreadProfilerHelpers
+{
+	static StringArray getProcessorIds(MainController* mc, HashMap<const void*, int>& indexes)
+	{
+		StringArray ids;
+
+		Processor::Iterator<Processor> iter(mc->getMainSynthChain(), false);
+
+		while (auto p = iter.getNextProcessor())
+		{
+			indexes.set(p, ids.size());
+			ids.add(p->getId());
+		}
+
+		return ids;
+	}
+
+	static int64 toNanoseconds(int64 ticks)
+	{
+		return (int64)(Time::highResolutionTicksToSeconds(ticks) * 1000000000.0);
+	}
+
+	/** The recording is process-wide, so this removes the events of other MainController instances. */
+	static void removeForeignEvents(Array<AudioThreadProfiler::Event>& events, const HashMap<const void*, int>& indexes)
+	{
+		events.removeIf([&indexes](const AudioThreadProfiler::Event& e)
+		{
+			return !indexes.contains(e.processor);
+		});
+	}
+}
+
+bool AudioThreadProfiler::writeChromeTrace(OutputStream& output, MainController* mc)
+{
+	auto events = getEvents();
+
+	HashMap<const void*, int> indexes;
+	auto ids = AudioThreadProfilerHelpers::getProcessorIds(mc, indexes);
+
+	AudioThreadProfilerHelpers::removeForeignEvents(events, indexes);
+
+	if (events.isEmpty())
+		return false;
+
+	const auto t0 = events.getFirst().startTicks;
+
+	output << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+
+	uint32 usedThreads = 0;
+
+	for (const auto& e : events)
+		usedThreads |= (1u << e.threadIndex);
+
+	for (int i = 0; i < MaxNumThreads; i++)
+	{
+		if (usedThreads & (1u << i))
+			output << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << i << ",\"args\":{\"name\":\"Audio Thread " << i << "\"}},\n";
+	}
+
+	for (int i = 0; i < events.size(); i++)
+	{
+		const auto& e = events.getReference(i);
+
+		auto locationName = DebugLogger::getNameForLocation((DebugLogger::Location)e.location);
+		auto name = ids[indexes[e.processor]];
+
+		if (e.voiceIndex >= 0)
+			name << " Voice " << String(e.voiceIndex);
+
+		// Chrome expects microseconds, so the fractional part contains the nanoseconds.
+		auto ts = (double)AudioThreadProfilerHelpers::toNanoseconds(e.startTicks - t0) / 1000.0;
+		auto dur = (double)AudioThreadProfilerHelpers::toNanoseconds(e.durationTicks) / 1000.0;
+
+		output << "{\"name\":" << JSON::toString(var(name)) 
+			   << ",\"cat\":" << JSON::toString(var(locationName))
+			   << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << (int)e.threadIndex
+			   << ",\"ts\":" << String(ts, 3) 
+			   << ",\"dur\":" << String(dur, 3)
+			   << ",\"args\":{\"depth\":" << (int)e.depth << "}}";
+
+		output << (i == events.size() - 1 ? "\n" : ",\n");
+	}
+
+	output << "]}\n";
+	output.flush();
+
+	return true;
+}
+
+bool AudioThreadProfiler::writeBinary(OutputStream& output, MainController* mc)
+{
+	auto events = getEvents();
+
+	HashMap<const void*, int> indexes;
+	auto ids = AudioThreadProfilerHelpers::getProcessorIds(mc, indexes);
+
+	AudioThreadProfilerHelpers::removeForeignEvents(events, indexes);
+
+	if (events.isEmpty())
+		return false;
+
+	const auto t0 = events.getFirst().startTicks;
+
+	output.write("HPRF", 4);
+	output.writeInt(1);
+
+	output.writeInt(ids.size());
+
+	for (const auto& id : ids)
+		output.writeString(id);
+
+	output.writeInt(events.size());
+
+	for (const auto& e : events)
+	{
+		output.writeInt64(AudioThreadProfilerHelpers::toNanoseconds(e.startTicks - t0));
+		output.writeInt64(AudioThreadProfilerHelpers::toNanoseconds(e.durationTicks));
+		output.writeInt(indexes[e.processor]);
+		output.writeShort(e.location);
+		output.writeShort(e.voiceIndex);
+		output.writeShort(e.depth);
+		output.writeShort(e.threadIndex);
+	}
+
+	output.flush();
+
+	return true;
+}
+
 
 
 int AutoSaver::getIntervalInMinutes() const
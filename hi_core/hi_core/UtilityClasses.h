@@ -400,12 +400,13 @@ private:
     
 	int location = 0;
 
-	static double locationTimeSum[30];
-	static int locationIndex[30];
+	// The state is per thread because the detectors are also used on the realtime worker threads
+	static thread_local double locationTimeSum[30];
+	static thread_local int locationIndex[30];
 
     const double startTime;
     
-    static int lastPositiveId;
+    static thread_local int lastPositiveId;
 
 	WeakReference<Processor> p;
 
@@ -422,6 +423,123 @@ private:
 #endif
 
 
+/** A lock-free recorder for the time spent in the different parts of the audio rendering.
+*	@ingroup debugging
+*
+*	Every thread that renders audio (including the realtime worker threads) gets its own ring buffer,
+*	so recording an event doesn't need any synchronisation. An event is written when a 
+*	ADD_AUDIO_PROFILER_SCOPE goes out of scope and contains the start time and duration of the scope,
+*	the processor and the DebugLogger::Location. The nesting depth of the scopes is stored too, so you
+*	get a hierarchical breakdown of every audio callback across synths, voices, modulators, effects 
+*	and script callbacks.
+*
+*	The profiler is disabled by default and an inactive scope only checks an atomic flag. Use 
+*	writeChromeTrace() to load the result into chrome://tracing (or Perfetto) and writeBinary()
+*	for a compact format for offline analysis.
+*
+*	The recording state and the buffers are shared by all MainController instances in the process
+*	(eg. multiple plugin instances in a host), so enabling or clearing it in one instance affects the
+*	others. The writers only export the events of the processors of the given MainController.
+*/
+class AudioThreadProfiler
+{
+public:
+
+	static constexpr int NumEventsPerThread = 16384;
+	static constexpr int MaxNumThreads = 16;
+
+	struct Event
+	{
+		int64 startTicks;
+		int64 durationTicks;
+		const Processor* processor;
+		int16 location;
+		int16 voiceIndex;
+		int16 depth;
+		int16 threadIndex;
+	};
+
+	struct ThreadData;
+
+	class ScopedEvent
+	{
+	public:
+
+		ScopedEvent(const Processor* p, int location_, int voiceIndex_=-1) noexcept:
+			data(isEnabled() ? getThreadData() : nullptr)
+		{
+			if (data != nullptr)
+				begin(p, location_, voiceIndex_);
+		}
+
+		~ScopedEvent() noexcept
+		{
+			if (data != nullptr)
+				end();
+		}
+
+	private:
+
+		void begin(const Processor* p, int location_, int voiceIndex_) noexcept;
+		void end() noexcept;
+
+		ThreadData* data;
+		const Processor* processor = nullptr;
+		int64 startTicks = 0;
+		int16 location = 0;
+		int16 voiceIndex = -1;
+		int16 depth = 0;
+
+		JUCE_DECLARE_NON_COPYABLE(ScopedEvent);
+	};
+
+	/** Enables the recording. The buffers are allocated the first time you call this. */
+	static void setEnabled(bool shouldBeEnabled);
+
+	/** Pairs with the release store in setEnabled() so that the audio thread sees the allocated buffers. */
+	static bool isEnabled() noexcept { return enabled.load(std::memory_order_acquire); }
+
+	/** Removes all recorded events. */
+	static void clear();
+
+	/** Returns a copy of all recorded events sorted by their start time. */
+	static Array<Event> getEvents();
+
+	/** Writes the recorded events as Chrome trace JSON. 
+	
+		The processors are resolved using the module tree of the given MainController, the events of
+		other instances are skipped. Returns false if there are no events for this instance.
+	*/
+	static bool writeChromeTrace(OutputStream& output, MainController* mc);
+
+	/** Writes the recorded events in a compact binary format. 
+	
+		The format is: 
+		- the magic number 'HPRF' and the version as int32
+		- the number of processors as int32 followed by the processor IDs as null terminated strings
+		- the number of events as int32 followed by the events: start and duration in nanoseconds as int64, 
+		  processor index as int32 and location, voice index, depth and thread index as int16.
+
+		Like writeChromeTrace(), this only contains the events of the given MainController.
+	*/
+	static bool writeBinary(OutputStream& output, MainController* mc);
+
+private:
+
+	static ThreadData* getThreadData() noexcept;
+
+	static std::atomic<bool> enabled;
+};
+
+#if HISE_ENABLE_AUDIO_PROFILER
+#define ADD_AUDIO_PROFILER_SCOPE(processor, location) AudioThreadProfiler::ScopedEvent JUCE_JOIN_MACRO(ape_, __LINE__)(processor, (int)location)
+#define ADD_AUDIO_PROFILER_VOICE_SCOPE(processor, location, voiceIndex) AudioThreadProfiler::ScopedEvent JUCE_JOIN_MACRO(ape_, __LINE__)(processor, (int)location, voiceIndex)
+#else
+#define ADD_AUDIO_PROFILER_SCOPE(processor, location)
+#define ADD_AUDIO_PROFILER_VOICE_SCOPE(processor, location, voiceIndex)
+#endif
+
+
 
 
 /** Calculates the balance.
@@ -473,6 +473,15 @@ public:
         return largestBlockSize;
     };
 
+	/** Overwrite this and return true if the processor doesn't access any state that is shared with other processors while rendering audio.
+	*
+	*	This is used by the ModulatorSynthChain to decide which child synths can be rendered on different threads
+	*	(a child synth is only rendered concurrently if all its sub processors return true). It's opt-in, so
+	*	every processor that isn't known to be safe (eg. scripts, scriptnode networks or third party modules) will
+	*	be rendered on the audio thread.
+	*/
+	virtual bool canBeProcessedConcurrently() const { return false; }
+
 	
 #if USE_BACKEND
 	/** Prints a message to the console.
@@ -488,6 +488,8 @@ public:
 	{
 		jassert(isOnAir());
 
+		ADD_AUDIO_PROFILER_SCOPE(this, DebugLogger::Location::MonoEffectRendering);
+
 		renderAllChains(startSample, numSamples);
 
 		constexpr int stepSize = 64;
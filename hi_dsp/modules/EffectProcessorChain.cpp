@@ -55,7 +55,14 @@ void EffectProcessorChain::renderMasterEffects(AudioSampleBuffer &b)
 
 	ADD_GLITCH_DETECTOR(parentProcessor, DebugLogger::Location::MasterEffectRendering);
 
-	FOR_EACH_MASTER_EFFECT(renderWholeBuffer(b));
+	for (int i = 0; i < masterEffects.size(); ++i)
+	{
+		if (!masterEffects[i]->isSoftBypassed())
+		{
+			ADD_AUDIO_PROFILER_SCOPE(masterEffects[i], DebugLogger::Location::MasterEffectRendering);
+			masterEffects[i]->renderWholeBuffer(b);
+		}
+	}
 
 	const auto prev = resetCounter;
 
@@ -54,6 +54,8 @@ public:
 
 	SET_PROCESSOR_NAME("EffectChain", "FX Chain", "chain");
 
+	bool canBeProcessedConcurrently() const override { return true; }
+
 	EffectProcessorChain(Processor *parentProcessor, const String &id, int numVoices);
 
 	~EffectProcessorChain();
@@ -104,7 +106,14 @@ public:
 
         ADD_GLITCH_DETECTOR(parentProcessor, DebugLogger::Location::VoiceEffectRendering);
         
-		FOR_EACH_VOICE_EFFECT(renderVoice(voiceIndex, b, startSample, numSamples)); 
+		for (int i = 0; i < voiceEffects.size(); ++i)
+		{
+			if (!voiceEffects[i]->isBypassed())
+			{
+				ADD_AUDIO_PROFILER_VOICE_SCOPE(voiceEffects[i], DebugLogger::Location::VoiceEffectRendering, voiceIndex);
+				voiceEffects[i]->renderVoice(voiceIndex, b, startSample, numSamples);
+			}
+		}
 	};
 
 	void preRenderCallback(int startSample, int numSamples)
@@ -144,6 +153,21 @@ public:
 		return resetCounter > 0;
 	}
 
+	/** Returns true if there is at least one voice effect that is not bypassed. */
+	bool hasActiveVoiceEffects() const
+	{
+		if (isBypassed())
+			return false;
+
+		for (int i = 0; i < voiceEffects.size(); i++)
+		{
+			if (!voiceEffects[i]->isBypassed())
+				return true;
+		}
+
+		return false;
+	}
+
 	bool hasTailingPolyEffects() const
 	{
 		for (int i = 0; i < voiceEffects.size(); i++)
@@ -68,6 +68,73 @@ struct MidiPlayerHelpers
 
 
 
+void HiseMidiSequence::EventIndex::rebuild(const MidiMessageSequence& seq)
+{
+	const int numEvents = seq.getNumEvents();
+
+	timestamps.clearQuick();
+	noteOffIndexes.clearQuick();
+	noteOffFlags.clearQuick();
+
+	timestamps.ensureStorageAllocated(numEvents);
+	noteOffIndexes.insertMultiple(0, -1, numEvents);
+	noteOffFlags.insertMultiple(0, 0, numEvents);
+
+	// The index of the last unmatched note-on for every channel / note number
+	int pendingNoteOns[16 * 128];
+
+	for (auto& p : pendingNoteOns)
+		p = -1;
+
+	for (int i = 0; i < numEvents; i++)
+	{
+		auto& m = seq.getEventPointer(i)->message;
+
+		timestamps.add(m.getTimeStamp());
+
+		if (m.isNoteOnOrOff())
+		{
+			auto key = (jlimit(1, 16, m.getChannel()) - 1) * 128 + m.getNoteNumber();
+
+			if (m.isNoteOn())
+			{
+				pendingNoteOns[key] = i;
+			}
+			else
+			{
+				noteOffFlags.set(i, 1);
+
+				if (pendingNoteOns[key] != -1)
+				{
+					noteOffIndexes.set(pendingNoteOns[key], i);
+					pendingNoteOns[key] = -1;
+				}
+			}
+		}
+	}
+}
+
+int HiseMidiSequence::EventIndex::getNextIndexAtTime(double ticks) const noexcept
+{
+	return (int)(std::lower_bound(timestamps.begin(), timestamps.end(), ticks) - timestamps.begin());
+}
+
+juce::Range<int> HiseMidiSequence::EventIndex::getEventRange(Range<double> tickRange) const noexcept
+{
+	auto start = getNextIndexAtTime(tickRange.getStart());
+	auto end = (int)(std::lower_bound(timestamps.begin() + start, timestamps.end(), tickRange.getEnd()) - timestamps.begin());
+
+	return { start, end };
+}
+
+int HiseMidiSequence::EventIndex::getNoteOffIndex(int eventIndex) const noexcept
+{
+	if (isPositiveAndBelow(eventIndex, noteOffIndexes.size()))
+		return noteOffIndexes[eventIndex];
+
+	return -1;
+}
+
 HiseMidiSequence::HiseMidiSequence()
 {
 
@@ -135,9 +202,14 @@ juce::MidiMessage* HiseMidiSequence::getNextEvent(Range<double> rangeToLookForTi
 
 	auto nextIndex = lastPlayedIndex + 1;
 
-	if (auto seq = getReadPointer(currentTrackIndex))
+	auto seq = getReadPointer(currentTrackIndex);
+	auto index = eventIndexes[currentTrackIndex];
+
+	if (seq != nullptr && index != nullptr)
 	{
-		if (nextIndex >= seq->getNumEvents())
+		const int numEvents = index->getNumEvents();
+
+		if (nextIndex >= numEvents)
 		{
 			lastPlayedIndex = -1;
 			nextIndex = 0;
@@ -156,19 +228,14 @@ juce::MidiMessage* HiseMidiSequence::getNextEvent(Range<double> rangeToLookForTi
 			Range<double> beforeWrap = { rangeToLookForTicks.getStart(), loopEndTicks };
 			Range<double> afterWrap = { loopStartTicks, rangeEndAfterWrap };
 
-			if (auto nextEvent = seq->getEventPointer(nextIndex))
+			if (nextIndex < numEvents)
 			{
-				auto ts = nextEvent->message.getTimeStamp();
+				auto ts = index->getTimestamp(nextIndex);
 
-				if (beforeWrap.contains(ts))
+				if (beforeWrap.contains(ts) || afterWrap.contains(ts))
 				{
 					lastPlayedIndex = nextIndex;
-					return &nextEvent->message;
-				}
-				if (afterWrap.contains(ts))
-				{
-					lastPlayedIndex = nextIndex;
-					return &nextEvent->message;
+					return &seq->getEventPointer(nextIndex)->message;
 				}
 
 				// We don't want to wrap around notes that lie within the loop range.
@@ -176,39 +243,23 @@ juce::MidiMessage* HiseMidiSequence::getNextEvent(Range<double> rangeToLookForTi
 					return nullptr;
 			}
 
-			auto indexAfterWrap = seq->getNextIndexAtTime(loopStartTicks);
-
-			if (auto afterEvent = seq->getEventPointer(indexAfterWrap))
-			{
-				while (afterEvent != nullptr && afterEvent->message.isNoteOff())
-				{
-					indexAfterWrap++;
-
-					afterEvent = seq->getEventPointer(indexAfterWrap);
-				}
-
-				if (afterEvent != nullptr && !afterEvent->message.isNoteOff())
-				{
-					auto ts = afterEvent->message.getTimeStamp();
+			auto indexAfterWrap = index->getNextIndexAtTime(loopStartTicks);
 
-					if (afterWrap.contains(ts))
-					{
-						lastPlayedIndex = indexAfterWrap;
+			while (indexAfterWrap < numEvents && index->isNoteOff(indexAfterWrap))
+				indexAfterWrap++;
 
-						return &afterEvent->message;
-					}
-				}
+			if (indexAfterWrap < numEvents && afterWrap.contains(index->getTimestamp(indexAfterWrap)))
+			{
+				lastPlayedIndex = indexAfterWrap;
+				return &seq->getEventPointer(indexAfterWrap)->message;
 			}
 		}
 		else
 		{
-			if (auto nextEvent = seq->getEventPointer(nextIndex))
+			if (nextIndex < numEvents && rangeToLookForTicks.contains(index->getTimestamp(nextIndex)))
 			{
-				if (rangeToLookForTicks.contains(nextEvent->message.getTimeStamp()))
-				{
-					lastPlayedIndex = nextIndex;
-					return &nextEvent->message;
-				}
+				lastPlayedIndex = nextIndex;
+				return &seq->getEventPointer(nextIndex)->message;
 			}
 		}
 	}
@@ -218,8 +269,11 @@ juce::MidiMessage* HiseMidiSequence::getNextEvent(Range<double> rangeToLookForTi
 
 juce::MidiMessage* HiseMidiSequence::getMatchingNoteOffForCurrentEvent()
 {
-	if (auto noteOff = getReadPointer(currentTrackIndex)->getEventPointer(lastPlayedIndex)->noteOffObject)
-		return &noteOff->message;
+	if (auto index = eventIndexes[currentTrackIndex])
+	{
+		if (auto noteOff = getReadPointer(currentTrackIndex)->getEventPointer(index->getNoteOffIndex(lastPlayedIndex)))
+			return &noteOff->message;
+	}
 
 	return nullptr;
 }
@@ -296,6 +350,7 @@ void HiseMidiSequence::setLengthFromTimeSignature(TimeSignature s)
 void HiseMidiSequence::loadFrom(const MidiFile& file)
 {
 	OwnedArray<MidiMessageSequence> newSequences;
+	OwnedArray<EventIndex> newIndexes;
 
 	MidiFile normalisedFile;
 
@@ -347,22 +402,26 @@ void HiseMidiSequence::loadFrom(const MidiFile& file)
 	for (int i = 0; i < normalisedFile.getNumTracks(); i++)
 	{
 		ScopedPointer<MidiMessageSequence> newSequence = new MidiMessageSequence(*normalisedFile.getTrack(i));
+		newIndexes.add(new EventIndex())->rebuild(*newSequence);
 		newSequences.add(newSequence.release());
 	}
 
 	{
 		SimpleReadWriteLock::ScopedWriteLock sl(swapLock);
 		newSequences.swapWith(sequences);
+		newIndexes.swapWith(eventIndexes);
 	}
 }
 
 void HiseMidiSequence::createEmptyTrack()
 {
 	ScopedPointer<MidiMessageSequence> newTrack = new MidiMessageSequence();
+	ScopedPointer<EventIndex> newIndex = new EventIndex();
 
 	{
 		SimpleReadWriteLock::ScopedWriteLock sl(swapLock);
 		sequences.add(newTrack.release());
+		eventIndexes.add(newIndex.release());
 		currentTrackIndex = sequences.size() - 1;
 		lastPlayedIndex = -1;
 	}
@@ -413,6 +472,39 @@ juce::MidiMessageSequence* HiseMidiSequence::getWritePointer(int trackIndex)
 	return sequences[trackIndex];
 }
 
+void HiseMidiSequence::updateEventIndex(int trackIndex)
+{
+	if (trackIndex == -1)
+		trackIndex = currentTrackIndex;
+
+	if (auto seq = getReadPointer(trackIndex))
+	{
+		ScopedPointer<EventIndex> newIndex = new EventIndex();
+		newIndex->rebuild(*seq);
+
+		SimpleReadWriteLock::ScopedWriteLock sl(swapLock);
+		eventIndexes.set(trackIndex, newIndex.release(), true);
+	}
+}
+
+const HiseMidiSequence::EventIndex* HiseMidiSequence::getEventIndex(int trackIndex) const
+{
+	if (trackIndex == -1)
+		return eventIndexes[currentTrackIndex];
+
+	return eventIndexes[trackIndex];
+}
+
+juce::Range<int> HiseMidiSequence::getEventRange(Range<double> rangeInTicks) const
+{
+	SimpleReadWriteLock::ScopedReadLock sl(swapLock);
+
+	if (auto index = eventIndexes[currentTrackIndex])
+		return index->getEventRange(rangeInTicks);
+
+	return {};
+}
+
 int HiseMidiSequence::getNumEvents() const
 {
 	if(isPositiveAndBelow(currentTrackIndex, sequences.size()))
@@ -430,12 +522,12 @@ void HiseMidiSequence::setCurrentTrackIndex(int index)
 		SimpleReadWriteLock::ScopedReadLock sl(swapLock);
 
 		if (lastPlayedIndex != -1)
-			lastTimestamp = getReadPointer(currentTrackIndex)->getEventPointer(lastPlayedIndex)->message.getTimeStamp();
+			lastTimestamp = eventIndexes[currentTrackIndex]->getTimestamp(lastPlayedIndex);
 
 		currentTrackIndex = jlimit<int>(0, sequences.size()-1, index);
 
 		if (lastPlayedIndex != -1)
-			lastPlayedIndex = getReadPointer(currentTrackIndex)->getNextIndexAtTime(lastTimestamp);
+			lastPlayedIndex = eventIndexes[currentTrackIndex]->getNextIndexAtTime(lastTimestamp);
 	}
 }
 
@@ -444,9 +536,12 @@ void HiseMidiSequence::trimInactiveTracks()
 	SimpleReadWriteLock::ScopedWriteLock sl(swapLock);
 
 	auto seqToKeep = sequences.removeAndReturn(currentTrackIndex);
+	auto indexToKeep = eventIndexes.removeAndReturn(currentTrackIndex);
 
 	sequences.clear(true);
 	sequences.add(seqToKeep);
+	eventIndexes.clear(true);
+	eventIndexes.add(indexToKeep);
 	currentTrackIndex = 0;
 	resetPlayback();
 }
@@ -460,11 +555,11 @@ void HiseMidiSequence::setPlaybackPosition(double normalisedPosition)
 {
 	SimpleReadWriteLock::ScopedReadLock sl(swapLock);
 
-	if (auto s = getReadPointer(currentTrackIndex))
+	if (auto index = eventIndexes[currentTrackIndex])
 	{
 		auto currentTimestamp = getLength() * normalisedPosition;
 
-		lastPlayedIndex = s->getNextIndexAtTime(currentTimestamp) - 1;
+		lastPlayedIndex = index->getNextIndexAtTime(currentTimestamp) - 1;
 	}
 }
 
@@ -604,8 +699,12 @@ Array<HiseEvent> HiseMidiSequence::getEventList(double sampleRate, double bpm, H
 
 void HiseMidiSequence::swapCurrentSequence(MidiMessageSequence* sequenceToSwap)
 {
+	ScopedPointer<EventIndex> newIndex = new EventIndex();
+	newIndex->rebuild(*sequenceToSwap);
+
 	SimpleReadWriteLock::ScopedWriteLock sl(swapLock);
 	sequences.set(currentTrackIndex, sequenceToSwap, true);
+	eventIndexes.set(currentTrackIndex, newIndex.release(), true);
 }
 
 
@@ -2224,4 +2323,211 @@ bool MidiPlayer::Updater::handleUpdate(HiseMidiSequence::Ptr seq, NotificationTy
 	}
 }
 
+#if HI_RUN_UNIT_TESTS
+
+class MidiSequenceBenchmark : public UnitTest
+{
+public:
+
+	MidiSequenceBenchmark() :
+		UnitTest("MIDI sequence playback benchmark", "benchmark")
+	{}
+
+	void runTest() override
+	{
+		auto seq = createSequence(NumNotes);
+
+		testEventIndex(*seq);
+		testSeeking(*seq);
+		testLooping(*seq);
+	}
+
+private:
+
+	static constexpr int NumNotes = 50000;
+	static constexpr double TicksPerBlock = 22.3; // 512 samples at 44.1kHz / 120BPM
+
+	HiseMidiSequence::Ptr createSequence(int numNotes)
+	{
+		Random r(42);
+		MidiMessageSequence track;
+
+		for (int i = 0; i < numNotes; i++)
+		{
+			auto channel = r.nextInt(16) + 1;
+			auto note = r.nextInt(128);
+			auto start = (double)(i * 48);
+			auto length = (double)(96 + r.nextInt(384));
+
+			track.addEvent(MidiMessage::noteOn(channel, note, (uint8)100), start);
+			track.addEvent(MidiMessage::noteOff(channel, note), start + length);
+		}
+
+		track.updateMatchedPairs();
+
+		MidiFile file;
+		file.setTicksPerQuarterNote(HiseMidiSequence::TicksPerQuarter);
+		file.addTrack(track);
+
+		HiseMidiSequence::Ptr seq = new HiseMidiSequence();
+		seq->loadFrom(file);
+		return seq;
+	}
+
+	void testEventIndex(HiseMidiSequence& seq)
+	{
+		beginTest("Test event index");
+
+		auto mSeq = seq.getReadPointer();
+		auto index = seq.getEventIndex();
+
+		expectEquals(index->getNumEvents(), mSeq->getNumEvents(), "event count mismatch");
+
+		Random r;
+		auto length = seq.getLength();
+
+		for (int i = 0; i < 1000; i++)
+		{
+			auto ticks = r.nextDouble() * length;
+			expectEquals(index->getNextIndexAtTime(ticks), mSeq->getNextIndexAtTime(ticks), "seek mismatch");
+
+			auto range = index->getEventRange({ ticks, ticks + TicksPerBlock });
+
+			for (int j = range.getStart(); j < range.getEnd(); j++)
+				expect(Range<double>(ticks, ticks + TicksPerBlock).contains(mSeq->getEventPointer(j)->message.getTimeStamp()), "event not in range");
+		}
+
+		int numNoteOns = 0;
+
+		for (int i = 0; i < mSeq->getNumEvents() && numNoteOns < 2000; i++)
+		{
+			if (mSeq->getEventPointer(i)->message.isNoteOn())
+			{
+				expectEquals(index->getNoteOffIndex(i), mSeq->getIndexOfMatchingKeyUp(i), "note off mismatch");
+				numNoteOns++;
+			}
+		}
+	}
+
+	static int renderBlock(HiseMidiSequence& seq, Range<double> range)
+	{
+		int numEvents = 0;
+
+		// The MidiPlayer limits the events per block as well
+		while (numEvents < 128)
+		{
+			auto e = seq.getNextEvent(range);
+
+			if (e == nullptr)
+				break;
+
+			if (e->isNoteOn())
+				seq.getMatchingNoteOffForCurrentEvent();
+
+			numEvents++;
+		}
+
+		return numEvents;
+	}
+
+	void testSeeking(HiseMidiSequence& seq)
+	{
+		beginTest("Test seek-heavy playback");
+
+		Random r;
+		auto length = seq.getLength();
+		const int numSeeks = 10000;
+
+		int numEvents = 0;
+		auto start = Time::getMillisecondCounterHiRes();
+
+		for (int i = 0; i < numSeeks; i++)
+		{
+			auto pos = r.nextDouble() * 0.99;
+			seq.setPlaybackPosition(pos);
+
+			auto ticks = pos * length;
+			
+			for (int b = 0; b < 4; b++)
+				numEvents += renderBlock(seq, { ticks + b * TicksPerBlock, ticks + (b + 1) * TicksPerBlock });
+		}
+
+		auto indexedMs = Time::getMillisecondCounterHiRes() - start;
+
+		// Compare with the linear search that was used before
+		auto mSeq = seq.getReadPointer();
+		int dummy = 0;
+
+		start = Time::getMillisecondCounterHiRes();
+
+		for (int i = 0; i < numSeeks; i++)
+			dummy += mSeq->getNextIndexAtTime(r.nextDouble() * 0.99 * length);
+
+		auto linearMs = Time::getMillisecondCounterHiRes() - start;
+
+		expect(numEvents > 0 && dummy > 0, "no events played");
+
+		String message;
+		message << String(mSeq->getNumEvents()) << " events, " << String(numSeeks) << " seeks: ";
+		message << String(indexedMs, 2) << " ms (" << String(numEvents) << " events played), ";
+		message << "linear seek only: " << String(linearMs, 2) << " ms";
+		logMessage(message);
+	}
+
+	void testLooping(HiseMidiSequence& seq)
+	{
+		beginTest("Test loop-heavy playback");
+
+		Random r;
+		auto length = seq.getLength();
+		auto signature = seq.getTimeSignaturePtr();
+		auto originalLoopRange = signature->normalisedLoopRange;
+
+		const int numBlocks = 100000;
+		int numEvents = 0;
+
+		double position = 0.0;
+		Range<double> loopTicks;
+
+		auto start = Time::getMillisecondCounterHiRes();
+
+		for (int b = 0; b < numBlocks; b++)
+		{
+			// change the loop range every 32 blocks like a host transport would do
+			if (b % 32 == 0)
+			{
+				auto loopStart = r.nextDouble() * 0.9;
+				signature->normalisedLoopRange = { loopStart, loopStart + 0.0001 + r.nextDouble() * 0.01 };
+				loopTicks = { signature->normalisedLoopRange.getStart() * length, signature->normalisedLoopRange.getEnd() * length };
+
+				position = loopTicks.getStart();
+				seq.setPlaybackPosition(signature->normalisedLoopRange.getStart());
+			}
+
+			numEvents += renderBlock(seq, { position, position + TicksPerBlock });
+
+			position += TicksPerBlock;
+
+			if (position >= loopTicks.getEnd())
+				position -= loopTicks.getLength();
+		}
+
+		auto ms = Time::getMillisecondCounterHiRes() - start;
+
+		signature->normalisedLoopRange = originalLoopRange;
+		seq.resetPlayback();
+
+		expect(numEvents > 0, "no events played");
+
+		String message;
+		message << String(numBlocks) << " blocks with loop range changes: " << String(ms, 2) << " ms (";
+		message << String(numEvents) << " events played)";
+		logMessage(message);
+	}
+};
+
+static MidiSequenceBenchmark midiSequenceBenchmark;
+
+#endif
+
 }
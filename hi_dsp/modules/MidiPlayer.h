@@ -134,6 +134,41 @@ public:
 
 	};
 
+	/** A tick-sorted index of the events in a track.
+
+		It stores the timestamps and the note-on / note-off pairs in flat arrays, so seeking and
+		block range queries are binary searches and the playback doesn't have to walk through the 
+		MidiEventHolder objects. The index is rebuilt whenever a track is loaded or swapped.
+	*/
+	struct EventIndex
+	{
+		/** Rebuilds the index from the given sequence. This allocates, so don't call it in the audio thread. */
+		void rebuild(const MidiMessageSequence& seq);
+
+		/** Returns the index of the first event with a timestamp at or after the given tick position. */
+		int getNextIndexAtTime(double ticks) const noexcept;
+
+		/** Returns the index range of all events within the given tick range. */
+		Range<int> getEventRange(Range<double> tickRange) const noexcept;
+
+		/** Returns the index of the note-off event that belongs to the note-on event at the given index (or -1). */
+		int getNoteOffIndex(int eventIndex) const noexcept;
+
+		/** Checks whether the event at the given index is a note-off event. */
+		bool isNoteOff(int eventIndex) const noexcept { return isPositiveAndBelow(eventIndex, noteOffFlags.size()) && noteOffFlags[eventIndex] != 0; }
+
+		/** Returns the timestamp in ticks of the event at the given index. */
+		double getTimestamp(int eventIndex) const noexcept { return timestamps[eventIndex]; }
+
+		int getNumEvents() const noexcept { return timestamps.size(); }
+
+	private:
+
+		Array<double> timestamps;
+		Array<int> noteOffIndexes;
+		Array<uint8> noteOffFlags;
+	};
+
 	/** The internal resolution (set to a sensible high default). */
 	static constexpr int TicksPerQuarter = 960;
 
@@ -209,10 +244,23 @@ public:
 
 	/** Returns a write pointer to the given track.
 
-	If the argument is omitted, it will return the current track. 
+	If the argument is omitted, it will return the current track. If you change the events, call 
+	updateEventIndex() afterwards.
 	*/
 	juce::MidiMessageSequence* getWritePointer(int trackIndex=-1);
 
+	/** Rebuilds the event index of the given track after it was modified through getWritePointer(). */
+	void updateEventIndex(int trackIndex=-1);
+
+	/** Returns the event index of the given track. */
+	const EventIndex* getEventIndex(int trackIndex=-1) const;
+
+	/** Returns the index range of the events in the current track within the given tick range. 
+	
+		This is a binary search in the event index and can be used in the audio thread.
+	*/
+	Range<int> getEventRange(Range<double> rangeInTicks) const;
+
 	/** Get the number of events in the current track. */
 	int getNumEvents() const;
 
@@ -269,6 +317,7 @@ private:
 
 	Identifier id;
 	OwnedArray<MidiMessageSequence> sequences;
+	OwnedArray<EventIndex> eventIndexes;
 	int currentTrackIndex = 0;
 	int lastPlayedIndex = -1;
 
@@ -177,6 +177,8 @@ public:
 
 	SET_PROCESSOR_NAME("MidiProcessorChain", "Midi Processor Chain", "chain");
 
+	bool canBeProcessedConcurrently() const override { return true; }
+
 	MidiProcessorChain(MainController *m, const String &id, Processor *ownerProcessor);
 
 	~MidiProcessorChain()
@@ -214,7 +214,103 @@ void ModulatorChain::ModChainWithBuffer::prepareToPlay(double sampleRate, int sa
 	c->prepareToPlay(sampleRate, samplesPerBlock);
 
 	if (type == Type::Normal)
+	{
 		modBuffer.setMaxSize(samplesPerBlock);
+
+		if (samplesPerBlock > maxSamplesPerBlock)
+		{
+			maxSamplesPerBlock = samplesPerBlock;
+
+			if (numVoiceSnapshots != 0)
+				setNumVoiceSnapshots(numVoiceSnapshots);
+		}
+	}
+}
+
+void ModulatorChain::ModChainWithBuffer::setNumVoiceSnapshots(int numVoices)
+{
+	if (numVoices == 0 || type != Type::Normal)
+	{
+		voiceSnapshots.free();
+		voiceSnapshotData.free();
+		numVoiceSnapshots = 0;
+		return;
+	}
+
+	// Pad each snapshot to the SIMD alignment so that the data has the same alignment as the modulation buffer
+	const int alignment = (int)dsp::SIMDRegister<float>::SIMDNumElements;
+	const int stride = ((maxSamplesPerBlock + alignment - 1) / alignment) * alignment;
+
+	voiceSnapshotData.calloc(stride * numVoices + alignment);
+	voiceSnapshots.calloc(numVoices);
+
+	auto start = dsp::SIMDRegister<float>::getNextSIMDAlignedPtr(voiceSnapshotData.get());
+
+	for (int i = 0; i < numVoices; i++)
+	{
+		voiceSnapshots[i].data = start + i * stride;
+		voiceSnapshots[i].hasData = false;
+		voiceSnapshots[i].constantValue = c->getInitialValue();
+	}
+
+	numVoiceSnapshots = numVoices;
+}
+
+void ModulatorChain::ModChainWithBuffer::storeVoiceSnapshot(int voiceIndex, int startSample, int numSamples, const float* overrideData)
+{
+	if (!isPositiveAndBelow(voiceIndex, numVoiceSnapshots))
+		return;
+
+	auto& s = voiceSnapshots[voiceIndex];
+
+	auto source = overrideData != nullptr ? overrideData : currentVoiceData;
+
+	s.constantValue = currentConstantValue;
+	s.hasData = source != nullptr;
+
+	if (s.hasData)
+	{
+		if (!options.expandToAudioRate && overrideData == nullptr)
+		{
+			startSample /= HISE_CONTROL_RATE_DOWNSAMPLING_FACTOR;
+			numSamples = numSamples / HISE_CONTROL_RATE_DOWNSAMPLING_FACTOR + 1;
+		}
+
+		numSamples = jmin(numSamples, maxSamplesPerBlock - startSample);
+
+		if (numSamples > 0)
+			FloatVectorOperations::copy(s.data + startSample, source + startSample, numSamples);
+	}
+}
+
+int& ModulatorChain::ModChainWithBuffer::getCurrentSnapshotVoiceIndex() noexcept
+{
+	static thread_local int voiceIndex = -1;
+	return voiceIndex;
+}
+
+const ModulatorChain::ModChainWithBuffer::VoiceSnapshot* ModulatorChain::ModChainWithBuffer::getCurrentVoiceSnapshot() const noexcept
+{
+	if (numVoiceSnapshots == 0)
+		return nullptr;
+
+	auto voiceIndex = getCurrentSnapshotVoiceIndex();
+
+	if (isPositiveAndBelow(voiceIndex, numVoiceSnapshots))
+		return voiceSnapshots + voiceIndex;
+
+	return nullptr;
+}
+
+ModulatorChain::ModChainWithBuffer::ScopedVoiceSnapshot::ScopedVoiceSnapshot(int voiceIndex):
+	previousVoiceIndex(getCurrentSnapshotVoiceIndex())
+{
+	getCurrentSnapshotVoiceIndex() = voiceIndex;
+}
+
+ModulatorChain::ModChainWithBuffer::ScopedVoiceSnapshot::~ScopedVoiceSnapshot()
+{
+	getCurrentSnapshotVoiceIndex() = previousVoiceIndex;
 }
 
 void ModulatorChain::ModChainWithBuffer::handleHiseEvent(const HiseEvent& m)
@@ -524,6 +620,9 @@ void ModulatorChain::ModChainWithBuffer::applyMonophonicModulationValues(AudioSa
 
 const float* ModulatorChain::ModChainWithBuffer::getReadPointerForVoiceValues(int startSample) const
 {
+	if (auto s = getCurrentVoiceSnapshot())
+		return s->hasData ? s->data + startSample : nullptr;
+
 	// You need to expand the modulation values to audio rate before calling this method.
 	// Either call setExpandAudioRate(true) in the constructor, or manually expand them
 	jassert(currentVoiceData == nullptr || polyExpandChecker);
@@ -535,6 +634,9 @@ float* ModulatorChain::ModChainWithBuffer::getWritePointerForVoiceValues(int sta
 {
 	jassert(!options.voiceValuesReadOnly);
 
+	if (auto s = getCurrentVoiceSnapshot())
+		return s->hasData ? s->data + startSample : nullptr;
+
 	// You need to expand the modulation values to audio rate before calling this method.
 	// Either call setExpandAudioRate(true) in the constructor, or manually expand them
 	jassert(currentVoiceData == nullptr || polyExpandChecker);
@@ -572,6 +674,9 @@ const float* ModulatorChain::ModChainWithBuffer::getMonophonicModulationValues(i
 
 float ModulatorChain::ModChainWithBuffer::getConstantModulationValue() const
 {
+	if (auto s = getCurrentVoiceSnapshot())
+		return s->constantValue;
+
 	return currentConstantValue;
 }
 
@@ -580,6 +685,14 @@ float ModulatorChain::ModChainWithBuffer::getOneModulationValue(int startSample)
 	// If you set this, you probably don't need this method...
 	jassert(!options.expandToAudioRate);
 
+	if (auto s = getCurrentVoiceSnapshot())
+	{
+		if (!s->hasData)
+			return s->constantValue;
+
+		return s->data[startSample / HISE_CONTROL_RATE_DOWNSAMPLING_FACTOR];
+	}
+
 	if (currentVoiceData == nullptr)
 		return getConstantModulationValue();
 
@@ -276,8 +276,44 @@ public:
 
 		void setDisplayValue(float v);
 
+		/** Allocates the storage for the voice snapshots (or frees it if numVoices is zero).
+		*
+		*	The voice snapshots are used when the voices are rendered in parallel: the modulation values are calculated
+		*	for each voice on the audio thread and copied into the snapshot of the voice so that the voice rendering can
+		*	access them from another thread.
+		*/
+		void setNumVoiceSnapshots(int numVoices);
+
+		/** Copies the current voice modulation values into the snapshot of the given voice.
+		*
+		*	If overrideData is not nullptr, it will be used instead of the voice modulation values (with the same offset).
+		*/
+		void storeVoiceSnapshot(int voiceIndex, int startSample, int numSamples, const float* overrideData=nullptr);
+
+		/** Makes all ModChainWithBuffer objects return the snapshot data of the given voice on the current thread. */
+		struct ScopedVoiceSnapshot
+		{
+			ScopedVoiceSnapshot(int voiceIndex);
+			~ScopedVoiceSnapshot();
+
+		private:
+
+			const int previousVoiceIndex;
+		};
+
 	private:
 
+		struct VoiceSnapshot
+		{
+			float* data = nullptr;
+			bool hasData = false;
+			float constantValue = 1.0f;
+		};
+
+		static int& getCurrentSnapshotVoiceIndex() noexcept;
+
+		const VoiceSnapshot* getCurrentVoiceSnapshot() const noexcept;
+
 		void applyMonophonicValuesToVoiceInternal(float* voiceBuffer, float* monoBuffer, int numSamples);
 
 		void setDisplayValueInternal(int voiceIndex, int startSample, int numSamples);
@@ -314,6 +350,11 @@ public:
 		float currentMonophonicRampValue;
 		float const* currentVoiceData = nullptr;
 
+		int maxSamplesPerBlock = 0;
+		int numVoiceSnapshots = 0;
+		HeapBlock<VoiceSnapshot> voiceSnapshots;
+		HeapBlock<float> voiceSnapshotData;
+
 		JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ModChainWithBuffer);
 	};
 
@@ -322,6 +363,8 @@ public:
 	
 	SET_PROCESSOR_NAME("ModulatorChain", "Modulator Chain", "chain")
 
+	bool canBeProcessedConcurrently() const override { return true; }
+
 	class ModulatorChainHandler;
 
 	/** Creates a new modulator chain. You have to specify the voice amount and the Modulation::Mode */
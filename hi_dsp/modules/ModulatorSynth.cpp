@@ -129,6 +129,9 @@ ValueTree ModulatorSynth::exportAsValueTree() const
 
 	v.setProperty("IconColour", iconColour.toString(), nullptr);
 
+	if (useParallelVoiceRendering)
+		v.setProperty("ParallelVoiceRendering", true, nullptr);
+
 	return v;
 }
 
@@ -143,6 +146,8 @@ void ModulatorSynth::restoreFromValueTree(const ValueTree &v)
 
 	iconColour = Colour::fromString(v.getProperty("IconColour", Colours::transparentBlack.toString()).toString());
 
+	setUseParallelVoiceRendering(v.getProperty("ParallelVoiceRendering", false));
+
 	Processor::restoreFromValueTree(v);
 }
 
@@ -341,6 +346,26 @@ void ModulatorSynth::processHiseEventBuffer(const HiseEventBuffer &inputBuffer,
 	eventBuffer.alignEventsToRaster<HISE_EVENT_RASTER>(numSamples);
 }
 
+void ModulatorSynth::preprocessHiseEventBuffer(const HiseEventBuffer &inputBuffer, int numSamples)
+{
+	processHiseEventBuffer(inputBuffer, numSamples);
+	eventBufferPreprocessed = true;
+}
+
+void ModulatorSynth::updateCpuUsage(double renderTimeInSeconds, int numSamples)
+{
+	if (numSamples == 0)
+		return;
+
+	const float thisUsage = 100.0f * (float)(renderTimeInSeconds * getSampleRate() / (double)numSamples);
+	const float lastUsage = cpuUsage.load();
+
+	if (thisUsage > lastUsage)
+		cpuUsage.store(thisUsage);
+	else
+		cpuUsage.store(lastUsage * 0.99f);
+}
+
 void ModulatorSynth::addProcessorsWhenEmpty()
 {
 	LockHelpers::freeToGo(getMainController());
@@ -372,6 +397,7 @@ void ModulatorSynth::renderNextBlockWithModulators(AudioSampleBuffer& outputBuff
 	jassert(isOnAir());
 
     ADD_GLITCH_DETECTOR(this, DebugLogger::Location::SynthRendering);
+	ADD_AUDIO_PROFILER_SCOPE(this, DebugLogger::Location::SynthRendering);
     
 	int numSamples = outputBuffer.getNumSamples();
 
@@ -385,9 +411,10 @@ void ModulatorSynth::renderNextBlockWithModulators(AudioSampleBuffer& outputBuff
 	
 	initRenderCallback();
 
-	processHiseEventBuffer(inputMidiBuffer, numSamplesFixed);
-
-	
+	if (eventBufferPreprocessed)
+		eventBufferPreprocessed = false;
+	else
+		processHiseEventBuffer(inputMidiBuffer, numSamplesFixed);
 
 	HiseEventBuffer::Iterator eventIterator(eventBuffer);
 
@@ -460,8 +487,12 @@ void ModulatorSynth::renderNextBlockWithModulators(AudioSampleBuffer& outputBuff
 
 void ModulatorSynth::preVoiceRendering(int startSample, int numThisTime)
 {
-	for (auto& mb : modChains)
-		mb.calculateMonophonicModulationValues(startSample, numThisTime);
+	{
+		ADD_AUDIO_PROFILER_SCOPE(this, DebugLogger::Location::ModulatorChainTimeVariantRendering);
+
+		for (auto& mb : modChains)
+			mb.calculateMonophonicModulationValues(startSample, numThisTime);
+	}
 
 	effectChain->preRenderCallback(startSample, numThisTime);
 }
@@ -469,20 +500,144 @@ void ModulatorSynth::preVoiceRendering(int startSample, int numThisTime)
 void ModulatorSynth::renderVoice(int startSample, int numThisTime)
 {
     ADD_GLITCH_DETECTOR(this, DebugLogger::Location::SynthVoiceRendering);
+	ADD_AUDIO_PROFILER_SCOPE(this, DebugLogger::Location::SynthVoiceRendering);
     
 	clearPendingRemoveVoices();
 
+	if (canRenderVoicesInParallel())
+	{
+		renderVoicesInParallel(startSample, numThisTime);
+	}
+	else
+	{
+		for (auto v : activeVoices)
+		{
+			jassert(!v->isInactive());
+
+			{
+				ADD_AUDIO_PROFILER_VOICE_SCOPE(this, DebugLogger::Location::ModulatorChainVoiceRendering, v->getVoiceIndex());
+				calculateModulationValuesForVoice(v, startSample, numThisTime);
+			}
+
+			ADD_AUDIO_PROFILER_VOICE_SCOPE(this, DebugLogger::Location::SynthVoiceRendering, v->getVoiceIndex());
+			v->renderNextBlock(internalBuffer, startSample, numThisTime);
+		}
+	}
+
+	clearPendingRemoveVoices();
+};
+
+struct ModulatorSynth::ParallelVoiceJob : public RealtimeWorkerPool::Job
+{
+	ParallelVoiceJob(ModulatorSynth& s_, int startSample_, int numSamples_) :
+		s(s_),
+		startSample(startSample_),
+		numSamples(numSamples_)
+	{}
+
+	void processTask(int taskIndex, int threadIndex) override
+	{
+		auto v = s.activeVoices.begin()[taskIndex];
+
+		ADD_AUDIO_PROFILER_VOICE_SCOPE(&s, DebugLogger::Location::SynthVoiceRendering, v->getVoiceIndex());
+
+		ModulatorChain::ModChainWithBuffer::ScopedVoiceSnapshot svs(v->getVoiceIndex());
+
+		s.prepareVoiceForParallelRendering(v, threadIndex);
+		v->renderVoiceBuffer(startSample, numSamples);
+	}
+
+	ModulatorSynth& s;
+	const int startSample;
+	const int numSamples;
+};
+
+void ModulatorSynth::renderVoicesInParallel(int startSample, int numThisTime)
+{
+	// The modulation chains use a single buffer for all voices, so we need to
+	// calculate them here and store a copy of the values for each voice...
 	for (auto v : activeVoices)
 	{
 		jassert(!v->isInactive());
 
+		const auto voiceIndex = v->getVoiceIndex();
+
+		ADD_AUDIO_PROFILER_VOICE_SCOPE(this, DebugLogger::Location::ModulatorChainVoiceRendering, voiceIndex);
+
 		calculateModulationValuesForVoice(v, startSample, numThisTime);
 
-		v->renderNextBlock(internalBuffer, startSample, numThisTime);
+		for (int i = 0; i < modChains.size(); i++)
+		{
+			const float* overrideData = nullptr;
+
+			if (i == BasicChains::PitchChain && useScratchBufferForArtificialPitch)
+				overrideData = modChains[i].getScratchBuffer();
+
+			modChains[i].storeVoiceSnapshot(voiceIndex, startSample, numThisTime, overrideData);
+		}
 	}
 
-	clearPendingRemoveVoices();
-};
+	ParallelVoiceJob job(*this, startSample, numThisTime);
+
+	renderingVoicesInParallel = true;
+	workerPool->processJob(job, activeVoices.size());
+	renderingVoicesInParallel = false;
+
+	// Add the voices in the order of the active voice list so that the result doesn't depend on the thread scheduling
+	for (auto v : activeVoices)
+	{
+		v->addVoiceBufferToOutput(internalBuffer, startSample, numThisTime);
+		v->applyPendingReset();
+		v->checkRelease();
+	}
+}
+
+bool ModulatorSynth::canRenderVoicesInParallel() const
+{
+	if (!useParallelVoiceRendering || workerPool == nullptr || workerPool->getNumWorkers() == 0)
+		return false;
+
+	if (activeVoices.size() < 2)
+		return false;
+
+	if (!supportsParallelVoiceRendering())
+		return false;
+
+	// The voice effects use the voice index to access their state from the audio thread
+	if (effectChain->hasActiveVoiceEffects())
+		return false;
+
+	return !getMainController()->getDebugLogger().isLogging();
+}
+
+void ModulatorSynth::setUseParallelVoiceRendering(bool shouldRenderVoicesInParallel)
+{
+	if (shouldRenderVoicesInParallel && HISE_NUM_REALTIME_WORKER_THREADS == 0)
+		shouldRenderVoicesInParallel = false;
+
+	if (shouldRenderVoicesInParallel == useParallelVoiceRendering)
+		return;
+
+	auto pool = shouldRenderVoicesInParallel ? getMainController()->getRealtimeWorkerPool() : nullptr;
+
+	LockHelpers::SafeLock sl(getMainController(), LockHelpers::AudioLock, isOnAir());
+
+	workerPool = pool;
+	useParallelVoiceRendering = shouldRenderVoicesInParallel;
+
+	updateParallelVoiceRendering();
+}
+
+void ModulatorSynth::updateParallelVoiceRendering()
+{
+	const int numSnapshots = useParallelVoiceRendering ? getNumVoices() : 0;
+
+	for (auto& mb : modChains)
+		mb.setNumVoiceSnapshots(numSnapshots);
+
+	if (useParallelVoiceRendering && workerPool != nullptr)
+		prepareParallelVoiceRendering(workerPool->getNumThreads());
+}
 
 	
 void ModulatorSynth::calculateModulationValuesForVoice(ModulatorSynthVoice * v, int startSample, int numThisTime)
@@ -832,6 +987,9 @@ void ModulatorSynth::prepareToPlay(double newSampleRate, int samplesPerBlock)
 		for (auto& mb : modChains)
 			mb.prepareToPlay(newSampleRate, samplesPerBlock);
 
+		if (useParallelVoiceRendering)
+			updateParallelVoiceRendering();
+
 		CHECK_COPY_AND_RETURN_12(effectChain);
 
 		effectChain->prepareToPlay(newSampleRate, samplesPerBlock);
@@ -1212,8 +1370,19 @@ const ModulatorSynth* ModulatorSynth::getPlayingSynth() const
 	return isInGroup() ? static_cast<const ModulatorSynth*>(getGroup()) : this;
 }
 
+bool ModulatorSynthVoice::deferResetIfRenderingInParallel()
+{
+	// The reset changes the modulation chains and the voice list of the synth, so
+	// it must be done on the audio thread after all voices are rendered.
+	pendingReset = getOwnerSynth()->isRenderingVoicesInParallel();
+	return pendingReset;
+}
+
 void ModulatorSynthVoice::resetVoice()
 {
+	if (deferResetIfRenderingInParallel())
+		return;
+
 	LOG_SYNTH_EVENT("Reset Note for " + getOwnerSynth()->getId() + " with index " + String(voiceIndex));
 
 	clearCurrentNote();
@@ -1697,6 +1866,8 @@ void ModulatorSynth::setVoiceLimit(int newVoiceLimit)
 	// The voice limit must be smaller than the total amount of voices!
 	//jassert(voices.size() == 0 || newVoiceLimit <= voices.size());
 
+	auto prevLimit = voiceLimit;
+
 	voiceLimit = jlimit<int>(2, NUM_POLYPHONIC_VOICES, newVoiceLimit);
 
 	// If the voice amount is less tha
@@ -1704,6 +1875,15 @@ void ModulatorSynth::setVoiceLimit(int newVoiceLimit)
 		internalVoiceLimit = jmax<int>(8, (int)(getMainController()->getVoiceAmountMultiplier() * (float)voiceLimit));
 	else
 		internalVoiceLimit = voiceLimit;
+
+	if (prevLimit != voiceLimit)
+	{
+		for (auto l : voiceLimitListeners)
+		{
+			if (l != nullptr)
+				l->voiceLimitChanged(voiceLimit);
+		}
+	}
 }
 
 void ModulatorSynth::setKillFadeOutTime(double fadeTimeMilliSeconds)
@@ -1724,33 +1904,42 @@ void ModulatorSynthVoice::renderNextBlock (AudioSampleBuffer& outputBuffer, int
 {
 	if (isActive)
     { 
-		calculateBlock(startSample, numSamples);
+		renderVoiceBuffer(startSample, numSamples);
 
-		if (gainFader.isSmoothing())
-		{
-			applyEventVolumeFade(startSample, numSamples);
-		}
-		else if (eventGainFactor != 1.0f)
-		{
-			applyEventVolumeFactor(startSample, numSamples);
-		}
+		addVoiceBufferToOutput(outputBuffer, startSample, numSamples);
 
-		if(killThisVoice)
-		{
-			applyKillFadeout(startSample, numSamples);
-		}
+		// checks if any envelopes are active and in their release state and calls stopNote until they are finished.
+		checkRelease();
+    }
+}
 
-		const int maxChannelAmount = jmin<int>(voiceBuffer.getNumChannels(), outputBuffer.getNumChannels());
+void ModulatorSynthVoice::renderVoiceBuffer(int startSample, int numSamples)
+{
+	calculateBlock(startSample, numSamples);
 
-		for (int i = 0; i < maxChannelAmount; i++)
-		{
-			FloatVectorOperations::add(outputBuffer.getWritePointer(i, startSample), voiceBuffer.getReadPointer(i, startSample), numSamples);
-		}
+	if (gainFader.isSmoothing())
+	{
+		applyEventVolumeFade(startSample, numSamples);
+	}
+	else if (eventGainFactor != 1.0f)
+	{
+		applyEventVolumeFactor(startSample, numSamples);
+	}
 
+	if(killThisVoice)
+	{
+		applyKillFadeout(startSample, numSamples);
+	}
+}
 
-		// checks if any envelopes are active and in their release state and calls stopNote until they are finished.
-		checkRelease();
-    }
+void ModulatorSynthVoice::addVoiceBufferToOutput(AudioSampleBuffer& outputBuffer, int startSample, int numSamples) const
+{
+	const int maxChannelAmount = jmin<int>(voiceBuffer.getNumChannels(), outputBuffer.getNumChannels());
+
+	for (int i = 0; i < maxChannelAmount; i++)
+	{
+		FloatVectorOperations::add(outputBuffer.getWritePointer(i, startSample), voiceBuffer.getReadPointer(i, startSample), numSamples);
+	}
 }
 
 void ModulatorSynthVoice::setCurrentHiseEvent(const HiseEvent &m)
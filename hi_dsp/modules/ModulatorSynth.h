@@ -114,6 +114,18 @@ public:
 		PitchChain = 1
 	};
 
+	/** Subclass from this and register it with addVoiceLimitListener() if a child processor needs to resize
+	    its voice data when the voice limit changes. */
+	struct VoiceLimitListener
+	{
+		virtual ~VoiceLimitListener() {};
+
+		/** Called synchronously from setVoiceLimit(). */
+		virtual void voiceLimitChanged(int newVoiceLimit) = 0;
+
+		JUCE_DECLARE_WEAK_REFERENCEABLE(VoiceLimitListener);
+	};
+
 	// ===================================================================================================================
 
 	ModulatorSynth(MainController *mc, const String &id, int numVoices);
@@ -173,6 +185,47 @@ public:
 
 	void clearPendingRemoveVoices();
 
+	// ===================================================================================================================
+
+	/** Enables the parallel rendering of the voices.
+	*
+	*	If enabled (and the synth type supports it), the modulation values are calculated for each voice on the audio thread
+	*	and the voices are rendered into their voice buffers on the RealtimeWorkerPool of the MainController. The voice buffers
+	*	are then added to the output in the order of the active voice list, so the result doesn't depend on the thread scheduling.
+	*/
+	void setUseParallelVoiceRendering(bool shouldRenderVoicesInParallel);
+
+	bool isUsingParallelVoiceRendering() const noexcept { return useParallelVoiceRendering; }
+
+	/** Returns true while the voices are rendered on the worker threads. */
+	bool isRenderingVoicesInParallel() const noexcept { return renderingVoicesInParallel; }
+
+	/** Override this and return true if the voices of this synth can be rendered concurrently.
+	*
+	*	This is the case if the voice rendering doesn't write into any data of the synth (other than the voice itself) and
+	*	only accesses the voice modulation values through the modulation chains of this synth.
+	*/
+	virtual bool supportsParallelVoiceRendering() const { return false; }
+
+	/** Checks whether the voices of this block can be rendered in parallel. */
+	bool canRenderVoicesInParallel() const;
+
+	/** Processes the incoming events (MIDI processors and synth timers) before the synth is rendered.
+	*
+	*	This is called by the ModulatorSynthChain on the audio thread before it renders the child synth on a worker thread so that
+	*	the scripts are never executed concurrently. The next call to renderNextBlockWithModulators() will skip the event processing.
+	*/
+	void preprocessHiseEventBuffer(const HiseEventBuffer &inputBuffer, int numSamples);
+
+	/** Returns the CPU usage of the last render callbacks in percent of the buffer duration.
+	*
+	*	This is measured by the ModulatorSynthChain for its child synths and uses the same peak decay as MainController::getCpuUsage().
+	*/
+	float getCpuUsage() const noexcept { return cpuUsage.load(); }
+
+	/** Updates the CPU usage with the time that was spent rendering the last block. */
+	void updateCpuUsage(double renderTimeInSeconds, int numSamples);
+
 	/** This method is called to handle all modulatorchains after the voice rendering and handles the GUI metering. It assumes stereo mode.
 	*
 	*	The rendered buffer is supplied as reference to be able to apply changes here after all voices are rendered (eg. gain).
@@ -268,6 +321,10 @@ public:
 
 	virtual void setVoiceLimit(int newVoiceLimit);
 
+	void addVoiceLimitListener(VoiceLimitListener* l) { voiceLimitListeners.addIfNotAlreadyThere(l); }
+
+	void removeVoiceLimitListener(VoiceLimitListener* l) { voiceLimitListeners.removeAllInstancesOf(l); }
+
 	void setKillFadeOutTime(double fadeTimeSeconds);
 
 		/** Checks if the message fits the sound, but can be overriden to implement other group start logic. */
@@ -393,7 +450,8 @@ public:
 	/** Returns a read pointer to the calculated pitch values. */
 	float *getPitchValuesForVoice() const 
 	{
-		if (useScratchBufferForArtificialPitch)
+		// The voice snapshot of the pitch chain already contains the artificial pitch values
+		if (useScratchBufferForArtificialPitch && !renderingVoicesInParallel)
 			return modChains[BasicChains::PitchChain].getScratchBuffer();
 		
 		return modChains[BasicChains::PitchChain].getWritePointerForVoiceValues(0);
@@ -418,6 +476,12 @@ public:
 		return modChains[BasicChains::PitchChain].getConstantModulationValue();
 	}
 
+	/** This will be called with the number of threads of the worker pool when the parallel rendering is enabled. Use this to preallocate scratch buffers for each thread. */
+	virtual void prepareParallelVoiceRendering(int /*numThreads*/) {}
+
+	/** This will be called before the voice is rendered on the thread with the given index (0 is the audio thread). */
+	virtual void prepareVoiceForParallelRendering(ModulatorSynthVoice* /*v*/, int /*threadIndex*/) {}
+
 	float getConstantGainModValue() const
 	{
 		return modChains[BasicChains::GainChain].getConstantModulationValue();
@@ -488,6 +552,21 @@ private:
 
 	VoiceStack pendingRemoveVoices;
 
+	struct ParallelVoiceJob;
+
+	void renderVoicesInParallel(int startSample, int numThisTime);
+
+	void updateParallelVoiceRendering();
+
+	RealtimeWorkerPool* workerPool = nullptr;
+	bool useParallelVoiceRendering = false;
+	bool renderingVoicesInParallel = false;
+
+	friend class ModulatorSynthChain;
+
+	bool eventBufferPreprocessed = false;
+	std::atomic<float> cpuUsage = { 0.0f };
+
 protected:
 
 	virtual bool synthNeedsEnvelope() const { return true; };
@@ -582,6 +661,8 @@ private:
 	std::atomic<bool> bypassState;
 
     bool anyTimerActive = false;
+
+	Array<WeakReference<VoiceLimitListener>> voiceLimitListeners;
     
 	// ===================================================================================================================
 
@@ -626,6 +707,12 @@ public:
                                   int startSample,
                                   int numSamples) override;
 
+	/** Renders the voice into the voice buffer (including the event volume and the kill fade). */
+	void renderVoiceBuffer(int startSample, int numSamples);
+
+	/** Adds the voice buffer to the given output buffer. */
+	void addVoiceBufferToOutput(AudioSampleBuffer& outputBuffer, int startSample, int numSamples) const;
+
 
 	virtual void calculateBlock(int startSample, int numSamples) = 0;
 	
@@ -709,6 +796,13 @@ public:
 
 	virtual void resetVoice();
 
+	/** Resets the voice if it was reset during the parallel voice rendering. */
+	void applyPendingReset()
+	{
+		if (pendingReset)
+			resetVoice();
+	}
+
 	bool isInactive() const noexcept
 	{
         return !isActive; //uptimeDelta == 0.0;
@@ -851,6 +945,9 @@ public:
 
 protected:
 
+	/** Call this at the beginning of resetVoice(). If the voices are rendered in parallel, it will defer the reset until all voices are rendered and return true. */
+	bool deferResetIfRenderingInParallel();
+
 	
 
 	/** Returns the ModulatorSynth instance that this voice belongs to.
@@ -903,7 +1000,7 @@ private:
 
 	bool isTailing;
 
-	
+	bool pendingReset = false;
 	
 	double startUptime;
 
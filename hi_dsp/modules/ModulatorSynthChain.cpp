@@ -120,6 +120,8 @@ void ModulatorSynthChain::prepareToPlay(double newSampleRate, int samplesPerBloc
 
 	for (auto s: synths)
 		s->prepareToPlay(newSampleRate, samplesPerBlock);
+
+	updateParallelChildBuffer();
 }
 
 void ModulatorSynthChain::numSourceChannelsChanged()
@@ -138,7 +140,11 @@ void ModulatorSynthChain::numSourceChannelsChanged()
 
 	ModulatorSynth::numSourceChannelsChanged();
 
-	
+	if (useParallelChildRendering)
+	{
+		LockHelpers::SafeLock sl(getMainController(), LockHelpers::AudioLock, isOnAir());
+		updateParallelChildBuffer();
+	}
 }
 
 void ModulatorSynthChain::numDestinationChannelsChanged()
@@ -151,6 +157,9 @@ ValueTree ModulatorSynthChain::exportAsValueTree() const
 {
 	ValueTree v = ModulatorSynth::exportAsValueTree();
 
+	if (useParallelChildRendering)
+		v.setProperty("ParallelChildRendering", true, nullptr);
+
 	if (this == getMainController()->getMainSynthChain())
 	{
 		v.setProperty("packageName", packageName, nullptr);
@@ -193,6 +202,7 @@ void ModulatorSynthChain::renderNextBlockWithModulators(AudioSampleBuffer &buffe
 	if (isSoftBypassed()) return;
 
 	ADD_GLITCH_DETECTOR(this, DebugLogger::Location::SynthChainRendering);
+	ADD_AUDIO_PROFILER_SCOPE(this, DebugLogger::Location::SynthChainRendering);
 
 	if (getMainController()->getMainSynthChain() == this && !activeChannels.areAllChannelsEnabled())
 	{
@@ -251,11 +261,7 @@ void ModulatorSynthChain::renderNextBlockWithModulators(AudioSampleBuffer &buffe
 #endif
 
 	// Process the Synths and add store their output in the internal buffer
-	for (int i = 0; i < synths.size(); i++)
-    {
-        if (!synths[i]->isSoftBypassed())
-            synths[i]->renderNextBlockWithModulators(internalBuffer, eventBuffer);
-    }
+	renderChildSynths(numSamples);
 
 	HiseEventBuffer::Iterator eventIterator(eventBuffer);
 
@@ -312,10 +318,184 @@ void ModulatorSynthChain::renderNextBlockWithModulators(AudioSampleBuffer &buffe
 }
 
 
+struct ModulatorSynthChain::ParallelChildJob : public RealtimeWorkerPool::Job
+{
+	ParallelChildJob(ModulatorSynthChain& c_, int numSamples_) :
+		c(c_),
+		numSamples(numSamples_)
+	{}
+
+	void processTask(int taskIndex, int /*threadIndex*/) override
+	{
+		ScopedNoDenormals snd;
+
+		const int numChannels = c.internalBuffer.getNumChannels();
+		auto channels = c.parallelChildBuffer.getArrayOfWritePointers() + taskIndex * numChannels;
+
+		AudioSampleBuffer childBuffer(channels, numChannels, numSamples);
+		childBuffer.clear();
+
+		c.renderChildSynth(c.parallelBatch[taskIndex], childBuffer);
+	}
+
+	ModulatorSynthChain& c;
+	const int numSamples;
+};
+
+void ModulatorSynthChain::renderChildSynths(int numSamples)
+{
+	if (!canRenderChildSynthsInParallel())
+	{
+		for (auto s : synths)
+		{
+			if (!s->isSoftBypassed())
+				renderChildSynth(s, internalBuffer);
+		}
+
+		return;
+	}
+
+	int i = 0;
+
+	while (i < synths.size())
+	{
+		parallelBatch.clearQuick();
+
+		// Collect all children until the next one that must be rendered on the audio thread
+		while (i < synths.size())
+		{
+			auto s = synths[i];
+
+			if (!s->isSoftBypassed())
+			{
+				if (!canBeRenderedConcurrently(s))
+					break;
+
+				parallelBatch.add(s);
+			}
+
+			i++;
+		}
+
+		renderParallelBatch(numSamples);
+
+		if (i < synths.size())
+			renderChildSynth(synths[i++], internalBuffer);
+	}
+
+	parallelBatch.clearQuick();
+}
+
+void ModulatorSynthChain::renderChildSynth(ModulatorSynth* s, AudioSampleBuffer& b)
+{
+	const auto startTicks = Time::getHighResolutionTicks();
+
+	s->renderNextBlockWithModulators(b, eventBuffer);
+
+	const auto renderTime = Time::highResolutionTicksToSeconds(Time::getHighResolutionTicks() - startTicks);
+	s->updateCpuUsage(renderTime, b.getNumSamples());
+}
+
+void ModulatorSynthChain::renderParallelBatch(int numSamples)
+{
+	const int numChannels = internalBuffer.getNumChannels();
+	const int numChildren = parallelBatch.size();
+
+	const bool bufferIsPrepared = parallelChildBuffer.getNumChannels() >= numChannels * numChildren &&
+								  parallelChildBuffer.getNumSamples() >= numSamples;
+
+	if (numChildren < 2 || !bufferIsPrepared)
+	{
+		for (auto s : parallelBatch)
+			renderChildSynth(s, internalBuffer);
+
+		return;
+	}
+
+	// The scripts of the MIDI processors must not run on the worker threads...
+	for (auto s : parallelBatch)
+		s->preprocessHiseEventBuffer(eventBuffer, numSamples);
+
+	ParallelChildJob job(*this, numSamples);
+	workerPool->processJob(job, numChildren);
+
+	// A purged sampler doesn't consume the preprocessed events
+	for (auto s : parallelBatch)
+		s->eventBufferPreprocessed = false;
+
+	// Add the child buffers in the order of the chain so that the result doesn't depend on the thread scheduling
+	for (int i = 0; i < numChildren; i++)
+	{
+		for (int c = 0; c < numChannels; c++)
+			internalBuffer.addFrom(c, 0, parallelChildBuffer, i * numChannels + c, 0, numSamples);
+	}
+}
+
+bool ModulatorSynthChain::canRenderChildSynthsInParallel() const
+{
+	if (!useParallelChildRendering || workerPool == nullptr || workerPool->getNumWorkers() == 0)
+		return false;
+
+	if (synths.size() < 2)
+		return false;
+
+	return !getMainController()->getDebugLogger().isLogging();
+}
+
+bool ModulatorSynthChain::canBeRenderedConcurrently(const Processor* p)
+{
+	if (!p->canBeProcessedConcurrently())
+		return false;
+
+	for (int i = 0; i < p->getNumChildProcessors(); i++)
+	{
+		if (auto c = p->getChildProcessor(i))
+		{
+			if (!canBeRenderedConcurrently(c))
+				return false;
+		}
+	}
+
+	return true;
+}
+
+void ModulatorSynthChain::setUseParallelChildRendering(bool shouldRenderChildrenInParallel)
+{
+	if (shouldRenderChildrenInParallel && HISE_NUM_REALTIME_WORKER_THREADS == 0)
+		shouldRenderChildrenInParallel = false;
+
+	if (shouldRenderChildrenInParallel == useParallelChildRendering)
+		return;
+
+	auto pool = shouldRenderChildrenInParallel ? getMainController()->getRealtimeWorkerPool() : nullptr;
+
+	LockHelpers::SafeLock sl(getMainController(), LockHelpers::AudioLock, isOnAir());
+
+	workerPool = pool;
+	useParallelChildRendering = shouldRenderChildrenInParallel;
+
+	updateParallelChildBuffer();
+}
+
+void ModulatorSynthChain::updateParallelChildBuffer()
+{
+	const int numSlots = useParallelChildRendering ? synths.size() : 0;
+	const int numChannels = getMatrix().getNumSourceChannels();
+
+	if (numSlots > 1 && getLargestBlockSize() > 0)
+		parallelChildBuffer.setSize(numChannels * numSlots, getLargestBlockSize(), false, false, true);
+	else
+		parallelChildBuffer.setSize(0, 0);
+
+	parallelBatch.ensureStorageAllocated(synths.size());
+}
+
 void ModulatorSynthChain::restoreFromValueTree(const ValueTree &v)
 {
 	packageName = v.getProperty("packageName", "");
 
+	setUseParallelChildRendering(v.getProperty("ParallelChildRendering", false));
+
 	ModulatorSynth::restoreFromValueTree(v);
 
 	if (!getMainController()->shouldSkipCompiling())
@@ -546,6 +726,7 @@ void ModulatorSynthChain::ModulatorSynthChainHandler::add(Processor *newProcesso
 		LOCK_PROCESSING_CHAIN(synth);
 		ms->setIsOnAir(synth->isOnAir());
 		synth->synths.insert(index, ms);
+		synth->updateParallelChildBuffer();
 	}
 
 	notifyListeners(Listener::ProcessorAdded, newProcessor);
@@ -561,6 +742,7 @@ void ModulatorSynthChain::ModulatorSynthChainHandler::remove(Processor *processo
 		LOCK_PROCESSING_CHAIN(synth);
 		processorToBeRemoved->setIsOnAir(false);
 		synth->synths.removeObject(dynamic_cast<ModulatorSynth*>(processorToBeRemoved), false);
+		synth->updateParallelChildBuffer();
 	}
 
 	if (removeSynth)
@@ -177,6 +177,22 @@ public:
 
 	int getVoiceAmount() const {return numVoices;};
 
+	/** Enables the parallel rendering of the child synths.
+	*
+	*	If enabled, the child synths that don't share any state with other processors are rendered on the RealtimeWorkerPool
+	*	of the MainController. Every child renders into its own buffer and the buffers are added to the output in the order
+	*	of the chain. A child that contains a processor which can't be processed concurrently (eg. a script processor)
+	*	is rendered on the audio thread between the parallel batches, so the order of the chain is kept as dependency order.
+	*
+	*	The incoming events of the parallel children (MIDI processors and synth timers) are always processed on the audio thread.
+	*/
+	void setUseParallelChildRendering(bool shouldRenderChildrenInParallel);
+
+	bool isUsingParallelChildRendering() const noexcept { return useParallelChildRendering; }
+
+	/** Returns true if the processor and all its child processors can be processed concurrently. */
+	static bool canBeRenderedConcurrently(const Processor* p);
+
 	int getNumActiveVoices() const override;
 
 	void killAllVoices() override;
@@ -231,6 +247,21 @@ public:
 
 private:
 
+	struct ParallelChildJob;
+
+	void renderChildSynths(int numSamples);
+	void renderChildSynth(ModulatorSynth* s, AudioSampleBuffer& b);
+	void renderParallelBatch(int numSamples);
+
+	bool canRenderChildSynthsInParallel() const;
+
+	void updateParallelChildBuffer();
+
+	RealtimeWorkerPool* workerPool = nullptr;
+	bool useParallelChildRendering = false;
+	AudioSampleBuffer parallelChildBuffer;
+	Array<ModulatorSynth*> parallelBatch;
+
 	HiseEvent::ChannelFilterData activeChannels;
 	ModulatorSynthChainHandler handler;
 	int numVoices;
@@ -161,11 +161,225 @@ double MultithreadedConvolver::getResampleFactor(double sampleRate, double impul
 	}
 }
 
+MultithreadedConvolver::WorkerPool::Worker::Worker(WorkerPool& p, int index) :
+	Thread("Convolution Worker " + String(index + 1)),
+	pool(p)
+{}
+
+void MultithreadedConvolver::WorkerPool::Worker::run()
+{
+	while (!threadShouldExit())
+	{
+		if (!pool.runNextJob())
+			pool.jobEvent.wait(500);
+	}
+}
+
+MultithreadedConvolver::WorkerPool::WorkerPool(int numWorkers_) :
+	numWorkers(jmax(1, numWorkers_))
+{}
+
+MultithreadedConvolver::WorkerPool::~WorkerPool()
+{
+	jassert(convolvers.isEmpty());
+	stopWorkers();
+}
+
+int MultithreadedConvolver::WorkerPool::getNumRegisteredConvolvers() const
+{
+	ScopedLock sl(lock);
+	return convolvers.size();
+}
+
+void MultithreadedConvolver::WorkerPool::registerConvolver(MultithreadedConvolver* c)
+{
+	ScopedLock sl(lock);
+	convolvers.addIfNotAlreadyThere(c);
+
+	// The pool is shared between all instances, so this must be checked with the lock held
+	// or two convolvers that are registered on different threads might both start the workers.
+	if (workers.isEmpty())
+		startWorkers();
+}
+
+void MultithreadedConvolver::WorkerPool::unregisterConvolver(MultithreadedConvolver* c)
+{
+	ScopedLock sl(lock);
+	convolvers.removeAllInstancesOf(c);
+}
+
+bool MultithreadedConvolver::WorkerPool::runNextJob()
+{
+	MultithreadedConvolver* c = nullptr;
+	int stageIndex = -1;
+
+	{
+		ScopedLock sl(lock);
+
+		int64 earliestDeadline = (std::numeric_limits<int64>::max)();
+		bool moreJobs = false;
+
+		for (auto cv : convolvers)
+		{
+			for (int i = 0; i < MaxNumStages; i++)
+			{
+				auto& j = cv->jobs[i];
+
+				if (j.state.load() != StageJob::Queued)
+					continue;
+
+				moreJobs |= c != nullptr;
+
+				auto d = j.deadline.load();
+
+				if (d < earliestDeadline)
+				{
+					earliestDeadline = d;
+					c = cv;
+					stageIndex = i;
+				}
+			}
+		}
+
+		if (c == nullptr)
+			return false;
+
+		int expected = StageJob::Queued;
+
+		// The audio thread was faster and renders the stage itself
+		if (!c->jobs[stageIndex].state.compare_exchange_strong(expected, StageJob::Running))
+			return true;
+
+		numBusyWorkers++;
+
+		// Wake up another worker for the remaining stages
+		if (moreJobs)
+			jobEvent.signal();
+	}
+
+	c->doBackgroundProcessing(stageIndex);
+
+	// The convolver might be deleted after this, so don't touch it anymore...
+	c->jobs[stageIndex].state.store(StageJob::Idle);
+
+	numBusyWorkers--;
+
+	return true;
+}
+
+void MultithreadedConvolver::WorkerPool::startWorkers()
+{
+	for (int i = 0; i < numWorkers; i++)
+	{
+		auto w = workers.add(new Worker(*this, i));
+		w->startThread(10);
+	}
+}
+
+void MultithreadedConvolver::WorkerPool::stopWorkers()
+{
+	for (auto w : workers)
+		w->signalThreadShouldExit();
+
+	jobEvent.signal();
+
+	for (auto w : workers)
+		w->stopThread(1000);
+
+	workers.clear();
+}
+
+void MultithreadedConvolver::startBackgroundProcessing(int stageIndex)
+{
+	auto blockSize = getStageBlockSize(stageIndex);
+
+	statistics.numJobs++;
+
+	if (workerPool != nullptr && blockSize >= (size_t)minimumBackgroundBlockSize)
+	{
+		auto& j = jobs[stageIndex];
+
+		// The result is needed when the next block of this stage is full
+		j.deadline.store(Time::getHighResolutionTicks() + (int64)((double)blockSize * ticksPerSample));
+		j.state.store(StageJob::Queued);
+
+		workerPool->notify();
+	}
+	else
+	{
+		doBackgroundProcessing(stageIndex);
+	}
+}
+
+void MultithreadedConvolver::waitForBackgroundProcessing(int stageIndex)
+{
+	auto& j = jobs[stageIndex];
+
+	int expected = StageJob::Queued;
+
+	if (j.state.compare_exchange_strong(expected, StageJob::Running))
+	{
+		// None of the workers picked up the stage in time, so we render it here
+		statistics.numDeadlineMisses++;
+		doBackgroundProcessing(stageIndex);
+		j.state.store(StageJob::Idle);
+		return;
+	}
+
+	if (expected == StageJob::Running)
+	{
+		statistics.numDeadlineMisses++;
+
+		while (j.state.load() == StageJob::Running)
+			Thread::yield();
+	}
+}
+
+void MultithreadedConvolver::setUseBackgroundThread(WorkerPool* newPoolToUse, bool forceUpdate)
+{
+	if (workerPool != newPoolToUse || forceUpdate)
+	{
+		if (workerPool != nullptr)
+			workerPool->unregisterConvolver(this);
+
+		finishPendingJobs();
+
+		workerPool = newPoolToUse;
+
+		if (workerPool != nullptr)
+			workerPool->registerConvolver(this);
+	}
+}
+
+void MultithreadedConvolver::setSampleRate(double newSampleRate)
+{
+	if (newSampleRate > 0.0)
+		ticksPerSample = (double)Time::getHighResolutionTicksPerSecond() / newSampleRate;
+}
+
+bool MultithreadedConvolver::isBusy() const
+{
+	for (auto& j : jobs)
+	{
+		if (j.state.load() != StageJob::Idle)
+			return true;
+	}
+
+	return false;
+}
+
+void MultithreadedConvolver::finishPendingJobs()
+{
+	for (int i = 0; i < MaxNumStages; i++)
+		waitForBackgroundProcessing(i);
+}
+
 MultithreadedConvolver::Ptr ConvolutionEffectBase::createNewEngine(audiofft::ImplementationType fftType)
 {
     MultithreadedConvolver::Ptr newConvolver = new MultithreadedConvolver(fftType);
 	newConvolver->reset();
-	newConvolver->setUseBackgroundThread(useBackgroundThread ? &backgroundThread : nullptr, true);
+	newConvolver->setSampleRate(lastSampleRate);
+	newConvolver->setUseBackgroundThread(useBackgroundThread ? &workerPool.get() : nullptr, true);
 
 	return newConvolver;
 }
@@ -502,8 +716,8 @@ bool ConvolutionEffectBase::reloadInternal()
 	{
 		SimpleReadWriteLock::ScopedWriteLock sl(swapLock);
         
-        while(backgroundThread.isBusy())
-            Thread::getCurrentThread()->wait(10);
+        convolverL->finishPendingJobs();
+        convolverR->finishPendingJobs();
         
 		convolverL->reset();
 		convolverR->reset();
@@ -563,8 +777,8 @@ bool ConvolutionEffectBase::reloadInternal()
 	{
 		SimpleReadWriteLock::ScopedWriteLock sl(swapLock);
         
-        while(backgroundThread.isBusy())
-            Thread::getCurrentThread()->wait(10);
+        convolverL->finishPendingJobs();
+        convolverR->finishPendingJobs();
         
         std::swap(s1, convolverL);
 		std::swap(s2, convolverR);
@@ -574,4 +788,298 @@ bool ConvolutionEffectBase::reloadInternal()
 }
 
 
+#if HI_RUN_UNIT_TESTS
+
+class ConvolutionBenchmark : public UnitTest
+{
+public:
+
+	ConvolutionBenchmark() :
+		UnitTest("Convolution benchmark", "benchmark")
+	{}
+
+	void runTest() override
+	{
+		testAccuracy(false);
+		testAccuracy(true);
+
+		for (auto irSeconds : { 1.0, 4.0, 10.0 })
+		{
+			for (auto blockSize : { 64, 256, 1024 })
+				testPerformance(irSeconds, blockSize);
+		}
+	}
+
+private:
+
+	static constexpr double SampleRate = 96000.0;
+	static constexpr int NumInstances = 4;
+	static constexpr double SecondsToRender = 1.0;
+
+	static void fillWithNoise(AudioSampleBuffer& b, Random& r, bool decay)
+	{
+		auto numSamples = b.getNumSamples();
+
+		for (int i = 0; i < numSamples; i++)
+		{
+			auto gain = decay ? std::exp(-4.0f * (float)i / (float)numSamples) : 1.0f;
+			b.setSample(0, i, gain * (r.nextFloat() * 2.0f - 1.0f));
+		}
+	}
+
+	void testAccuracy(bool useWorkers)
+	{
+		beginTest(useWorkers ? "Test multistage accuracy with worker pool" : "Test multistage accuracy");
+
+		Random r;
+
+		AudioSampleBuffer ir(1, 5000);
+		AudioSampleBuffer input(1, 8192);
+		AudioSampleBuffer output(1, 8192);
+
+		fillWithNoise(ir, r, true);
+		fillWithNoise(input, r, false);
+
+		MultithreadedConvolver::WorkerPool pool(2);
+		MultithreadedConvolver::Ptr c = new MultithreadedConvolver(audiofft::ImplementationType::BestAvailable);
+
+		c->init(32, 1024, ir.getReadPointer(0), ir.getNumSamples());
+		c->setMinimumBackgroundBlockSize(0);
+		c->setUseBackgroundThread(useWorkers ? &pool : nullptr);
+
+		expect(c->getNumStages() > 2, "not enough stages");
+
+		// use odd block sizes to check the stage alignment
+		for (int i = 0; i < input.getNumSamples();)
+		{
+			auto numThisTime = jmin(input.getNumSamples() - i, 37 + (i % 91));
+			c->process(input.getReadPointer(0, i), output.getWritePointer(0, i), numThisTime);
+			i += numThisTime;
+		}
+
+		c->setUseBackgroundThread(nullptr);
+
+		float maxError = 0.0f;
+
+		for (int i = 0; i < output.getNumSamples(); i++)
+		{
+			double expected = 0.0;
+
+			for (int j = jmax(0, i - ir.getNumSamples() + 1); j <= i; j++)
+				expected += (double)input.getSample(0, j) * (double)ir.getSample(0, i - j);
+
+			maxError = jmax(maxError, std::abs((float)expected - output.getSample(0, i)));
+		}
+
+		expect(maxError < 0.001f, "Convolution result deviates: " + String(maxError));
+	}
+
+	void testPerformance(double irSeconds, int blockSize)
+	{
+		String name;
+		name << String(irSeconds, 0) << "s IR, " << String(blockSize) << " samples";
+
+		beginTest(name);
+
+		Random r;
+
+		AudioSampleBuffer ir(1, roundToInt(irSeconds * SampleRate));
+		AudioSampleBuffer input(1, blockSize);
+		AudioSampleBuffer output(1, blockSize);
+
+		fillWithNoise(ir, r, true);
+		fillWithNoise(input, r, false);
+
+		MultithreadedConvolver::WorkerPool pool;
+
+		String message;
+		message << name << " (" << String(NumInstances) << " instances, " << String(pool.getNumWorkers()) << " workers): ";
+
+		for (auto useWorkers : { false, true })
+		{
+			ReferenceCountedArray<MultithreadedConvolver> convolvers;
+
+			for (int i = 0; i < NumInstances; i++)
+			{
+				auto c = convolvers.add(new MultithreadedConvolver(audiofft::ImplementationType::BestAvailable));
+				c->init(blockSize, 8192, ir.getReadPointer(0), ir.getNumSamples());
+				c->setSampleRate(SampleRate);
+				c->setUseBackgroundThread(useWorkers ? &pool : nullptr);
+			}
+
+			const int numBlocks = roundToInt(SecondsToRender * SampleRate / (double)blockSize);
+			const double blockDurationMs = 1000.0 * (double)blockSize / SampleRate;
+
+			double totalMs = 0.0;
+			double worstMs = 0.0;
+
+			auto nextBlockStart = Time::getMillisecondCounterHiRes();
+
+			for (int b = 0; b < numBlocks; b++)
+			{
+				// Run in realtime so that the workers have the same amount of time as in a real audio callback
+				while (Time::getMillisecondCounterHiRes() < nextBlockStart)
+					Thread::yield();
+
+				nextBlockStart += blockDurationMs;
+
+				auto start = Time::getMillisecondCounterHiRes();
+
+				for (auto c : convolvers)
+					c->process(input.getReadPointer(0), output.getWritePointer(0), blockSize);
+
+				auto delta = Time::getMillisecondCounterHiRes() - start;
+
+				totalMs += delta;
+				worstMs = jmax(worstMs, delta);
+			}
+
+			int numMisses = 0;
+
+			for (auto c : convolvers)
+			{
+				numMisses += c->getStatistics().numDeadlineMisses;
+				c->setUseBackgroundThread(nullptr);
+			}
+
+			auto cpuPerInstance = 100.0 * totalMs / (SecondsToRender * 1000.0) / (double)NumInstances;
+
+			message << (useWorkers ? ", worker pool: " : "synchronous: ");
+			message << String(cpuPerInstance, 2) << "% CPU per instance, worst block " << String(worstMs, 3) << " ms";
+			message << " (" << String(100.0 * worstMs / blockDurationMs, 1) << "% of the buffer)";
+
+			if (useWorkers)
+				message << ", " << String(numMisses) << " missed deadlines";
+		}
+
+		logMessage(message);
+	}
+};
+
+static ConvolutionBenchmark convolutionBenchmark;
+
+class FFTBenchmark : public UnitTest
+{
+public:
+
+	FFTBenchmark() :
+		UnitTest("FFT benchmark", "benchmark")
+	{}
+
+	void runTest() override
+	{
+		for (int size = 64; size <= 65536; size *= 2)
+			testFFTSize(size);
+	}
+
+private:
+
+	using Type = audiofft::ImplementationType;
+
+	static String getName(Type t)
+	{
+		switch (t)
+		{
+		case Type::BestAvailable: return "Best available";
+		case Type::IPP: return "IPP";
+		case Type::AppleAccelerate: return "Accelerate";
+		case Type::Ooura: return "Ooura";
+		case Type::FFTW3: return "FFTW3";
+		case Type::SIMD: return "SIMD";
+		default: return {};
+		}
+	}
+
+	void testFFTSize(int size)
+	{
+		beginTest("Test FFT with size " + String(size));
+
+		Random r;
+
+		const int numBins = size / 2 + 1;
+
+		HeapBlock<float> input, output, re, im, refRe, refIm;
+		input.calloc(size); output.calloc(size);
+		re.calloc(numBins); im.calloc(numBins);
+		refRe.calloc(numBins); refIm.calloc(numBins);
+
+		for (int i = 0; i < size; i++)
+			input[i] = r.nextFloat() * 2.0f - 1.0f;
+
+		audiofft::AudioFFT reference(Type::Ooura);
+		reference.init(size);
+		reference.fft(input, refRe, refIm);
+
+		float maxMagnitude = 1.0f;
+
+		for (int i = 0; i < numBins; i++)
+			maxMagnitude = jmax(maxMagnitude, std::abs(refRe[i]), std::abs(refIm[i]));
+
+		const int numRuns = jmax(16, (1 << 22) / size);
+
+		String message;
+		message << "FFT size " << String(size) << ": ";
+
+		for (auto t : { Type::Ooura, Type::SIMD, Type::BestAvailable })
+		{
+			audiofft::AudioFFT fft(t);
+			fft.init(size);
+
+			fft.fft(input, re, im);
+
+			float maxError = 0.0f;
+
+			for (int i = 0; i < numBins; i++)
+				maxError = jmax(maxError, std::abs(re[i] - refRe[i]), std::abs(im[i] - refIm[i]));
+
+			expect(maxError / maxMagnitude < 1e-5f, getName(t) + " FFT deviates: " + String(maxError));
+
+			fft.ifft(output, re, im);
+
+			float maxRoundtripError = 0.0f;
+
+			for (int i = 0; i < size; i++)
+				maxRoundtripError = jmax(maxRoundtripError, std::abs(output[i] - input[i]));
+
+			expect(maxRoundtripError < 1e-5f, getName(t) + " inverse FFT deviates: " + String(maxRoundtripError));
+
+			auto start = Time::getMillisecondCounterHiRes();
+
+			for (int i = 0; i < numRuns; i++)
+			{
+				fft.fft(input, re, im);
+				fft.ifft(output, re, im);
+			}
+
+			auto usPerRun = 1000.0 * (Time::getMillisecondCounterHiRes() - start) / (double)numRuns;
+
+			message << getName(t) << ": " << String(usPerRun, 3) << " us, ";
+		}
+
+		// The IppFFT interface uses the SIMD FFT if IPP is not available
+		if (size < (1 << IPP_FFT_MAX_POWER_OF_TWO))
+		{
+			IppFFT fft(IppFFT::DataType::RealFloat);
+
+			auto start = Time::getMillisecondCounterHiRes();
+
+			for (int i = 0; i < numRuns; i++)
+			{
+				fft.realFFT(input, output, size);
+				fft.realFFTInverse(output, output, size);
+			}
+
+			auto usPerRun = 1000.0 * (Time::getMillisecondCounterHiRes() - start) / (double)numRuns;
+
+			message << "IppFFT: " << String(usPerRun, 3) << " us (forward + inverse)";
+		}
+
+		logMessage(message);
+	}
+};
+
+static FFTBenchmark fftBenchmark;
+
+#endif
+
 }
@@ -106,136 +106,145 @@ private:
 	Smoother smoother;
 };
 
-class MultithreadedConvolver : public fftconvolver::TwoStageFFTConvolver,
+class MultithreadedConvolver : public fftconvolver::MultiStageFFTConvolver,
                                public ReferenceCountedObject
 {
 public:
     
     using Ptr = ReferenceCountedObjectPtr<MultithreadedConvolver>;
     
-	class BackgroundThread : public Thread
+	/** A pool of worker threads that renders the tail stages of all registered convolvers.
+
+		The queued stages are picked in the order of their deadlines, so the short stages of
+		one convolver don't have to wait until the long tail stage of another one is finished.
+	*/
+	class WorkerPool
 	{
 	public:
 
-		BackgroundThread() :
-          Thread("Convolution Background Thread"),
-          queue(512)
-		{}
-
-        ~BackgroundThread()
-        {
-            jassert(numRegisteredConvolvers == 0);
-            stopThread(1000);
-            queue.callForEveryElementInQueue({});
-        }
-        
-		void run() override
+		WorkerPool(int numWorkers=HISE_NUM_CONVOLUTION_WORKERS);
+
+		~WorkerPool();
+
+		int getNumWorkers() const { return numWorkers; }
+
+		/** Returns true if one of the workers is currently rendering a stage. */
+		bool isBusy() const { return numBusyWorkers.load() > 0; }
+
+		int getNumRegisteredConvolvers() const;
+
+	private:
+
+		friend class MultithreadedConvolver;
+
+		struct Worker : public Thread
 		{
-			while (!threadShouldExit())
-			{
-                {
-                    ScopedValueSetter<bool> svs(currentlyRendering, true);
-                    
-                    queue.callForEveryElementInQueue([this](MultithreadedConvolver::Ptr c)
-                    {
-                        if (threadShouldExit())
-                            return false;
-                        
-                        c->doBackgroundProcessing();
-                        c->pending.store(false);
-                        
-                        return true;
-                    });
-                }
-                
-				wait(500);
-			}
+			Worker(WorkerPool& p, int index);
+
+			void run() override;
+
+			WorkerPool& pool;
 		};
 
-        void addConvolverJob(MultithreadedConvolver::Ptr c)
-        {
-            queue.push(c);
-            notify();
-        }
-        
-		bool isBusy() const { return currentlyRendering; }
-		bool currentlyRendering = false;
-		
-        int numRegisteredConvolvers = 0;
-        
-        hise::LockfreeQueue<MultithreadedConvolver::Ptr> queue;
+		void registerConvolver(MultithreadedConvolver* c);
+		void unregisterConvolver(MultithreadedConvolver* c);
+
+		/** Wakes up the workers. This is called from the audio thread. */
+		void notify() { jobEvent.signal(); }
+
+		/** Renders the queued stage with the earliest deadline. Returns false if there was nothing to do. */
+		bool runNextJob();
+
+		void startWorkers();
+		void stopWorkers();
+
+		CriticalSection lock;
+		Array<MultithreadedConvolver*> convolvers;
+		OwnedArray<Worker> workers;
+		WaitableEvent jobEvent;
+
+		const int numWorkers;
+		std::atomic<int> numBusyWorkers = { 0 };
+
+		JUCE_DECLARE_NON_COPYABLE(WorkerPool);
 	};
 
+	/** Counts how often the audio thread had to wait for the result of a stage. */
+	struct Statistics
+	{
+		int numJobs = 0;
+		int numDeadlineMisses = 0;
+	};
 
 public:
 
 	MultithreadedConvolver(audiofft::ImplementationType fftType) :
-		TwoStageFFTConvolver(fftType),
-		backgroundThread(nullptr)
+		MultiStageFFTConvolver(fftType)
 	{};
 
 	virtual ~MultithreadedConvolver()
 	{
-        jassert(!pending);
-        
-        if(backgroundThread != nullptr)
-            backgroundThread->numRegisteredConvolvers--;
+		setUseBackgroundThread(nullptr);
+        jassert(!isBusy());
 	};
 
-	void startBackgroundProcessing() override
-	{
-        pending.store(true);
-        
-		if (backgroundThread != nullptr)
-		{
-            backgroundThread->addConvolverJob(this);
-		}
-		else
-		{
-			doBackgroundProcessing();
-            pending.store(false);
-		}
-	}
+	void startBackgroundProcessing(int stageIndex) override;
 
-	void waitForBackgroundProcessing() override
-	{
-        while (pending.load())
-            jassertfalse;
-	}
+	void waitForBackgroundProcessing(int stageIndex) override;
 
 	static bool prepareImpulseResponse(const AudioSampleBuffer& originalBuffer, AudioSampleBuffer& buffer, bool* abortFlag, Range<int> range, double resampleRatio);
 
 	static double getResampleFactor(double sampleRate, double impulseSampleRate);
 
+	/** Registers the convolver to the given worker pool (or renders all stages synchronously if nullptr). */
+	void setUseBackgroundThread(WorkerPool* newPoolToUse, bool forceUpdate = false);
 
-
-	void setUseBackgroundThread(BackgroundThread* newThreadToUse, bool forceUpdate = false)
+	bool isUsingBackgroundThread() const
 	{
-		if (backgroundThread != newThreadToUse || forceUpdate)
-        {
-            if(backgroundThread != nullptr)
-                backgroundThread->numRegisteredConvolvers--;
-            
-            backgroundThread = newThreadToUse;
-            
-            if(backgroundThread != nullptr)
-                backgroundThread->numRegisteredConvolvers++;
-            
-            if (backgroundThread != nullptr && !backgroundThread->isThreadRunning())
-                backgroundThread->startThread(10);
-        }
+		return workerPool != nullptr;
 	}
 
-	bool isUsingBackgroundThread() const
+	/** Stages with a smaller block size are rendered on the audio thread because
+	    the overhead of handing them over to a worker outweighs the benefit. */
+	void setMinimumBackgroundBlockSize(int newMinimumBlockSize)
 	{
-		return backgroundThread != nullptr;
+		minimumBackgroundBlockSize = newMinimumBlockSize;
 	}
 
+	/** Sets the sample rate that is used to calculate the deadlines of the stages. */
+	void setSampleRate(double newSampleRate);
+
+	/** Returns true if there is a stage that is queued or currently rendered by a worker. */
+	bool isBusy() const;
+
+	/** Waits until all queued stages are rendered. If a stage wasn't picked up by a worker, it will be rendered on the calling thread. */
+	void finishPendingJobs();
+
+	const Statistics& getStatistics() const { return statistics; }
+
 private:
 
-    std::atomic<bool> pending = { false };
-    
-    BackgroundThread* backgroundThread = nullptr;
+	struct StageJob
+	{
+		enum State
+		{
+			Idle,
+			Queued,
+			Running
+		};
+
+		std::atomic<int> state = { Idle };
+		std::atomic<int64> deadline = { 0 };
+	};
+
+	StageJob jobs[MaxNumStages];
+
+	Statistics statistics;
+
+	double ticksPerSample = (double)Time::getHighResolutionTicksPerSecond() / 44100.0;
+	int minimumBackgroundBlockSize = 512;
+
+    WorkerPool* workerPool = nullptr;
 };
 
 struct ConvolutionEffectBase : public AsyncUpdater,
@@ -257,7 +266,7 @@ struct ConvolutionEffectBase : public AsyncUpdater,
 
 		SimpleReadWriteLock::ScopedReadLock sl(swapLock);
         
-        auto tToUse = !nonRealtime && useBackgroundThread ? &backgroundThread : nullptr;
+        auto tToUse = !nonRealtime && useBackgroundThread ? &workerPool.get() : nullptr;
         
         convolverL->setUseBackgroundThread(tToUse);
 		convolverR->setUseBackgroundThread(tToUse);
@@ -268,7 +277,7 @@ struct ConvolutionEffectBase : public AsyncUpdater,
 
 protected:
 
-    MultithreadedConvolver::BackgroundThread backgroundThread;
+    SharedResourcePointer<MultithreadedConvolver::WorkerPool> workerPool;
     
 	void resetBase();
 
@@ -72,7 +72,7 @@ void convolution::setMultithread(double shouldBeMultithreaded)
 	{
 		SimpleReadWriteLock::ScopedWriteLock sl(swapLock);
         
-        auto tToUse = useBackgroundThread && !nonRealtime ? &backgroundThread : nullptr;
+        auto tToUse = useBackgroundThread && !nonRealtime ? &workerPool.get() : nullptr;
         
 		convolverL->setUseBackgroundThread(tToUse);
 		convolverR->setUseBackgroundThread(tToUse);
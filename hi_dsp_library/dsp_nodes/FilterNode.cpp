@@ -125,12 +125,30 @@ void FilterNodeBase<FilterType, NV>::prepare(PrepareSpecs ps)
 	auto s = ps.sampleRate;
 	sr = s;
 
+	// The filter storage is reallocated if the amount of voice slots changes,
+	// so we need to carry over the parameters of the first filter
+	const auto& first = filter.getFirst();
+	auto type = first.getType();
+	auto frequency = first.getFrequency();
+	auto q = first.getQ();
+	auto gain = first.getGain();
+
 	filter.prepare(ps);
 
 	for(auto& f: filter)
 	{
 		f.setNumChannels(c);
 		f.setSampleRate(s);
+
+		if (type != -1)
+			f.setType(type);
+
+		f.setFrequency(frequency);
+		f.setQ(q);
+		f.setGain(gain);
+
+		if (smoothingTime > 0.0)
+			f.setSmoothingTime(smoothingTime);
 	};
 
 	if (auto fd = dynamic_cast<FilterDataObject*>(this->externalData.obj))
@@ -189,6 +207,8 @@ void FilterNodeBase<FilterType, NV>::createParameters(ParameterDataList& paramet
 template <class FilterType, int NV>
 void FilterNodeBase<FilterType, NV>::setSmoothing(double newSmoothingTime)
 {
+	smoothingTime = newSmoothingTime;
+
 	for (auto& f : filter)
 		f.setSmoothingTime(newSmoothingTime);
 }
@@ -146,8 +146,9 @@ public:
 	SN_PARAMETER_MEMBER_FUNCTION;
 	
 
-	PolyData<FilterObject, NumVoices> filter;
+	CompactPolyData<FilterObject, NumVoices> filter;
 	double sr = -1.0;
+	double smoothingTime = -1.0;
 	bool enabled = true;
 
 	JUCE_DECLARE_WEAK_REFERENCEABLE(FilterNodeBase);
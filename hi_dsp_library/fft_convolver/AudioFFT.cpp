@@ -1082,6 +1082,45 @@ namespace audiofft
 #endif // AUDIOFFT_FFTW3_USED
 
 
+  // ================================================================
+
+
+  /**
+   * @internal
+   * @class SIMD_FFT
+   * @brief FFT implementation using the bundled SSE / NEON FFT (hise::SimdFFT)
+   */
+  class SIMD_FFT : public detail::AudioFFTImpl
+  {
+  public:
+
+	  SIMD_FFT() :
+		  detail::AudioFFTImpl()
+	  {}
+
+	  void init(size_t size) override
+	  {
+		  numSamples = size;
+		  fft_.init((int)size);
+	  }
+
+	  void fft(const float* data, float* re, float* im) override
+	  {
+		  fft_.realFFT(data, re, im);
+	  }
+
+	  void ifft(float* data, const float* re, const float* im) override
+	  {
+		  fft_.realInverseFFT(re, im, data, 1.0f / (float)numSamples);
+	  }
+
+  private:
+
+	  hise::SimdFFT fft_;
+	  size_t numSamples = 0;
+  };
+
+
   // =============================================================
 
 
@@ -1091,8 +1130,8 @@ namespace audiofft
 
 	  - if Apple's FFT should be used (iOS), use this.
 	  - if USE_IPP is set and the fftType is IPP, use this
-	  - if Ooura is chosen or all other implementations are not avalailable,
-	    use this (on all systems).
+	  - if neither of those is available, use the bundled SIMD FFT
+	  - if Ooura is chosen, use this (on all systems).
 	  */
 
 	  switch (fftType)
@@ -1109,6 +1148,9 @@ namespace audiofft
 		  _impl.reset(new IPP_FFT());
 		  break;
 #endif
+	  case audiofft::ImplementationType::SIMD:
+		  _impl.reset(new SIMD_FFT());
+		  break;
 	  default:
 		  _impl.reset(new OouraFFT());
 		  break;
@@ -100,6 +100,7 @@ namespace audiofft
 		AppleAccelerate,
 		Ooura,
 		FFTW3,
+		SIMD,
 		numImplementationTypes
 	};
 
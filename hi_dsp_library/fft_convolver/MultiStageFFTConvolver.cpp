@@ -0,0 +1,215 @@
+// ==================================================================================
+// Copyright (c) 2017 HiFi-LoFi
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is furnished
+// to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+// WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// ==================================================================================
+
+#include "MultiStageFFTConvolver.h"
+
+#include <algorithm>
+#include <cmath>
+
+
+namespace fftconvolver
+{
+
+MultiStageFFTConvolver::Stage::Stage(audiofft::ImplementationType fftType) :
+  _blockSize(0),
+  _inputFill(0),
+  _convolver(fftType),
+  _input(),
+  _output(),
+  _precalculated(),
+  _backgroundProcessingInput()
+{
+}
+
+
+MultiStageFFTConvolver::MultiStageFFTConvolver(audiofft::ImplementationType fftType) :
+  _fftType(fftType),
+  _headBlockSize(0),
+  _headConvolver(fftType),
+  _stages()
+{
+}
+
+
+MultiStageFFTConvolver::~MultiStageFFTConvolver()
+{
+  reset();
+}
+
+
+void MultiStageFFTConvolver::reset()
+{
+  _headBlockSize = 0;
+  _headConvolver.reset();
+  _stages.clear();
+}
+
+
+void MultiStageFFTConvolver::cleanPipeline()
+{
+  for (int i = 0; i < getNumStages(); ++i)
+  {
+    waitForBackgroundProcessing(i);
+
+    auto& s = *_stages[i];
+    s._input.setZero();
+    s._output.setZero();
+    s._precalculated.setZero();
+    s._backgroundProcessingInput.setZero();
+    s._convolver.resetInput();
+    s._inputFill = 0;
+  }
+
+  _headConvolver.resetInput();
+}
+
+
+bool MultiStageFFTConvolver::init(size_t headBlockSize,
+                                  size_t maxBlockSize,
+                                  const Sample* ir,
+                                  size_t irLen)
+{
+  reset();
+
+  if (headBlockSize == 0 || maxBlockSize == 0)
+  {
+    return false;
+  }
+
+  if (headBlockSize > maxBlockSize)
+  {
+    assert(false);
+    std::swap(headBlockSize, maxBlockSize);
+  }
+
+  // Ignore zeros at the end of the impulse response because they only waste computation time
+  while (irLen > 0 && ::fabs(ir[irLen-1]) < 0.000001f)
+  {
+    --irLen;
+  }
+
+  if (irLen == 0)
+  {
+    return true;
+  }
+
+  _headBlockSize = NextPowerOf2(headBlockSize);
+  maxBlockSize = NextPowerOf2(maxBlockSize);
+
+  // The first stage has the block size 2 * head and starts at 4 * head
+  const size_t headIrLen = (maxBlockSize > _headBlockSize) ? jmin(irLen, 4 * _headBlockSize) : irLen;
+  _headConvolver.init(_headBlockSize, ir, headIrLen);
+
+  size_t offset = headIrLen;
+  size_t blockSize = 2 * _headBlockSize;
+
+  while (offset < irLen)
+  {
+    const bool isLastStage = blockSize >= maxBlockSize || (int)_stages.size() == (MaxNumStages - 1);
+    const size_t segmentLen = isLastStage ? (irLen - offset) : jmin(irLen - offset, 2 * blockSize);
+
+    std::unique_ptr<Stage> s(new Stage(_fftType));
+    s->_blockSize = blockSize;
+    s->_convolver.init(blockSize, ir + offset, segmentLen);
+    s->_input.resize(blockSize);
+    s->_output.resize(blockSize);
+    s->_precalculated.resize(blockSize);
+    s->_backgroundProcessingInput.resize(blockSize);
+
+    _stages.push_back(std::move(s));
+
+    offset += segmentLen;
+    blockSize *= 2;
+  }
+
+  return true;
+}
+
+
+void MultiStageFFTConvolver::process(const Sample* input, Sample* output, size_t len)
+{
+  // Head
+  _headConvolver.process(input, output, len);
+
+  // Tail stages
+  for (int i = 0; i < getNumStages(); ++i)
+  {
+    auto& s = *_stages[i];
+
+    size_t processed = 0;
+    while (processed < len)
+    {
+      const size_t processing = jmin(len - processed, s._blockSize - s._inputFill);
+
+      // Sum the result of the block before the last one
+      FloatVectorOperations::add(output + processed, s._precalculated.data() + s._inputFill, (int)processing);
+
+      ::memcpy(s._input.data() + s._inputFill, input + processed, processing * sizeof(Sample));
+      s._inputFill += processing;
+      assert(s._inputFill <= s._blockSize);
+
+      if (s._inputFill == s._blockSize)
+      {
+        waitForBackgroundProcessing(i);
+        SampleBuffer::Swap(s._precalculated, s._output);
+        s._backgroundProcessingInput.copyFrom(s._input);
+        startBackgroundProcessing(i);
+        s._inputFill = 0;
+      }
+
+      processed += processing;
+    }
+  }
+}
+
+
+int MultiStageFFTConvolver::getNumStages() const
+{
+  return (int)_stages.size();
+}
+
+
+size_t MultiStageFFTConvolver::getStageBlockSize(int stageIndex) const
+{
+  assert(stageIndex >= 0 && stageIndex < getNumStages());
+  return _stages[stageIndex]->_blockSize;
+}
+
+
+void MultiStageFFTConvolver::startBackgroundProcessing(int stageIndex)
+{
+  doBackgroundProcessing(stageIndex);
+}
+
+
+void MultiStageFFTConvolver::waitForBackgroundProcessing(int stageIndex)
+{
+  (void)stageIndex;
+}
+
+
+void MultiStageFFTConvolver::doBackgroundProcessing(int stageIndex)
+{
+  auto& s = *_stages[stageIndex];
+  s._convolver.process(s._backgroundProcessingInput.data(), s._output.data(), s._blockSize);
+}
+
+} // End of namespace fftconvolver
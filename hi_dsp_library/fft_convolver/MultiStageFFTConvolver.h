@@ -0,0 +1,149 @@
+// ==================================================================================
+// Copyright (c) 2017 HiFi-LoFi
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is furnished
+// to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+// FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+// COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+// IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+// WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+// ==================================================================================
+
+#ifndef _FFTCONVOLVER_MULTISTAGEFFTCONVOLVER_H
+#define _FFTCONVOLVER_MULTISTAGEFFTCONVOLVER_H
+
+#include "FFTConvolver.h"
+#include "Utilities.h"
+
+#include <memory>
+#include <vector>
+
+
+namespace fftconvolver
+{
+
+/**
+* @class MultiStageFFTConvolver
+* @brief FFT convolver using a non-uniform partitioning with more than two block sizes
+*
+* The impulse response is split into segments with doubling block sizes:
+*
+* - A head convolver, which processes the first 4 * headBlockSize samples
+*   of the impulse response with zero latency.
+*
+* - N tail stages with the block sizes 2 * headBlockSize, 4 * headBlockSize, ...
+*   up to the maximum block size. A stage with the block size B processes the
+*   segment [2B, 4B) of the impulse response, the last stage processes the rest.
+*
+* Each tail stage collects B input samples and then hands its block over to
+* startBackgroundProcessing(). The result is needed one block later, so every
+* stage has a deadline of B samples which is much more relaxed for the long
+* stages that do most of the work. This allows to spread the tail stages of
+* multiple convolvers across a pool of worker threads (see the HISE class
+* MultithreadedConvolver).
+*
+* Like the TwoStageFFTConvolver, all allocations are done in init().
+*/
+class MultiStageFFTConvolver
+{
+public:
+
+  /** The maximum amount of tail stages. If the block sizes need more stages, the last stage will be bigger. */
+  static constexpr int MaxNumStages = 16;
+
+  MultiStageFFTConvolver(audiofft::ImplementationType fftType);
+  virtual ~MultiStageFFTConvolver();
+
+  /**
+  * @brief Initialization the convolver
+  * @param headBlockSize The head block size (will be rounded up to the next power of two)
+  * @param maxBlockSize The block size of the last stage
+  * @param ir The impulse response
+  * @param irLen Length of the impulse response in samples
+  * @return true: Success - false: Failed
+  */
+  bool init(size_t headBlockSize, size_t maxBlockSize, const Sample* ir, size_t irLen);
+
+  /**
+  * @brief Convolves the the given input samples and immediately outputs the result
+  * @param input The input samples
+  * @param output The convolution result
+  * @param len Number of input/output samples
+  */
+  void process(const Sample* input, Sample* output, size_t len);
+
+  /**
+  * @brief Resets the convolver and discards the set impulse response
+  */
+  void reset();
+
+  /** Clears the internal buffers so that it resets the convolution pipeline. */
+  void cleanPipeline();
+
+  /** Returns the number of tail stages. */
+  int getNumStages() const;
+
+  /** Returns the block size of the given tail stage (which is also its deadline in samples). */
+  size_t getStageBlockSize(int stageIndex) const;
+
+protected:
+
+  /**
+  * @brief Called by the convolver if the block of the given stage is ready for processing
+  *
+  * The default implementation just calls doBackgroundProcessing(). Override this
+  * method and call doBackgroundProcessing() on another thread. The result must be
+  * available before the next call to waitForBackgroundProcessing() with the same stage.
+  */
+  virtual void startBackgroundProcessing(int stageIndex);
+
+  /**
+  * @brief Called by the convolver if it expects the result of the previous call to startBackgroundProcessing()
+  *
+  * After returning from this method, the processing of the given stage has to be completed.
+  */
+  virtual void waitForBackgroundProcessing(int stageIndex);
+
+  /**
+  * @brief Actually performs the background processing work of the given stage
+  */
+  void doBackgroundProcessing(int stageIndex);
+
+private:
+
+  struct Stage
+  {
+    Stage(audiofft::ImplementationType fftType);
+
+    size_t _blockSize;
+    size_t _inputFill;
+    FFTConvolver _convolver;
+    SampleBuffer _input;
+    SampleBuffer _output;
+    SampleBuffer _precalculated;
+    SampleBuffer _backgroundProcessingInput;
+  };
+
+  audiofft::ImplementationType _fftType;
+  size_t _headBlockSize;
+  FFTConvolver _headConvolver;
+  std::vector<std::unique_ptr<Stage>> _stages;
+
+  // Prevent uncontrolled usage
+  MultiStageFFTConvolver(const MultiStageFFTConvolver&);
+  MultiStageFFTConvolver& operator=(const MultiStageFFTConvolver&);
+};
+
+} // End of namespace fftconvolver
+
+#endif // Header guard
@@ -81,6 +81,14 @@ Set this to 1 if you want to embed the libraries created with this module into y
 #define IS_STATIC_DSP_LIBRARY 1
 #endif
 
+/** Config: HISE_NUM_CONVOLUTION_WORKERS
+
+The number of worker threads that are shared between all convolution effects that use the background thread option.
+*/
+#ifndef HISE_NUM_CONVOLUTION_WORKERS
+#define HISE_NUM_CONVOLUTION_WORKERS 2
+#endif
+
 
 /** TODO List for scripnode rework:
 
@@ -156,6 +164,7 @@ Set this to 1 if you want to embed the libraries created with this module into y
 #include "fft_convolver/AudioFFT.h"
 #include "fft_convolver/FFTConvolver.h"
 #include "fft_convolver/TwoStageFFTConvolver.h"
+#include "fft_convolver/MultiStageFFTConvolver.h"
 #include "dsp_basics/ConvolutionBase.h"
 
 #include "node_api/helpers/Error.h"
@@ -73,6 +73,7 @@
 #include "fft_convolver/AudioFFT.cpp"
 #include "fft_convolver/FFTConvolver.cpp"
 #include "fft_convolver/TwoStageFFTConvolver.cpp"
+#include "fft_convolver/MultiStageFFTConvolver.cpp"
 
 
 #include "dsp_basics/ConvolutionBase.cpp"
@@ -138,6 +138,89 @@ private:
 	
 };
 
+/** A multi container that processes its branches in parallel.
+
+	The branches write to different channels, so they can be processed on the RealtimeWorkerPool
+	of the PolyHandler without any additional buffers. If there is no worker pool (or it's busy), 
+	the branches will be processed on the calling thread. The frame processing will always be serial.
+*/
+template <class ParameterClass, typename... Processors> struct parallel_multi : public multi<ParameterClass, Processors...>
+{
+	using MultiType = multi<ParameterClass, Processors...>;
+
+	SN_GET_SELF_AS_OBJECT(parallel_multi);
+
+	static constexpr int N = sizeof...(Processors);
+	using BlockType = typename MultiType::BlockType;
+
+	void prepare(PrepareSpecs ps)
+	{
+		MultiType::prepare(ps);
+		workerPool = ps.voiceIndex != nullptr ? ps.voiceIndex->getWorkerPool() : nullptr;
+	}
+
+	void process(BlockType& d)
+	{
+		BranchJob job(*this, d);
+
+		if (workerPool != nullptr)
+			workerPool->processJob(job, N);
+		else
+		{
+			for (int i = 0; i < N; i++)
+				job.processTask(i, 0);
+		}
+	}
+
+private:
+
+	struct BranchJob : public hise::RealtimeWorkerPool::Job
+	{
+		BranchJob(parallel_multi& p, BlockType& d_) :
+			parent(p),
+			d(d_)
+		{}
+
+		void processTask(int taskIndex, int) override
+		{
+			parent.processBranch(taskIndex, d, std::index_sequence_for<Processors...>());
+		}
+
+		parallel_multi& parent;
+		BlockType& d;
+	};
+
+	template <size_t I> static constexpr int getChannelOffset()
+	{
+		constexpr int numChannels[] = { Processors::NumChannels... };
+
+		int offset = 0;
+
+		for (size_t i = 0; i < I; i++)
+			offset += numChannels[i];
+
+		return offset;
+	}
+
+	template <size_t... Is> void processBranch(int index, BlockType& d, std::index_sequence<Is...>)
+	{
+		((index == (int)Is ? processSingleBranch<Is>(d) : (void)0), ...);
+	}
+
+	template <size_t I> void processSingleBranch(BlockType& d)
+	{
+		using T = typename std::tuple_element<I, std::tuple<Processors...>>::type;
+		constexpr int NumChannelsThisTime = T::NumChannels;
+
+		ProcessData<NumChannelsThisTime> thisData(d.getRawDataPointers() + getChannelOffset<I>(), d.getNumSamples());
+		thisData.copyNonAudioDataFrom(d);
+
+		std::get<I>(this->elements).process(thisData);
+	}
+
+	hise::RealtimeWorkerPool* workerPool = nullptr;
+};
+
 }
 
 }
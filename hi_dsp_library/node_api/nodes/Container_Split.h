@@ -198,6 +198,121 @@ private:
 	BufferType workBuffer;
 };
 
+/** A split container that processes its branches in parallel.
+
+	Every branch except for the first one gets its own buffer, so the branches can be processed
+	on the RealtimeWorkerPool of the PolyHandler without sharing any data. The branches are summed
+	in their original order afterwards, so the result is identical to container::split.
+
+	If there is no worker pool (or it's busy), the branches will be processed on the calling thread.
+	The frame processing will always be serial.
+*/
+template <class ParameterClass, typename... Processors> struct parallel_split : public split<ParameterClass, Processors...>
+{
+	using SplitType = split<ParameterClass, Processors...>;
+
+	SN_GET_SELF_AS_OBJECT(parallel_split);
+
+	static constexpr int N = sizeof...(Processors);
+	static constexpr int NumChannels = SplitType::NumChannels;
+
+	void prepare(PrepareSpecs ps)
+	{
+		SplitType::prepare(ps);
+
+		workerPool = ps.voiceIndex != nullptr ? ps.voiceIndex->getWorkerPool() : nullptr;
+
+		if (N > 1)
+			snex::Types::FrameConverters::increaseBuffer(branchBuffer, ps.withNumChannels(ps.numChannels * (N - 1)));
+	}
+
+	template <class ProcessDataType> void process(ProcessDataType& d)
+	{
+		if (N == 1)
+		{
+			SplitType::process(d);
+			return;
+		}
+
+		// If this fires, you don't have called prepare yet...
+		jassert(!branchBuffer.isEmpty());
+
+		auto numSamples = d.getNumSamples();
+		auto dPtr = d.getRawDataPointers();
+
+		for (int b = 1; b < N; b++)
+		{
+			for (int c = 0; c < d.getNumChannels(); c++)
+				FloatVectorOperations::copy(getBranchChannel(b, c, numSamples), dPtr[c], numSamples);
+		}
+
+		BranchJob<ProcessDataType> job(*this, d);
+
+		if (workerPool != nullptr)
+			workerPool->processJob(job, N);
+		else
+		{
+			for (int i = 0; i < N; i++)
+				job.processTask(i, 0);
+		}
+
+		for (int b = 1; b < N; b++)
+		{
+			for (int c = 0; c < d.getNumChannels(); c++)
+				FloatVectorOperations::add(dPtr[c], getBranchChannel(b, c, numSamples), numSamples);
+		}
+	}
+
+private:
+
+	template <class ProcessDataType> struct BranchJob : public hise::RealtimeWorkerPool::Job
+	{
+		BranchJob(parallel_split& p, ProcessDataType& d_) :
+			parent(p),
+			d(d_)
+		{}
+
+		void processTask(int taskIndex, int) override
+		{
+			parent.processBranch(taskIndex, d, std::index_sequence_for<Processors...>());
+		}
+
+		parallel_split& parent;
+		ProcessDataType& d;
+	};
+
+	float* getBranchChannel(int branchIndex, int channelIndex, int numSamples)
+	{
+		return branchBuffer.begin() + ((branchIndex - 1) * NumChannels + channelIndex) * numSamples;
+	}
+
+	template <class ProcessDataType, size_t... Is> void processBranch(int index, ProcessDataType& d, std::index_sequence<Is...>)
+	{
+		((index == (int)Is ? processSingleBranch<Is>(d) : (void)0), ...);
+	}
+
+	template <size_t I, class ProcessDataType> void processSingleBranch(ProcessDataType& d)
+	{
+		if constexpr (I == 0)
+			std::get<0>(this->elements).process(d);
+		else
+		{
+			float* ptrs[NumChannels];
+
+			for (int c = 0; c < NumChannels; c++)
+				ptrs[c] = getBranchChannel((int)I, c, d.getNumSamples());
+
+			ProcessData<NumChannels> wd(ptrs, d.getNumSamples());
+			wd.copyNonAudioDataFrom(d);
+
+			std::get<I>(this->elements).process(wd);
+		}
+	}
+
+	hise::RealtimeWorkerPool* workerPool = nullptr;
+	typename SplitType::BufferType branchBuffer;
+};
+
 }
 
 }
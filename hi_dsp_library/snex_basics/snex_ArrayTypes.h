@@ -494,6 +494,29 @@ template <class T, int Size, int Alignment=16> struct span
 		return *reinterpret_cast<Type*>(this);
 	}
 
+	/** Converts the first Size / 4 * 4 elements into a SSE span. Use this together
+		with toSimdRemainder() if the size is not a multiple of 4.
+	*/
+	span<span<float, 4>, Size / 4>& toSimdHead()
+	{
+		using Type = span<span<float, 4>, Size / 4>;
+
+		static_assert(std::is_same<T, float>() && Size >= 4, "is not SIMDable");
+		jassert(isAlignedTo16Byte());
+
+		return *reinterpret_cast<Type*>(this);
+	}
+
+	/** Returns the last Size % 4 elements that are not covered by toSimdHead(). */
+	span<T, Size % 4>& toSimdRemainder()
+	{
+		using Type = span<T, Size % 4>;
+
+		static_assert(Size % 4 != 0, "no remaining elements");
+
+		return *reinterpret_cast<Type*>(begin() + (Size / 4) * 4);
+	}
+
 	template<typename IndexType> typename std::enable_if<index::Helpers::canReturnReference<IndexType>(), const T&>::type
 		operator[](const IndexType& t) const
 	{
@@ -637,11 +660,16 @@ template <class T> struct dyn
 		jassert(offset + size() < fullSize);
 	}
 
+	/** Returns a dyn<float4> that covers the first (size() / 4) * 4 elements.
+
+		This matches the JIT-compiled toSimd() which also drops the trailing
+		size() % 4 elements - use toSimdRemainder() to process them.
+	*/
 	dyn<float4> toSimd() const
 	{
 		dyn<float4> rt;
 
-		jassert(this->size() % 4 == 0);
+		jassert(isAlignedTo16Byte());
 
 		rt.data = reinterpret_cast<float4*>(begin());
 		rt.size_ = size() / 4;
@@ -649,6 +677,15 @@ template <class T> struct dyn
 		return rt;
 	}
 
+	/** Returns a dyn that refers to the last size() % 4 elements. */
+	dyn<float> toSimdRemainder() const
+	{
+		static_assert(std::is_same<T, float>(), "not a float dyn");
+
+		auto numSimdElements = (size() / 4) * 4;
+		return dyn<float>(begin() + numSimdElements, (size_t)(size() - numSimdElements));
+	}
+
 	dyn<float>& asBlock()
 	{
 		static_assert(std::is_same<T, float>(), "not a float dyn");
@@ -875,6 +912,11 @@ template <class T> struct dyn
 		return reinterpret_cast<uint64_t>(begin()) % 16 == 0;
 	}
 
+	bool isAlignedTo16Byte() const
+	{
+		return isSimdable();
+	}
+
 	bool isEmpty() const noexcept { return size() == 0; }
 
 	/** Returns the size of the array. Be aware that this is not a compile time constant. */
@@ -532,6 +532,8 @@ struct PolyHandler
 		// This byte structure is needed by the JIT compilation, so if the atomic
 		// wrappers add any overhead on a platform, this will fail compilation
 		static_assert(offsetof(PolyHandler, enabled) == 12, "misaligned poly handler");
+
+		releaseAllVoiceSlots();
 	}
 
 	/** Call this whenever you change something from the UI. It will make sure that
@@ -571,13 +573,19 @@ struct PolyHandler
 			{
 				jassert(p.currentAllThread != Thread::getCurrentThreadId());
 				p.voiceIndex = voiceIndex;
+
+				auto slot = p.acquireVoiceSlot(voiceIndex);
+				p.slotIndex = slot != -1 ? slot : RefusedVoiceSlot;
 			}
 		}
 
 		~ScopedVoiceSetter()
 		{
 			if (p.enabled != 0)
+			{
 				p.voiceIndex = -1;
+				p.slotIndex = -1;
+			}
 		}
 
 	private:
@@ -620,6 +628,95 @@ struct PolyHandler
 		return voiceIndex.load() * enabled;
 	}
 
+	/** The slot index of a voice that didn't get a slot because all slots are occupied. */
+	static constexpr int RefusedVoiceSlot = -2;
+
+	/** Returns the index of the slot that the current voice occupies in the compact voice storage
+	    (see CompactPolyData). Follows the same rules as getVoiceIndex() and returns RefusedVoiceSlot
+		if the current voice didn't get a slot. */
+	int getSlotIndex() const
+	{
+		if (currentAllThread != nullptr && Thread::getCurrentThreadId() == currentAllThread)
+			return -1 * enabled;
+
+		return slotIndex.load() * enabled;
+	}
+
+	/** Sets the number of slots for the compact voice storage. Call this before preparing the
+	    nodes with the amount of voices that can be active at the same time - the CompactPolyData
+		containers will allocate this amount of slots in their prepare() call. */
+	void setNumVoiceSlots(int newNumVoiceSlots)
+	{
+		numVoiceSlots = jlimit(1, NUM_POLYPHONIC_VOICES, newNumVoiceSlots);
+		numAllocatedVoiceSlots = numVoiceSlots;
+		releaseAllVoiceSlots();
+	}
+
+	/** Changes the number of slots without preparing the nodes again. This only works if the
+	    containers have allocated enough slots, otherwise it will return false and you need to 
+		call setNumVoiceSlots() and prepare the nodes. 
+		
+		Make sure that no voice is active and the audio thread is locked when calling this method. */
+	bool changeNumVoiceSlots(int newNumVoiceSlots)
+	{
+		newNumVoiceSlots = jlimit(1, NUM_POLYPHONIC_VOICES, newNumVoiceSlots);
+
+		if (newNumVoiceSlots > numAllocatedVoiceSlots)
+			return false;
+
+		numVoiceSlots = newNumVoiceSlots;
+		releaseAllVoiceSlots();
+		return true;
+	}
+
+	int getNumVoiceSlots() const { return numVoiceSlots; }
+
+	/** Returns the amount of slots that the containers have allocated in their last prepare() call. */
+	int getNumAllocatedVoiceSlots() const { return numAllocatedVoiceSlots; }
+
+	/** Assigns a slot to the voice. Returns false if all slots are occupied - in this case the voice
+	    must not be rendered (a ScopedVoiceSetter for this voice will set the slot index to RefusedVoiceSlot). */
+	bool tryAcquireVoiceSlot(int voiceIndexToUse)
+	{
+		return !enabled || acquireVoiceSlot(voiceIndexToUse) != -1;
+	}
+
+	/** Returns true if the voice currently occupies a slot. */
+	bool hasVoiceSlot(int voiceIndexToCheck) const
+	{
+		return !enabled || (isPositiveAndBelow(voiceIndexToCheck, NUM_POLYPHONIC_VOICES) && voiceToSlot[voiceIndexToCheck] != -1);
+	}
+
+	/** Returns the voice index that currently occupies the given slot or -1 if the slot is free. */
+	int getVoiceIndexForSlot(int slot) const
+	{
+		return isPositiveAndBelow(slot, numVoiceSlots) ? (int)slotToVoice[slot] : -1;
+	}
+
+	/** Call this when the voice has stopped so that its slot can be reused by the next voice. */
+	void releaseVoiceSlot(int voiceIndexToRelease)
+	{
+		if (!isPositiveAndBelow(voiceIndexToRelease, NUM_POLYPHONIC_VOICES))
+			return;
+
+		auto slot = voiceToSlot[voiceIndexToRelease];
+
+		if (slot != -1)
+		{
+			slotToVoice[slot] = -1;
+			voiceToSlot[voiceIndexToRelease] = -1;
+		}
+	}
+
+	void releaseAllVoiceSlots()
+	{
+		for (int i = 0; i < NUM_POLYPHONIC_VOICES; i++)
+		{
+			voiceToSlot[i] = -1;
+			slotToVoice[i] = -1;
+		}
+	}
+
 	bool isEnabled() const { return enabled; }
 
 	void setEnabled(bool shouldBeEnabled)
@@ -681,6 +778,11 @@ struct PolyHandler
 
 	DllBoundaryTempoSyncer* getTempoSyncer() { return tempoSyncer; }
 
+	/** Sets the worker pool that the parallel containers will use to process their branches. */
+	void setWorkerPool(hise::RealtimeWorkerPool* newWorkerPool) { workerPool.store(newWorkerPool); }
+
+	hise::RealtimeWorkerPool* getWorkerPool() const { return workerPool.load(); }
+
 private:
 
 	std::atomic<void*> currentAllThread = { nullptr }; // 0 byte offset
@@ -688,6 +790,39 @@ private:
 	int enabled;									   // 12 byte offset
 	WeakReference<VoiceResetter> vr = nullptr;		   // 16 byte offset
 	DllBoundaryTempoSyncer* tempoSyncer = nullptr;
+	std::atomic<hise::RealtimeWorkerPool*> workerPool = { nullptr };
+
+	/** Assigns the lowest free slot to the voice so that the active voices stay packed
+	    at the start of the compact storage. */
+	int acquireVoiceSlot(int voiceIndexToUse)
+	{
+		if (!isPositiveAndBelow(voiceIndexToUse, NUM_POLYPHONIC_VOICES))
+			return -1;
+
+		auto slot = voiceToSlot[voiceIndexToUse];
+
+		if (slot != -1)
+			return slot;
+
+		for (int i = 0; i < numVoiceSlots; i++)
+		{
+			if (slotToVoice[i] == -1)
+			{
+				slotToVoice[i] = (int16)voiceIndexToUse;
+				voiceToSlot[voiceIndexToUse] = (int16)i;
+				return i;
+			}
+		}
+
+		// More voices than slots are active, the voice will be refused
+		return -1;
+	}
+
+	std::atomic<int> slotIndex = { -1 };
+	int numVoiceSlots = NUM_POLYPHONIC_VOICES;
+	int numAllocatedVoiceSlots = NUM_POLYPHONIC_VOICES;
+	int16 voiceToSlot[NUM_POLYPHONIC_VOICES];
+	int16 slotToVoice[NUM_POLYPHONIC_VOICES];
 };
 
 
@@ -1036,6 +1171,239 @@ private:
 	T data[NumVoices];
 };
 
+/** A polyphonic data container that only allocates the data for the voices that can be active at the same time.
+    @ingroup snex_containers
+
+	This class has the same interface as PolyData and can be used as drop-in replacement:
+
+	@code
+	PolyData<MyState, NV> state;        // NUM_POLYPHONIC_VOICES * sizeof(MyState)
+	CompactPolyData<MyState, NV> state; // numVoiceSlots * sizeof(MyState)
+	@endcode
+
+	Instead of reserving one element for every voice index, it will allocate a cache-line aligned
+	pool with the amount of slots defined by PolyHandler::setNumVoiceSlots() in prepare(). 
+	The PolyHandler assigns the lowest free slot to a voice when it starts rendering, so the 
+	state of the active voices is packed at the start of the pool no matter which voice indexes 
+	the synthesiser picks.
+
+	The iteration rules are the same as with PolyData: outside of the voice rendering the for-loop
+	will iterate over all slots, inside the voice rendering only over the slot of the current voice.
+
+	If more voices are active than there are slots, the PolyHandler refuses the voice and the container 
+	will hand out a spare element at the end of the pool, so the refused voice never overwrites the state
+	of another voice.
+
+	Be aware that the slot of a voice might change after it was released by the PolyHandler, so you
+	must not rely on the state of a voice surviving its reset() call. Also this class is not available 
+	in SNEX JIT code (which will always use the PolyData layout).
+*/
+template <typename T, int NumVoices> struct CompactPolyData
+{
+	static constexpr int Alignment = 64;
+
+	CompactPolyData()
+	{
+		allocate(1);
+	}
+
+	CompactPolyData(T initValue)
+	{
+		allocate(1);
+		*slots = std::move(initValue);
+	}
+
+	CompactPolyData(const CompactPolyData& other)
+	{
+		*this = other;
+	}
+
+	~CompactPolyData()
+	{
+		deallocate();
+	}
+
+	CompactPolyData& operator=(const CompactPolyData& other)
+	{
+		if (this != &other)
+		{
+			voicePtr = other.voicePtr;
+			lastSlotIndex = other.lastSlotIndex;
+
+			allocate(other.numSlots);
+
+			for (int i = 0; i < numSlots; i++)
+				slots[i] = other.slots[i];
+		}
+
+		return *this;
+	}
+
+	/** Call this method with a PrepareSpecs object and it will setup the handling of the polyphony
+	    and allocate the slots for the amount of voices defined in the PolyHandler.
+		
+		If the type is copyable, the value of the first slot will be copied to all other slots, so an 
+		initial value that was passed into the constructor will survive the reallocation.
+	*/
+	void prepare(const PrepareSpecs& sp)
+	{
+		jassert(sp.voiceIndex != nullptr);
+		jassert(isPowerOfTwo(NumVoices));
+
+		voicePtr = sp.voiceIndex;
+
+		auto newNumSlots = voicePtr != nullptr ? voicePtr->getNumAllocatedVoiceSlots() : 1;
+
+		if (newNumSlots != numSlots)
+		{
+			if constexpr (std::is_copy_assignable<T>::value)
+			{
+				T firstValue(std::move(*slots));
+
+				allocate(newNumSlots);
+
+				// this includes the spare element for refused voices
+				for (int i = 0; i < numSlots + 1; i++)
+					slots[i] = firstValue;
+			}
+			else
+			{
+				allocate(newNumSlots);
+			}
+		}
+	}
+
+	void setAll(T&& value)
+	{
+		if (voicePtr == nullptr)
+		{
+			*slots = std::move(value);
+		}
+		else
+		{
+			for (auto& d : *this)
+				d = value;
+		}
+	}
+
+	/** Returns the data for the current voice. */
+	T& get() const
+	{
+		jassert(isMonophonicOrInsideVoiceRendering());
+		return *begin();
+	}
+
+	/** Allows range-based for loops to work inside the voice context. */
+	T* begin() const
+	{
+		lastSlotIndex = voicePtr != nullptr ? voicePtr->getSlotIndex() : -1;
+
+		if (lastSlotIndex == PolyHandler::RefusedVoiceSlot)
+			return slots + numSlots;
+
+		return slots + jmax(0, lastSlotIndex);
+	}
+
+	T* end() const
+	{
+		if (lastSlotIndex == PolyHandler::RefusedVoiceSlot)
+			return slots + numSlots + 1;
+
+		auto numToIterate = lastSlotIndex == -1 ? numSlots : 1;
+		return slots + jmax(0, lastSlotIndex) + numToIterate;
+	}
+
+	bool isFirst() const
+	{
+		return begin() == slots;
+	}
+
+	/** Returns a reference to the first data. This can be used for UI purposes. */
+	const T& getFirst() const
+	{
+		return *slots;
+	}
+
+	/** Returns the voice index that currently uses the given data or -1 if the slot is free. */
+	int getVoiceIndexForData(const T& d) const
+	{
+		auto slot = (int)(&d - slots);
+
+		if (voicePtr == nullptr)
+			return 0;
+
+		return voicePtr->getVoiceIndexForSlot(slot);
+	}
+
+	bool isMonophonicOrInsideVoiceRendering() const
+	{
+		if (voicePtr == nullptr)
+			return true;
+
+		return voicePtr->getSlotIndex() != -1;
+	}
+
+	int getNumSlots() const { return numSlots; }
+
+	/** Returns the amount of bytes that this container uses (including the pool). */
+	size_t getNumAllocatedBytes() const
+	{
+		return sizeof(*this) + storage.getSize();
+	}
+
+private:
+
+	void allocate(int newNumSlots)
+	{
+		deallocate();
+
+		numSlots = newNumSlots;
+
+		// one spare element for refused voices
+		storage.setSize(sizeof(T) * (size_t)(numSlots + 1) + Alignment, false);
+
+		auto address = reinterpret_cast<uintptr_t>(storage.getData());
+		auto alignedAddress = (address + Alignment - 1) & ~(uintptr_t)(Alignment - 1);
+
+		slots = reinterpret_cast<T*>(alignedAddress);
+
+		for (int i = 0; i < numSlots + 1; i++)
+			new (slots + i) T();
+	}
+
+	void deallocate()
+	{
+		if (slots != nullptr)
+		{
+			for (int i = 0; i < numSlots + 1; i++)
+				slots[i].~T();
+		}
+
+		slots = nullptr;
+		numSlots = 0;
+	}
+
+	PolyHandler* voicePtr = nullptr;
+	mutable int lastSlotIndex = -1;
+	int numSlots = 0;
+	T* slots = nullptr;
+	MemoryBlock storage;
+};
+
+/** The monophonic version of the CompactPolyData has no overhead at all. */
+template <typename T> struct CompactPolyData<T, 1> : public PolyData<T, 1>
+{
+	CompactPolyData() = default;
+
+	CompactPolyData(T initValue) :
+		PolyData<T, 1>(std::move(initValue))
+	{}
+
+	int getNumSlots() const { return 1; }
+
+	size_t getNumAllocatedBytes() const { return sizeof(*this); }
+};
+
 }
 
 
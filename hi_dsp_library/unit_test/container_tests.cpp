@@ -0,0 +1,343 @@
+/*  ===========================================================================
+*
+*   This file is part of HISE.
+*   Copyright 2016 Christoph Hart
+*
+*   HISE is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   HISE is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Commercial licenses for using HISE in an closed source project are
+*   available on request. Please visit the project's website to get more
+*   information about commercial licencing:
+*
+*   http://www.hartinstruments.net/hise/
+*
+*   HISE is based on the JUCE library,
+*   which also must be licenced for commercial applications:
+*
+*   http://www.juce.com
+*
+*   ===========================================================================
+*/
+
+
+#if HI_RUN_UNIT_TESTS
+
+namespace hise
+{
+
+namespace tests
+{
+
+using namespace juce;
+using namespace snex;
+using namespace snex::Types;
+
+class PolyDataBenchmark : public UnitTest
+{
+public:
+
+	PolyDataBenchmark() :
+		UnitTest("PolyData benchmark", "benchmark")
+	{}
+
+	void runTest() override
+	{
+		testCompactSlots();
+		testRefusedVoices();
+
+		for (auto numActiveVoices : { 4, 16, 64 })
+			testPerformance(numActiveVoices);
+	}
+
+private:
+
+	static constexpr int NumVoices = NUM_POLYPHONIC_VOICES;
+	static constexpr int NumNodes = 80;
+	static constexpr int NumVoiceSlots = 64;
+	static constexpr int BlockSize = 64;
+	static constexpr int NumBlocks = 500;
+
+	/** A typical voice state of a filter + envelope node. */
+	struct VoiceState
+	{
+		float coefficients[5] = { 0.2f, 0.3f, 0.2f, -0.1f, 0.05f };
+		float x1 = 0.0f, x2 = 0.0f, y1 = 0.0f, y2 = 0.0f;
+		float envelope = 1.0f;
+		float envelopeDelta = 0.99999f;
+		int counter = 0;
+	};
+
+	template <typename ContainerType> struct TestNode
+	{
+		void prepare(PrepareSpecs ps)
+		{
+			state.prepare(ps);
+		}
+
+		void reset()
+		{
+			for (auto& s : state)
+				s = VoiceState();
+		}
+
+		void process(float* data, int numSamples)
+		{
+			auto& s = state.get();
+
+			for (int i = 0; i < numSamples; i++)
+			{
+				auto x = data[i];
+				auto y = s.coefficients[0] * x + s.coefficients[1] * s.x1 + s.coefficients[2] * s.x2 
+					   - s.coefficients[3] * s.y1 - s.coefficients[4] * s.y2;
+
+				s.x2 = s.x1;
+				s.x1 = x;
+				s.y2 = s.y1;
+				s.y1 = y;
+				s.envelope *= s.envelopeDelta;
+
+				data[i] = y * s.envelope;
+			}
+
+			s.counter++;
+		}
+
+		ContainerType state;
+	};
+
+	template <typename T, int N> static size_t getNumBytes(const PolyData<T, N>& d) { return sizeof(d); }
+	template <typename T, int N> static size_t getNumBytes(const CompactPolyData<T, N>& d) { return d.getNumAllocatedBytes(); }
+
+	static Array<int> createVoiceIndexes(int numActiveVoices)
+	{
+		// The synthesiser might pick any voice index so we spread them across the entire range
+		Random r(numActiveVoices);
+		Array<int> indexes;
+
+		while (indexes.size() < numActiveVoices)
+			indexes.addIfNotAlreadyThere(r.nextInt(NumVoices));
+
+		return indexes;
+	}
+
+	template <typename ContainerType> double render(const Array<int>& voiceIndexes, float& result, size_t& numBytes)
+	{
+		PolyHandler ph(true);
+		ph.setNumVoiceSlots(NumVoiceSlots);
+
+		PrepareSpecs ps;
+		ps.sampleRate = 44100.0;
+		ps.blockSize = BlockSize;
+		ps.numChannels = 1;
+		ps.voiceIndex = &ph;
+
+		std::vector<TestNode<ContainerType>> nodes(NumNodes);
+
+		numBytes = 0;
+
+		for (auto& n : nodes)
+		{
+			n.prepare(ps);
+			n.reset();
+			numBytes += getNumBytes(n.state);
+		}
+
+		for (auto v : voiceIndexes)
+		{
+			PolyHandler::ScopedVoiceSetter vs(ph, v);
+
+			for (auto& n : nodes)
+				n.reset();
+		}
+
+		float buffer[BlockSize];
+		result = 0.0f;
+
+		auto start = Time::getHighResolutionTicks();
+
+		for (int b = 0; b < NumBlocks; b++)
+		{
+			for (auto v : voiceIndexes)
+			{
+				PolyHandler::ScopedVoiceSetter vs(ph, v);
+
+				for (int i = 0; i < BlockSize; i++)
+					buffer[i] = (float)((i + b) % 7) * 0.1f;
+
+				for (auto& n : nodes)
+					n.process(buffer, BlockSize);
+
+				result += buffer[BlockSize - 1];
+			}
+		}
+
+		auto delta = Time::highResolutionTicksToSeconds(Time::getHighResolutionTicks() - start);
+
+		return delta / (double)(NumBlocks * voiceIndexes.size());
+	}
+
+	void testCompactSlots()
+	{
+		beginTest("Test compact slot assignment");
+
+		PolyHandler ph(true);
+		ph.setNumVoiceSlots(8);
+
+		PrepareSpecs ps;
+		ps.sampleRate = 44100.0;
+		ps.blockSize = 512;
+		ps.numChannels = 2;
+		ps.voiceIndex = &ph;
+
+		CompactPolyData<int, NumVoices> data(5);
+		data.prepare(ps);
+
+		expectEquals(data.getNumSlots(), 8, "slot amount mismatch");
+
+		int numIterated = 0;
+
+		for (auto& d : data)
+		{
+			expectEquals(d, 5, "initial value not copied");
+			d = 0;
+			numIterated++;
+		}
+
+		expectEquals(numIterated, 8, "iteration outside voice rendering");
+
+		{
+			PolyHandler::ScopedVoiceSetter vs(ph, 200);
+			expect(data.isFirst(), "first voice should use the first slot");
+			expectEquals(data.getVoiceIndexForData(data.get()), 200, "voice index mismatch");
+			data.get() = 200;
+		}
+
+		{
+			PolyHandler::ScopedVoiceSetter vs(ph, 17);
+			expect(!data.isFirst(), "second voice should use the second slot");
+			data.get() = 17;
+		}
+
+		{
+			PolyHandler::ScopedVoiceSetter vs(ph, 200);
+			expectEquals(data.get(), 200, "voice state not persistent");
+		}
+
+		ph.releaseVoiceSlot(200);
+
+		{
+			PolyHandler::ScopedVoiceSetter vs(ph, 99);
+			expect(data.isFirst(), "released slot should be reused");
+		}
+
+		{
+			PolyHandler::ScopedVoiceSetter vs(ph, 17);
+			expectEquals(data.get(), 17, "other voice was changed");
+		}
+	}
+
+	void testRefusedVoices()
+	{
+		beginTest("Test refused voices");
+
+		PolyHandler ph(true);
+		ph.setNumVoiceSlots(2);
+
+		PrepareSpecs ps;
+		ps.sampleRate = 44100.0;
+		ps.blockSize = 512;
+		ps.numChannels = 2;
+		ps.voiceIndex = &ph;
+
+		CompactPolyData<int, NumVoices> data(0);
+		data.prepare(ps);
+
+		expect(ph.tryAcquireVoiceSlot(10), "first voice should get a slot");
+		expect(ph.tryAcquireVoiceSlot(20), "second voice should get a slot");
+		expect(!ph.tryAcquireVoiceSlot(30), "third voice should be refused");
+		expect(!ph.hasVoiceSlot(30), "refused voice has a slot");
+
+		{
+			PolyHandler::ScopedVoiceSetter vs(ph, 10);
+			data.get() = 10;
+		}
+
+		{
+			PolyHandler::ScopedVoiceSetter vs(ph, 20);
+			data.get() = 20;
+		}
+
+		{
+			PolyHandler::ScopedVoiceSetter vs(ph, 30);
+			expectEquals(ph.getSlotIndex(), (int)PolyHandler::RefusedVoiceSlot, "refused slot index");
+
+			for (auto& d : data)
+				d = 30;
+		}
+
+		int numIterated = 0;
+
+		for (auto& d : data)
+		{
+			expect(d != 30, "refused voice overwrote another voice");
+			numIterated++;
+		}
+
+		expectEquals(numIterated, 2, "spare element must not be iterated");
+
+		expect(!ph.changeNumVoiceSlots(4), "growing must require a prepare call");
+		expectEquals(ph.getNumVoiceSlots(), 2, "failed change should keep the slot amount");
+
+		expect(ph.changeNumVoiceSlots(1), "shrinking should work without prepare");
+		expectEquals(ph.getNumAllocatedVoiceSlots(), 2, "shrinking must keep the allocation");
+		expect(ph.tryAcquireVoiceSlot(30), "slots must be released after the change");
+		expect(!ph.tryAcquireVoiceSlot(10), "only one slot should be available");
+
+		ph.setNumVoiceSlots(4);
+		data.prepare(ps);
+		expectEquals(data.getNumSlots(), 4, "prepare should reallocate the slots");
+	}
+
+	void testPerformance(int numActiveVoices)
+	{
+		String name;
+		name << String(numActiveVoices) << " active voices, " << String(NumNodes) << " nodes";
+
+		beginTest(name);
+
+		auto voiceIndexes = createVoiceIndexes(numActiveVoices);
+
+		float polyResult, compactResult;
+		size_t polyBytes, compactBytes;
+
+		auto polyTime = render<PolyData<VoiceState, NumVoices>>(voiceIndexes, polyResult, polyBytes);
+		auto compactTime = render<CompactPolyData<VoiceState, NumVoices>>(voiceIndexes, compactResult, compactBytes);
+
+		expectEquals(compactResult, polyResult, "result mismatch");
+
+		String m;
+		m << "PolyData:        " << String(polyBytes / 1024) << "kB, " << String(polyTime * 1000000.0, 2) << "us per voice\n";
+		m << "CompactPolyData: " << String(compactBytes / 1024) << "kB, " << String(compactTime * 1000000.0, 2) << "us per voice";
+
+		logMessage(m);
+	}
+};
+
+static PolyDataBenchmark polyDataBenchmark;
+
+}
+
+}
+
+#endif
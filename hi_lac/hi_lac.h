@@ -91,6 +91,17 @@ version that runs on legacy CPU models.
 #define HI_ENABLE_LEGACY_CPU_SUPPORT 0
 #endif
 
+//=============================================================================
+/** Config: HLAC_USE_SIMD_DECODER
+
+If enabled, then the bit compressors use SSE2 kernels to unpack the compressed values.
+This is disabled by default if the legacy CPU support is enabled and on ARM (this module
+can't use the SSE wrapper from hi_tools, so it falls back to the scalar decoder there).
+*/
+#ifndef HLAC_USE_SIMD_DECODER
+#define HLAC_USE_SIMD_DECODER (!HI_ENABLE_LEGACY_CPU_SUPPORT && !JUCE_ARM)
+#endif
+
 //=============================================================================
 /** Config: HLAC_MEASURE_DECODING_PERFORMANCE
 
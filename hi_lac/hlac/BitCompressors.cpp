@@ -30,6 +30,10 @@
  *   ===========================================================================
  */
 
+#if HLAC_USE_SIMD_DECODER
+#include <emmintrin.h>
+#endif
+
 namespace hlac { using namespace juce; 
 
 void printRuler()
@@ -71,21 +75,6 @@ uint16 compressInt16(int16 input, int bitDepth)
 	return (uint16)((int)input + a);
 }
 
-#if USE_SSE
-void compressInt16Block(int16* input, int16* output, int bitDepth, int numToCompress)
-{
-	auto inputIpp = reinterpret_cast<Ipp16u*>(input);
-	auto outputIpp = reinterpret_cast<Ipp16u*>(output);
-
-	const uint16 signMask = 0b1000000000000000;
-
-	ippsAbs_16s(input, output, numToCompress);
-	ippsAndC_16u_I(signMask, inputIpp, numToCompress);
-	ippsRShiftC_16s_I(16 - bitDepth, input, numToCompress);
-	ippsOr_16u_I(inputIpp, outputIpp, numToCompress);
-}
-#endif
-
 constexpr uint16 getBitMask(int bitDepth) { return (1 << (bitDepth - 1)) - 1; }
 
 int16 decompressUInt16(uint16 input, int bitDepth)
@@ -94,25 +83,6 @@ int16 decompressUInt16(uint16 input, int bitDepth)
 	return (int16)input - sub;
 }
 
-#if USE_SSE
-void decompressInt16Block(int16* input, int16* output, uint8 bitDepth, int numToCompress)
-{
-	auto ippInput = reinterpret_cast<Ipp16u*>(input);
-	auto ippOutput = reinterpret_cast<Ipp16u*>(output);
-
-	const uint16 signMask = 0b0000000000000010;
-	const uint16 valueMask = 0b0000011111111111;
-	const uint8 shiftAmount = bitDepth - 2;
-
-	ippsAndC_16u(ippInput, valueMask, ippOutput, numToCompress);
-	ippsRShiftC_16u_I(shiftAmount, ippInput, numToCompress);
-	ippsAndC_16u_I(signMask, ippInput, numToCompress);
-	ippsMulC_16s_I(-1, input, numToCompress);
-	ippsAddC_16s_I(1, input, numToCompress);
-	ippsMul_16s_I(input, output, numToCompress);
-}
-#endif
-
 void packArrayOfInt16(int16* d, int numValues, uint8 bitDepth)
 {
 	for (int i = 0; i < numValues; i++)
@@ -221,7 +191,7 @@ bool BitCompressors::OneBit::compress(uint8* destination, const int16* data, int
 
 
 
-bool BitCompressors::OneBit::decompress(int16* destination, const uint8* data, int numValuesToDecompress)
+bool BitCompressors::OneBit::decompressScalar(int16* destination, const uint8* data, int numValuesToDecompress)
 {
 	const uint8 masks[8] = { 0b00000001, 0b00000010, 0b00000100, 0b00001000,
 		0b00010000, 0b00100000, 0b01000000, 0b10000000 };
@@ -316,7 +286,7 @@ bool BitCompressors::TwoBit::compress(uint8* destination, const int16* data, int
 	return true;
 }
 
-bool BitCompressors::TwoBit::decompress(int16* destination, const uint8* data, int numValuesToDecompress)
+bool BitCompressors::TwoBit::decompressScalar(int16* destination, const uint8* data, int numValuesToDecompress)
 {
 	const uint8 signMasks[4] =  { 0b00000010, 0b00001000, 0b00100000, 0b10000000 };
 	const uint8 valueMasks[4] = { 0b00000001, 0b00000100, 0b00010000, 0b01000000 };
@@ -429,7 +399,7 @@ bool BitCompressors::FourBit::compress(uint8* destination, const int16* data, in
 	return true;
 }
 
-bool BitCompressors::FourBit::decompress(int16* destination, const uint8* data, int numValuesToDecompress)
+bool BitCompressors::FourBit::decompressScalar(int16* destination, const uint8* data, int numValuesToDecompress)
 {
 	
 
@@ -541,7 +511,7 @@ bool BitCompressors::SixBit::compress(uint8* destination, const int16* data, int
 	return true;
 }
 
-bool BitCompressors::SixBit::decompress(int16* destination, const uint8* data, int numValuesToDecompress)
+bool BitCompressors::SixBit::decompressScalar(int16* destination, const uint8* data, int numValuesToDecompress)
 {
 #if JUCE_IOS
 	while (numValuesToDecompress >= 8)
@@ -701,7 +671,7 @@ bool BitCompressors::EightBit::compress(uint8* destination, const int16* data, i
 	return true;
 }
 
-bool BitCompressors::EightBit::decompress(int16* destination, const uint8* data, int numValuesToDecompress)
+bool BitCompressors::EightBit::decompressScalar(int16* destination, const uint8* data, int numValuesToDecompress)
 {
     while (--numValuesToDecompress >= 0)
 	{
@@ -788,7 +758,7 @@ bool BitCompressors::TenBit::compress(uint8* destination, const int16* data, int
 	return true;
 }
 
-bool BitCompressors::TenBit::decompress(int16* destination, const uint8* data, int numValuesToDecompress)
+bool BitCompressors::TenBit::decompressScalar(int16* destination, const uint8* data, int numValuesToDecompress)
 {
 	while (numValuesToDecompress >= 8)
 	{
@@ -846,44 +816,8 @@ bool BitCompressors::TwelveBit::compress(uint8* destination, const int16* data,
 	return true;
 }
 
-bool BitCompressors::TwelveBit::decompress(int16* destination, const uint8* data, int numValuesToDecompress)
+bool BitCompressors::TwelveBit::decompressScalar(int16* destination, const uint8* data, int numValuesToDecompress)
 {
-#if USE_SSE
-
-	const int numInBlockProcessing = numValuesToDecompress - (numValuesToDecompress % 4);
-
-	int16* alignedDestination = (int16*)ippAlignPtr(destination, 32);
-	jassert(alignedDestination == destination);
-	uint16* dst = scratchBuffer;
-
-
-	while (numValuesToDecompress >= 4)
-	{
-		const uint16* dataBlock = reinterpret_cast<const uint16*>(data);
-
-		dst[0] = (dataBlock[0] & 0b1111111111110000) >> 4;
-		dst[1] = (dataBlock[0] & 0b0000000000001111) << 8;
-		dst[1] |= (dataBlock[1] & 0b1111111100000000) >> 8;
-		dst[2] = (dataBlock[1] & 0b0000000011111111) << 4;
-		dst[2] |= (dataBlock[2] & 0b1111000000000000) >> 12;
-		dst[3] = (dataBlock[2] & 0b0000111111111111);
-
-		//dst[0] = decompressUInt16(dst[0], 12);
-		//dst[1] = decompressUInt16(dst[1], 12);
-		//dst[2] = decompressUInt16(dst[2], 12);
-		//dst[3] = decompressUInt16(dst[3], 12);
-
-		numValuesToDecompress -= 4;
-		dst += 4;
-		data += 6;
-
-	}
-
-	decompressInt16Block((int16*)scratchBuffer, destination, 12, numInBlockProcessing);
-	destination += numInBlockProcessing;
-
-#else
-
 	int16* dst = destination;
 
 	while (numValuesToDecompress >= 4)
@@ -912,10 +846,6 @@ bool BitCompressors::TwelveBit::decompress(int16* destination, const uint8* data
 
 	memcpy(destination, data, sizeof(int16) * numValuesToDecompress);
 
-#endif
-
-	
-
 	return true;
 }
 
@@ -1000,7 +930,7 @@ bool BitCompressors::FourteenBit::compress(uint8* destination, const int16* data
 	return true;
 }
 
-bool BitCompressors::FourteenBit::decompress(int16* destination, const uint8* data, int numValuesToDecompress)
+bool BitCompressors::FourteenBit::decompressScalar(int16* destination, const uint8* data, int numValuesToDecompress)
 {
 	while (numValuesToDecompress >= 8)
 	{
@@ -1049,6 +979,275 @@ int BitCompressors::SixteenBit::getByteAmount(int numValuesToCompress)
 	return numValuesToCompress * sizeof(int16);
 }
 
+#if HLAC_USE_SIMD_DECODER
+
+/** The SIMD kernels for the decompression of the bit compressors.
+
+	Each kernel decodes as many values as it can and returns the number of decoded values. The remaining values
+	(and the uncompressed remainder of the packed formats) are decoded by the scalar implementation.
+*/
+namespace SIMDUnpack
+{
+static inline __m128i applySign(__m128i value, __m128i sign)
+{
+	return _mm_sub_epi16(_mm_xor_si128(value, sign), sign);
+}
+
+static inline void store(int16* destination, __m128i values)
+{
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(destination), values);
+}
+
+static int oneBit(int16* destination, const uint8* data, int numValues)
+{
+	const __m128i masks = _mm_setr_epi16(1, 2, 4, 8, 16, 32, 64, 128);
+
+	int numDone = 0;
+
+	for (; numValues - numDone >= 8; numDone += 8)
+	{
+		auto v = _mm_and_si128(_mm_set1_epi16(*data++), masks);
+		store(destination + numDone, _mm_srli_epi16(_mm_cmpeq_epi16(v, masks), 15));
+	}
+
+	return numDone;
+}
+
+static int twoBit(int16* destination, const uint8* data, int numValues)
+{
+	const __m128i valueMasks = _mm_setr_epi16(0x0001, 0x0004, 0x0010, 0x0040, 0x0100, 0x0400, 0x1000, 0x4000);
+	const __m128i signMasks = _mm_slli_epi16(valueMasks, 1);
+
+	int numDone = 0;
+
+	for (; numValues - numDone >= 8; numDone += 8)
+	{
+		const auto x = _mm_set1_epi16((int16)(data[0] | (data[1] << 8)));
+
+		auto value = _mm_srli_epi16(_mm_cmpeq_epi16(_mm_and_si128(x, valueMasks), valueMasks), 15);
+		auto sign = _mm_cmpeq_epi16(_mm_and_si128(x, signMasks), signMasks);
+
+		store(destination + numDone, applySign(value, sign));
+		data += 2;
+	}
+
+	return numDone;
+}
+
+static int fourBit(int16* destination, const uint8* data, int numValues)
+{
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i nibbleMask = _mm_set1_epi16(0x0F);
+	const __m128i valueMask = _mm_set1_epi16(0x07);
+	const __m128i signMask = _mm_set1_epi16(0x08);
+
+	auto decode = [&](__m128i x)
+	{
+		auto sign = _mm_cmpeq_epi16(_mm_and_si128(x, signMask), signMask);
+		return applySign(_mm_and_si128(x, valueMask), sign);
+	};
+
+	int numDone = 0;
+
+	for (; numValues - numDone >= 16; numDone += 16)
+	{
+		auto bytes = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(data)), zero);
+		auto lo = _mm_and_si128(bytes, nibbleMask);
+		auto hi = _mm_srli_epi16(bytes, 4);
+
+		store(destination + numDone, decode(_mm_unpacklo_epi16(lo, hi)));
+		store(destination + numDone + 8, decode(_mm_unpackhi_epi16(lo, hi)));
+		data += 8;
+	}
+
+	return numDone;
+}
+
+static int eightBit(int16* destination, const uint8* data, int numValues)
+{
+	int numDone = 0;
+
+	for (; numValues - numDone >= 16; numDone += 16)
+	{
+		auto x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+
+		store(destination + numDone, _mm_srai_epi16(_mm_unpacklo_epi8(x, x), 8));
+		store(destination + numDone + 8, _mm_srai_epi16(_mm_unpackhi_epi8(x, x), 8));
+		data += 16;
+	}
+
+	return numDone;
+}
+
+/** The bit layout of the packed formats (6, 10, 12 and 14 bit).
+
+	Eight values are stored in BitDepth bytes as a big endian bit stream of uint16 words. The value k starts at the bit
+	BitDepth * k, so it's the upper part of the word getHiIndex(k) shifted by getShift(k) bits plus the lower part of the
+	word getLoIndex(k) if it crosses the word boundary.
+*/
+template <int BitDepth> struct PackedLayout
+{
+	static constexpr int getHiIndex(int k) { return (BitDepth * k) / 16; }
+	static constexpr int getShift(int k) { return (BitDepth * k) % 16; }
+	static constexpr int getLoIndex(int k) { return getShift(k) + BitDepth > 16 ? getHiIndex(k) + 1 : getHiIndex(k); }
+
+	/** The first word of the four words that are loaded for the lanes 0-3 and 4-7. */
+	static constexpr int getBaseIndex(int k) { return getHiIndex(k < 4 ? 0 : 4); }
+
+	static constexpr int getSelector(bool lo, int k) { return (lo ? getLoIndex(k) : getHiIndex(k)) - getBaseIndex(k); }
+
+	/** Returns the immediate for _mm_shufflelo_epi16 / _mm_shufflehi_epi16 that moves the words into the lanes. */
+	static constexpr int getShuffle(bool lo, int firstLane)
+	{
+		return getSelector(lo, firstLane) |
+			  (getSelector(lo, firstLane + 1) << 2) |
+			  (getSelector(lo, firstLane + 2) << 4) |
+			  (getSelector(lo, firstLane + 3) << 6);
+	}
+
+	static constexpr bool isValid()
+	{
+		return getSelector(true, 3) <= 3 && getSelector(true, 7) <= 3;
+	}
+};
+
+/** Decodes the packed formats. This reads up to 4 bytes after the current group, so it stops
+	before the last group (the data is followed by at least one more group of BitDepth bytes).
+*/
+template <int BitDepth> static int packed(int16* destination, const uint8* data, int numValues)
+{
+	using Layout = PackedLayout<BitDepth>;
+
+	static_assert(Layout::isValid(), "the words of a lane must be within the loaded words");
+
+	constexpr int hiShuffleLo = Layout::getShuffle(false, 0);
+	constexpr int hiShuffleHi = Layout::getShuffle(false, 4);
+	constexpr int loShuffleLo = Layout::getShuffle(true, 0);
+	constexpr int loShuffleHi = Layout::getShuffle(true, 4);
+
+	const __m128i factors = _mm_setr_epi16((int16)(1 << Layout::getShift(0)), (int16)(1 << Layout::getShift(1)),
+										   (int16)(1 << Layout::getShift(2)), (int16)(1 << Layout::getShift(3)),
+										   (int16)(1 << Layout::getShift(4)), (int16)(1 << Layout::getShift(5)),
+										   (int16)(1 << Layout::getShift(6)), (int16)(1 << Layout::getShift(7)));
+
+	const __m128i offset = _mm_set1_epi16((int16)getBitMask(BitDepth));
+
+	int numDone = 0;
+
+	for (; numValues - numDone >= 16; numDone += 8)
+	{
+		auto words = _mm_unpacklo_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(data + 2 * Layout::getBaseIndex(0))),
+										_mm_loadl_epi64(reinterpret_cast<const __m128i*>(data + 2 * Layout::getBaseIndex(4))));
+
+		auto hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(words, hiShuffleLo), hiShuffleHi);
+		auto lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(words, loShuffleLo), loShuffleHi);
+
+		// (hi << shift) | (lo >> (16 - shift)) as 16 bit operation
+		auto v = _mm_or_si128(_mm_mullo_epi16(hi, factors), _mm_mulhi_epu16(lo, factors));
+
+		v = _mm_sub_epi16(_mm_srli_epi16(v, 16 - BitDepth), offset);
+
+		store(destination + numDone, v);
+		data += BitDepth;
+	}
+
+	return numDone;
+}
+
+template <typename KernelFunction> static bool decompress(BitCompressors::Base& compressor, const KernelFunction& kernel, int16* destination, const uint8* data, int numValues)
+{
+	const int numDone = kernel(destination, data, numValues);
+
+	return compressor.decompressScalar(destination + numDone, data + compressor.getByteAmount(numDone), numValues - numDone);
+}
+
+} // namespace SIMDUnpack
+
+bool BitCompressors::OneBit::decompress(int16* destination, const uint8* data, int numValuesToDecompress)
+{
+	return SIMDUnpack::decompress(*this, SIMDUnpack::oneBit, destination, data, numValuesToDecompress);
+}
+
+bool BitCompressors::TwoBit::decompress(int16* destination, const uint8* data, int numValuesToDecompress)
+{
+	return SIMDUnpack::decompress(*this, SIMDUnpack::twoBit, destination, data, numValuesToDecompress);
+}
+
+bool BitCompressors::FourBit::decompress(int16* destination, const uint8* data, int numValuesToDecompress)
+{
+	return SIMDUnpack::decompress(*this, SIMDUnpack::fourBit, destination, data, numValuesToDecompress);
+}
+
+bool BitCompressors::SixBit::decompress(int16* destination, const uint8* data, int numValuesToDecompress)
+{
+	return SIMDUnpack::decompress(*this, SIMDUnpack::packed<6>, destination, data, numValuesToDecompress);
+}
+
+bool BitCompressors::EightBit::decompress(int16* destination, const uint8* data, int numValuesToDecompress)
+{
+	return SIMDUnpack::decompress(*this, SIMDUnpack::eightBit, destination, data, numValuesToDecompress);
+}
+
+bool BitCompressors::TenBit::decompress(int16* destination, const uint8* data, int numValuesToDecompress)
+{
+	return SIMDUnpack::decompress(*this, SIMDUnpack::packed<10>, destination, data, numValuesToDecompress);
+}
+
+bool BitCompressors::TwelveBit::decompress(int16* destination, const uint8* data, int numValuesToDecompress)
+{
+	return SIMDUnpack::decompress(*this, SIMDUnpack::packed<12>, destination, data, numValuesToDecompress);
+}
+
+bool BitCompressors::FourteenBit::decompress(int16* destination, const uint8* data, int numValuesToDecompress)
+{
+	return SIMDUnpack::decompress(*this, SIMDUnpack::packed<14>, destination, data, numValuesToDecompress);
+}
+
+#else
+
+bool BitCompressors::OneBit::decompress(int16* destination, const uint8* data, int numValuesToDecompress)
+{
+	return decompressScalar(destination, data, numValuesToDecompress);
+}
+
+bool BitCompressors::TwoBit::decompress(int16* destination, const uint8* data, int numValuesToDecompress)
+{
+	return decompressScalar(destination, data, numValuesToDecompress);
+}
+
+bool BitCompressors::FourBit::decompress(int16* destination, const uint8* data, int numValuesToDecompress)
+{
+	return decompressScalar(destination, data, numValuesToDecompress);
+}
+
+bool BitCompressors::SixBit::decompress(int16* destination, const uint8* data, int numValuesToDecompress)
+{
+	return decompressScalar(destination, data, numValuesToDecompress);
+}
+
+bool BitCompressors::EightBit::decompress(int16* destination, const uint8* data, int numValuesToDecompress)
+{
+	return decompressScalar(destination, data, numValuesToDecompress);
+}
+
+bool BitCompressors::TenBit::decompress(int16* destination, const uint8* data, int numValuesToDecompress)
+{
+	return decompressScalar(destination, data, numValuesToDecompress);
+}
+
+bool BitCompressors::TwelveBit::decompress(int16* destination, const uint8* data, int numValuesToDecompress)
+{
+	return decompressScalar(destination, data, numValuesToDecompress);
+}
+
+bool BitCompressors::FourteenBit::decompress(int16* destination, const uint8* data, int numValuesToDecompress)
+{
+	return decompressScalar(destination, data, numValuesToDecompress);
+}
+
+#endif
+
+
 
 
 
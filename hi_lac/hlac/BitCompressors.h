@@ -38,13 +38,6 @@ namespace hlac { using namespace juce;
 
 #define LOG_RATIO(x) 
 
-#define USE_SSE 0
-
-
-#if USE_SSE
-#include <ipp.h>
-#endif
-
 struct BitCompressors
 {
 	struct Base
@@ -54,6 +47,10 @@ struct BitCompressors
 		virtual int getAllowedBitRange() const { return -1; };
 		virtual bool compress(uint8* destination, const int16* data, int numValues) { ignoreUnused(destination, data, numValues); return false; }
 		virtual bool decompress(int16* destination, const uint8* data, int numValuesToDecompress) { ignoreUnused(destination, data, numValuesToDecompress); return false; }
+
+		/** Decompresses the data without the SIMD unpack kernels. This is used as reference for the SIMD implementation. */
+		virtual bool decompressScalar(int16* destination, const uint8* data, int numValuesToDecompress) { return decompress(destination, data, numValuesToDecompress); }
+
 		virtual int getByteAmount(int numValuesToCompress) { ignoreUnused(numValuesToCompress); return 0; };
 	};
 
@@ -118,6 +115,7 @@ struct BitCompressors
 		int getAllowedBitRange() const override;
 		bool compress(uint8* destination, const int16* data, int numValues) override;;
 		bool decompress(int16* destination, const uint8* data, int numValuesToDecompress) override;;
+		bool decompressScalar(int16* destination, const uint8* data, int numValuesToDecompress) override;
 		int getByteAmount(int numValuesToCompress) override;;
 		
 	};
@@ -127,6 +125,7 @@ struct BitCompressors
 		int getAllowedBitRange() const override;
 		bool compress(uint8* destination, const int16* data, int numValues) override;
 		bool decompress(int16* destination, const uint8* data, int numValuesToDecompress) override;
+		bool decompressScalar(int16* destination, const uint8* data, int numValuesToDecompress) override;
 		int getByteAmount(int numValuesToCompress) override;
 	};
 
@@ -135,6 +134,7 @@ struct BitCompressors
 		int getAllowedBitRange() const override;
 		bool compress(uint8* destination, const int16* data, int numValues) override;
 		bool decompress(int16* destination, const uint8* data, int numValuesToDecompress) override;
+		bool decompressScalar(int16* destination, const uint8* data, int numValuesToDecompress) override;
 		int getByteAmount(int numValuesToCompress) override;
 	};
 
@@ -143,6 +143,7 @@ struct BitCompressors
 		int getAllowedBitRange() const override;
 		bool compress(uint8* destination, const int16* data, int numValues) override;
 		bool decompress(int16* destination, const uint8* data, int numValuesToDecompress) override;
+		bool decompressScalar(int16* destination, const uint8* data, int numValuesToDecompress) override;
 		int getByteAmount(int numValuesToCompress) override;
 	};
 
@@ -151,6 +152,7 @@ struct BitCompressors
 		int getAllowedBitRange() const override;
 		bool compress(uint8* destination, const int16* data, int numValues) override;
 		bool decompress(int16* destination, const uint8* data, int numValuesToDecompress) override;
+		bool decompressScalar(int16* destination, const uint8* data, int numValuesToDecompress) override;
 		int getByteAmount(int numValuesToCompress) override;
 	};
 
@@ -159,35 +161,17 @@ struct BitCompressors
 		int getAllowedBitRange() const override;
 		bool compress(uint8* destination, const int16* data, int numValues) override;
 		bool decompress(int16* destination, const uint8* data, int numValuesToDecompress) override;
+		bool decompressScalar(int16* destination, const uint8* data, int numValuesToDecompress) override;
 		int getByteAmount(int numValuesToCompress) override;
 	};
 
 	struct TwelveBit : public Base
 	{
-#if USE_SSE
-		TwelveBit()
-		{
-			scratchBuffer = ippsMalloc_16u(16383);
-			scratchBuffer2 = ippsMalloc_16u(16383);
-		}
-
-		~TwelveBit()
-		{
-			ippsFree(scratchBuffer);
-			ippsFree(scratchBuffer2);
-		}
-#endif
-
 		int getAllowedBitRange() const override;
 		bool compress(uint8* destination, const int16* data, int numValues) override;
 		bool decompress(int16* destination, const uint8* data, int numValuesToDecompress) override;
+		bool decompressScalar(int16* destination, const uint8* data, int numValuesToDecompress) override;
 		int getByteAmount(int numValuesToCompress) override;
-
-#if USE_SSE
-		Ipp16u* scratchBuffer;
-		Ipp16u* scratchBuffer2;
-#endif
-
 	};
 
 	struct FourteenBit : public Base
@@ -195,6 +179,7 @@ struct BitCompressors
 		int getAllowedBitRange() const override;
 		bool compress(uint8* destination, const int16* data, int numValues) override;
 		bool decompress(int16* destination, const uint8* data, int numValuesToDecompress) override;
+		bool decompressScalar(int16* destination, const uint8* data, int numValuesToDecompress) override;
 		int getByteAmount(int numValuesToCompress) override;
 	};
 
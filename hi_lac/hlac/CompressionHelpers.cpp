@@ -1173,6 +1173,448 @@ var HlacArchiver::readMetadataFromArchive(const File& sourceFile)
 	return var();
 }
 
+struct HlacArchiver::ExtractionState
+{
+	/** The preallocated memory of all parallel HLAC writers will not exceed this limit. */
+	static constexpr int64 MaxPreallocatedBytes = (int64)2 * 1024 * 1024 * 1024;
+
+	struct Stage
+	{
+		void add(int64 numBytesToAdd, int64 numTicksToAdd)
+		{
+			numBytes += numBytesToAdd;
+			numTicks += numTicksToAdd;
+		}
+
+		String toString(const String& name) const
+		{
+			auto seconds = Time::highResolutionTicksToSeconds(numTicks.load());
+			auto megabytes = (double)numBytes.load() / 1024.0 / 1024.0;
+
+			return name + ": " + String(seconds > 0.0 ? megabytes / seconds : 0.0, 1) + " MB/s";
+		}
+
+		std::atomic<int64> numBytes = { 0 };
+		std::atomic<int64> numTicks = { 0 };
+	};
+
+	/** The amount of archive data that was read for a monolith, a part file or the entire archive. */
+	struct Progress
+	{
+		double get() const
+		{
+			return numBytes > 0 ? jlimit(0.0, 1.0, (double)numBytesProcessed.load() / (double)numBytes) : 1.0;
+		}
+
+		bool isFinished() const { return numBytesProcessed.load() >= numBytes; }
+
+		int64 numBytes = 0;
+		std::atomic<int64> numBytesProcessed = { 0 };
+	};
+
+	ExtractionState(const Array<MonolithInfo>& monolithList, int numParts)
+	{
+		for (int i = 0; i < numParts; i++)
+			parts.add(new Progress());
+
+		for (const auto& m : monolithList)
+		{
+			monoliths.add(new Progress())->numBytes = m.numBytes;
+			total.numBytes += m.numBytes;
+
+			firstSegmentIndexes.add(segments.size());
+
+			for (const auto& s : m.segments)
+			{
+				segments.add(new Progress())->numBytes = s.numBytes;
+				parts[s.partIndex]->numBytes += s.numBytes;
+			}
+		}
+	}
+
+	/** Called by the MonolithInputStream whenever it has read data from one of its segments. */
+	void addProcessedBytes(const MonolithInfo& info, int segmentIndex, int64 numBytes)
+	{
+		segments[firstSegmentIndexes[info.index] + segmentIndex]->numBytesProcessed += numBytes;
+		monoliths[info.index]->numBytesProcessed += numBytes;
+		parts[info.segments[segmentIndex].partIndex]->numBytesProcessed += numBytes;
+		total.numBytesProcessed += numBytes;
+	}
+
+	/** Called when the job of a monolith is done.
+
+		The FLAC reader doesn't necessarily read every byte of the stream (or the job might have
+		stopped early), so this adds the remaining bytes of every segment to keep the progress going.
+	*/
+	void setFinished(const MonolithInfo& info)
+	{
+		for (int i = 0; i < info.segments.size(); i++)
+		{
+			auto s = segments[firstSegmentIndexes[info.index] + i];
+			auto numRemaining = s->numBytes - s->numBytesProcessed.load();
+
+			if (numRemaining > 0)
+				addProcessedBytes(info, i, numRemaining);
+		}
+	}
+
+	/** Returns the progress of the first monolith or part that hasn't been read completely.
+
+		The monoliths are decoded in parallel, so this reports the one that is furthest behind
+		in the archive order, which is what the sequential extraction used to report.
+	*/
+	static double getCurrentProgress(const OwnedArray<Progress>& list)
+	{
+		for (auto p : list)
+		{
+			if (!p->isFinished())
+				return p->get();
+		}
+
+		return 1.0;
+	}
+
+	bool shouldAbort() const { return aborted.load(); }
+
+	void setError(const String& message)
+	{
+		ScopedLock sl(errorLock);
+
+		if (errorMessage.isEmpty())
+			errorMessage = message;
+
+		aborted = true;
+	}
+
+	Stage read, decode, encode, write;
+
+	OwnedArray<Progress> monoliths, parts, segments;
+	Array<int> firstSegmentIndexes;
+	Progress total;
+
+	std::atomic<int64> numBytesPreallocated = { 0 };
+	std::atomic<bool> aborted = { false };
+
+	CriticalSection errorLock;
+	String errorMessage;
+};
+
+/** Reads the FLAC data of a monolith from its segments in the archive files. */
+class HlacArchiver::MonolithInputStream : public InputStream
+{
+public:
+
+	MonolithInputStream(const MonolithInfo& info_, ExtractionState& state_) :
+		info(info_),
+		state(state_)
+	{}
+
+	int64 getTotalLength() override { return info.numBytes; }
+	bool isExhausted() override { return position >= info.numBytes; }
+	int64 getPosition() override { return position; }
+
+	bool setPosition(int64 newPosition) override
+	{
+		position = jlimit<int64>(0, info.numBytes, newPosition);
+
+		int64 segmentStart = 0;
+
+		for (int i = 0; i < info.segments.size(); i++)
+		{
+			auto segmentLength = info.segments.getReference(i).numBytes;
+
+			if (position < segmentStart + segmentLength || i == info.segments.size() - 1)
+				return openSegment(i, position - segmentStart);
+
+			segmentStart += segmentLength;
+		}
+
+		return false;
+	}
+
+	int read(void* destBuffer, int maxBytesToRead) override
+	{
+		auto startTicks = Time::getHighResolutionTicks();
+		auto dest = static_cast<char*>(destBuffer);
+		int numRead = 0;
+
+		while (numRead < maxBytesToRead && !isExhausted())
+		{
+			if (segmentStream == nullptr || segmentPosition >= info.segments[segmentIndex].numBytes)
+			{
+				if (!openSegment(segmentIndex + 1, 0))
+					break;
+
+				continue;
+			}
+
+			auto numLeftInSegment = info.segments[segmentIndex].numBytes - segmentPosition;
+			auto numToRead = (int)jmin<int64>(numLeftInSegment, maxBytesToRead - numRead);
+			auto numReadFromSegment = segmentStream->read(dest + numRead, numToRead);
+
+			if (numReadFromSegment <= 0)
+				break;
+
+			state.addProcessedBytes(info, segmentIndex, numReadFromSegment);
+
+			numRead += numReadFromSegment;
+			segmentPosition += numReadFromSegment;
+			position += numReadFromSegment;
+		}
+
+		auto numTicks = Time::getHighResolutionTicks() - startTicks;
+
+		numReadTicks += numTicks;
+		state.read.add(numRead, numTicks);
+
+		return numRead;
+	}
+
+	/** The time spent in read(). This is used to separate the file access from the FLAC decoding. */
+	int64 numReadTicks = 0;
+
+private:
+
+	bool openSegment(int index, int64 offsetInSegment)
+	{
+		if (!isPositiveAndBelow(index, info.segments.size()))
+			return false;
+
+		auto& s = info.segments.getReference(index);
+
+		if (index != segmentIndex || segmentStream == nullptr)
+		{
+			segmentStream = new FileInputStream(s.file);
+			segmentIndex = index;
+
+			if (!segmentStream->openedOk())
+			{
+				segmentStream = nullptr;
+				return false;
+			}
+		}
+
+		segmentPosition = offsetInSegment;
+		return segmentStream->setPosition(s.offset + offsetInSegment);
+	}
+
+	const MonolithInfo& info;
+	ExtractionState& state;
+
+	ScopedPointer<FileInputStream> segmentStream;
+	int segmentIndex = -1;
+	int64 segmentPosition = 0;
+	int64 position = 0;
+};
+
+/** A FileOutputStream that measures the time spent with writing to the disk. 
+
+	It's a subclass so that the HLAC writer can still create its temporary file next to the target.
+*/
+class HlacArchiver::TimedFileOutputStream : public FileOutputStream
+{
+public:
+
+	TimedFileOutputStream(const File& f, ExtractionState& state_) :
+		FileOutputStream(f),
+		state(state_)
+	{}
+
+	bool write(const void* dataToWrite, size_t numBytes) override
+	{
+		auto startTicks = Time::getHighResolutionTicks();
+		auto ok = FileOutputStream::write(dataToWrite, numBytes);
+		addTicks((int64)numBytes, Time::getHighResolutionTicks() - startTicks);
+		return ok;
+	}
+
+	void flush() override
+	{
+		auto startTicks = Time::getHighResolutionTicks();
+		FileOutputStream::flush();
+		addTicks(0, Time::getHighResolutionTicks() - startTicks);
+	}
+
+	/** The time spent in write() and flush(). This is used to separate the disk access from the HLAC encoding. */
+	int64 numWriteTicks = 0;
+
+private:
+
+	void addTicks(int64 numBytes, int64 numTicks)
+	{
+		numWriteTicks += numTicks;
+		state.write.add(numBytes, numTicks);
+	}
+
+	ExtractionState& state;
+};
+
+struct HlacArchiver::ExtractionJob : public ThreadPoolJob
+{
+	ExtractionJob(HlacArchiver& parent_, const MonolithInfo& info_, const DecompressData& data_, ExtractionState& state_) :
+		ThreadPoolJob("Extract " + info_.name),
+		parent(parent_),
+		info(info_),
+		data(data_),
+		state(state_)
+	{}
+
+	JobStatus runJob() override
+	{
+		if (!state.shouldAbort())
+			parent.extractMonolith(info, data, state);
+
+		state.setFinished(info);
+
+		return jobHasFinished;
+	}
+
+	HlacArchiver& parent;
+	const MonolithInfo& info;
+	const DecompressData& data;
+	ExtractionState& state;
+};
+
+bool HlacArchiver::extractMonolith(const MonolithInfo& info, const DecompressData& data, ExtractionState& state)
+{
+	auto log = [this](const String& message, bool isStatus)
+	{
+		ScopedLock sl(listenerLock);
+
+		if (isStatus)
+		{
+			STATUS_LOG(message);
+		}
+		else
+		{
+			VERBOSE_LOG(message);
+		}
+	};
+
+	FlacAudioFormat flacFormat;
+
+	auto inputStream = new MonolithInputStream(info, state);
+
+	ScopedPointer<AudioFormatReader> flacReader = flacFormat.createReaderFor(inputStream, true);
+
+	if (flacReader == nullptr)
+	{
+		state.setError("Can't read the FLAC data of " + info.name);
+		return false;
+	}
+
+	const int numChannels = (int)flacReader->numChannels;
+	const int64 numSamples = flacReader->lengthInSamples;
+
+	log("  " + info.name + ": " + String(flacReader->sampleRate, 1) + " Hz, " + String(numChannels) + " channels, " + String(numSamples) + " samples", false);
+
+	if (data.debugLogMode)
+		return true;
+
+	log("Decompressing " + info.name, true);
+
+	auto outputStream = new TimedFileOutputStream(info.targetFile, state);
+
+	if (outputStream->failedToOpen())
+	{
+		delete outputStream;
+		state.setError("Can't open " + info.targetFile.getFullPathName() + " for writing");
+		return false;
+	}
+
+	// The block offsets are owned by the format, so every job needs its own instance
+	hlac::HiseLosslessAudioFormat hlacFormat;
+	StringPairArray metadata;
+
+	ScopedPointer<AudioFormatWriter> writer = hlacFormat.createWriterFor(outputStream, flacReader->sampleRate, numChannels, 5, metadata, 5);
+	auto hlacWriter = dynamic_cast<HiseLosslessAudioFormatWriter*>(writer.get());
+
+	jassert(hlacWriter != nullptr);
+
+	hlac::HlacEncoder::CompressorOptions options = hlac::HlacEncoder::CompressorOptions::getPreset(hlac::HlacEncoder::CompressorOptions::Presets::Diff);
+
+	options.applyDithering = false;
+	options.normalisationMode = data.supportFullDynamics ? 2 : 0;
+
+	hlacWriter->setOptions(options);
+
+	// Use the same estimation as preallocateMemory() and fall back to a temporary file if
+	// the parallel writers would hold too much memory.
+	int64 numBytesToPreallocate = numSamples * numChannels * 2 * 2 / 3;
+
+	if (state.numBytesPreallocated.fetch_add(numBytesToPreallocate) + numBytesToPreallocate > ExtractionState::MaxPreallocatedBytes)
+	{
+		state.numBytesPreallocated -= numBytesToPreallocate;
+		numBytesToPreallocate = 0;
+		hlacWriter->setTemporaryBufferType(true);
+	}
+	else
+		hlacWriter->preallocateMemory(numSamples, numChannels);
+
+	const int bufferSize = 8192 * 32;
+	const int64 numBytesPerSample = numChannels * (int64)sizeof(int16);
+
+	AudioSampleBuffer tempBuffer(numChannels, bufferSize);
+
+	auto ok = [&]()
+	{
+		for (int64 readerOffset = 0; readerOffset < numSamples; readerOffset += bufferSize)
+		{
+			if (state.shouldAbort())
+				return false;
+
+			const int numToRead = jmin<int>(bufferSize, (int)(numSamples - readerOffset));
+			const int64 numPCMBytes = numToRead * numBytesPerSample;
+
+			auto readTicks = inputStream->numReadTicks;
+			auto startTicks = Time::getHighResolutionTicks();
+
+			flacReader->read(&tempBuffer, 0, numToRead, readerOffset, true, true);
+
+			state.decode.add(numPCMBytes, Time::getHighResolutionTicks() - startTicks - (inputStream->numReadTicks - readTicks));
+
+			auto writeTicks = outputStream->numWriteTicks;
+			startTicks = Time::getHighResolutionTicks();
+
+			auto writeOk = writer->writeFromAudioSampleBuffer(tempBuffer, 0, numToRead);
+
+			state.encode.add(numPCMBytes, Time::getHighResolutionTicks() - startTicks - (outputStream->numWriteTicks - writeTicks));
+
+			if (!writeOk)
+			{
+				state.setError("File write error for " + info.targetFile.getFileName());
+				return false;
+			}
+		}
+
+		auto writeTicks = outputStream->numWriteTicks;
+		auto startTicks = Time::getHighResolutionTicks();
+
+		auto flushOk = writer->flush();
+
+		state.encode.add(0, Time::getHighResolutionTicks() - startTicks - (outputStream->numWriteTicks - writeTicks));
+
+		if (!flushOk)
+		{
+			state.setError("File write error: Flushing file " + info.targetFile.getFileName());
+			return false;
+		}
+
+		outputStream->flush();
+		return true;
+	}();
+
+	writer = nullptr;
+	flacReader = nullptr;
+
+	state.numBytesPreallocated -= numBytesToPreallocate;
+
+	if (!ok)
+		info.targetFile.deleteFile();
+
+	return ok;
+}
+
 bool HlacArchiver::extractSampleData(const DecompressData& data)
 {
 	jassert(listener != nullptr);
@@ -1182,7 +1624,7 @@ bool HlacArchiver::extractSampleData(const DecompressData& data)
 	auto targetDirectory = data.targetDirectory;
 	auto option = data.option;
 	
-	if (targetDirectory.isDirectory())
+	if (!targetDirectory.isDirectory())
 	{
 		bool ok = targetDirectory.createDirectory();
 
@@ -1192,26 +1634,16 @@ bool HlacArchiver::extractSampleData(const DecompressData& data)
 		}
 	}
 
-	Array<File> parts;
-
-	sourceFile.getParentDirectory().findChildFiles(parts, File::findFiles, false, sourceFile.getFileNameWithoutExtension() + ".*");
-
-	const int numParts = parts.size();
-
 	ScopedPointer<FileInputStream> fis = new FileInputStream(sourceFile);
 
-	FlacAudioFormat flacFormat;
-	hlac::HiseLosslessAudioFormat hlacFormat;
-
 	CHECK_FLAG(Flag::BeginMetadata);
 	auto metadataString = fis->readString();
 	CHECK_FLAG(Flag::EndMetadata);
 
 	VERBOSE_LOG(metadataString);
 
-	StringPairArray metadata;
-
 	int partIndex = 1;
+	File currentSourceFile = sourceFile;
 
 	currentFlag = readFlag(fis);
 
@@ -1229,21 +1661,16 @@ bool HlacArchiver::extractSampleData(const DecompressData& data)
 		currentFlag = readFlag(fis);
 	}
 
+	// Scan the archive and collect the location of every monolith that needs to be extracted.
+
+	Array<MonolithInfo> monoliths;
+
 	while (currentFlag == Flag::BeginName)
 	{
 		auto name = fis->readString();
 		CHECK_FLAG(Flag::EndName);
 
 		VERBOSE_LOG("  Reading Monolith " + name);
-		STATUS_LOG("Extracting " + name);
-		
-		*data.partProgress = (double)fis->getPosition() / (double)fis->getTotalLength();
-
-		const double totalProgress = (double)(partIndex - 1) / (double)numParts;
-
-		const double totalPartProgress = *data.partProgress / (double)numParts;
-
-		*data.totalProgress = totalProgress + totalPartProgress;
 
 		CHECK_FLAG(Flag::BeginTime);
 		auto archiveTime = Time::fromISO8601(fis->readString());
@@ -1252,7 +1679,6 @@ bool HlacArchiver::extractSampleData(const DecompressData& data)
 		if (thread->threadShouldExit())
 			return false;
 
-		
 		File targetHlacFile = targetDirectory.getChildFile(name);
 
 		bool overwriteThisFile = true;
@@ -1278,186 +1704,122 @@ bool HlacArchiver::extractSampleData(const DecompressData& data)
 				
 		}
 
-		if (thread->threadShouldExit())
-			return false;
-
-		if (overwriteThisFile || data.debugLogMode)
-		{
-			VERBOSE_LOG("  Overwriting File ");
-
-			bool ok = true;
-
-			File tmpFlacFile = targetHlacFile.getSiblingFile("TmpFlac.flac").getNonexistentSibling();
+		MonolithInfo info;
+		info.name = name;
+		info.targetFile = targetHlacFile;
 
-			if (tmpFlacFile.existsAsFile())
-				tmpFlacFile.deleteFile();
+		CHECK_FLAG(Flag::BeginMonolithLength);
+		auto numBytes = fis->readInt64();
+		CHECK_FLAG(Flag::EndMonolithLength);
 
-			ScopedPointer<FileOutputStream> flacTempWriteStream = new FileOutputStream(tmpFlacFile);
+		CHECK_FLAG(Flag::BeginMonolith);
+		info.addSegment(currentSourceFile, partIndex - 1, fis->getPosition(), numBytes);
+		fis->setPosition(fis->getPosition() + numBytes);
 
-			CHECK_FLAG(Flag::BeginMonolithLength);
-			auto bytesToRead = fis->readInt64();
-			CHECK_FLAG(Flag::EndMonolithLength);
-
-			STATUS_LOG("Creating temp file");
+		currentFlag = readFlag(fis);
 
-			CHECK_FLAG(Flag::BeginMonolith);
+		while (currentFlag == Flag::SplitMonolith)
+		{
+			partIndex++;
 
-			flacTempWriteStream->writeFromInputStream(*fis, bytesToRead);
+			currentSourceFile = getPartFile(sourceFile, partIndex);
 
-			currentFlag = readFlag(fis);
+			fis = nullptr;
+			fis = new FileInputStream(currentSourceFile);
 
-			while (currentFlag == Flag::SplitMonolith)
+			if (!fis->openedOk())
 			{
-				partIndex++;
-
-				fis = nullptr;
-
-				fis = new FileInputStream(getPartFile(sourceFile, partIndex));
-
-				CHECK_FLAG(Flag::BeginMonolithLength);
-				bytesToRead = fis->readInt64();
-				CHECK_FLAG(Flag::EndMonolithLength);
-
-				CHECK_FLAG(Flag::ResumeMonolith);
-
-				flacTempWriteStream->writeFromInputStream(*fis, bytesToRead);
-
-				currentFlag = readFlag(fis);
-			}
-
-			if (thread->threadShouldExit())
-				return false;
-
-			jassert(currentFlag == Flag::EndMonolith);
-
-			flacTempWriteStream->flush();
-			flacTempWriteStream = nullptr;
-
-			FileInputStream* flacTempInputStream = new FileInputStream(tmpFlacFile);
-
-			jassert(flacTempInputStream->openedOk());
-
-			ScopedPointer<AudioFormatReader> flacReader = flacFormat.createReaderFor(flacTempInputStream, true);
-
-			if (flacReader == nullptr)
+				listener->criticalErrorOccured("Can't open " + currentSourceFile.getFileName());
 				return false;
-
-			VERBOSE_LOG("    Samplerate: " + String(flacReader->sampleRate, 1));
-			VERBOSE_LOG("    Channels: " + String(flacReader->numChannels));
-			VERBOSE_LOG("    Length: " + String(flacReader->lengthInSamples));
-
-			FileOutputStream* monolithOutputStream; 
-			ScopedPointer<AudioFormatWriter> writer;
-
-			if (!data.debugLogMode)
-			{
-				if (targetHlacFile.existsAsFile())
-					targetHlacFile.create();
-
-				monolithOutputStream = new FileOutputStream(targetHlacFile);
-				writer = hlacFormat.createWriterFor(monolithOutputStream, flacReader->sampleRate, flacReader->numChannels, 5, metadata, 5);
 			}
 
-			STATUS_LOG("Decompressing " + name);
+			CHECK_FLAG(Flag::BeginMonolithLength);
+			numBytes = fis->readInt64();
+			CHECK_FLAG(Flag::EndMonolithLength);
 
-			const int bufferSize = 8192 * 32;
+			CHECK_FLAG(Flag::ResumeMonolith);
+			info.addSegment(currentSourceFile, partIndex - 1, fis->getPosition(), numBytes);
+			fis->setPosition(fis->getPosition() + numBytes);
 
-			hlac::HlacEncoder::CompressorOptions options = hlac::HlacEncoder::CompressorOptions::getPreset(hlac::HlacEncoder::CompressorOptions::Presets::Diff);
+			currentFlag = readFlag(fis);
+		}
 
-			if (thread->threadShouldExit())
-				return false;
+		if (currentFlag != Flag::EndMonolith)
+		{
+			listener->criticalErrorOccured("Read error");
+			return false;
+		}
 
-			options.applyDithering = false;
-			options.normalisationMode = data.supportFullDynamics ? 2 : 0;
+		if (overwriteThisFile || data.debugLogMode)
+		{
+			VERBOSE_LOG("  Overwriting File ");
+			info.index = monoliths.size();
+			monoliths.add(info);
+		}
+		else
+		{
+			VERBOSE_LOG("  Skipping File ");
+		}
 
-			//dynamic_cast<HiseLosslessAudioFormatWriter*>(writer.get())->setTemporaryBufferType(true);
+		currentFlag = readFlag(fis);
+	}
 
-			dynamic_cast<HiseLosslessAudioFormatWriter*>(writer.get())->preallocateMemory(flacReader->lengthInSamples, flacReader->numChannels);
+	jassert(currentFlag == Flag::EndOfArchive);
 
-			if(!data.debugLogMode)
-				dynamic_cast<HiseLosslessAudioFormatWriter*>(writer.get())->setOptions(options);
+	fis = nullptr;
 
-			AudioSampleBuffer tempBuffer(flacReader->numChannels, data.debugLogMode ? 0 : bufferSize);
+	if (monoliths.isEmpty())
+		return true;
 
-			for (int64 readerOffset = 0; readerOffset < flacReader->lengthInSamples; readerOffset += bufferSize)
-			{
-				if (thread->threadShouldExit())
-					return false;
+	// Decode the monoliths in parallel. The jobs only read the FLAC data, so the archive index
+	// above is the only sequential part.
 
-				const int numToRead = jmin<int>(bufferSize, (int)(flacReader->lengthInSamples - readerOffset));
+	ExtractionState state(monoliths, partIndex);
 
-				if (!data.debugLogMode)
-				{
-					flacReader->read(&tempBuffer, 0, numToRead, readerOffset, true, true);
-					ok = writer->writeFromAudioSampleBuffer(tempBuffer, 0, numToRead);
-					if (!ok)
-					{
-						listener->criticalErrorOccured("File write error for " + targetHlacFile.getFileName());
-						return false;
-					}
-				}
+	const int numThreads = jlimit(1, jmax(1, SystemStats::getNumCpus()), monoliths.size());
 
-				*data.progress = (double)readerOffset / (double)flacReader->lengthInSamples;
-			}
+	STATUS_LOG("Extracting " + String(monoliths.size()) + " monoliths using " + String(numThreads) + " threads");
 
-			
-			if (!data.debugLogMode)
-			{
-				ok = writer->flush();
-				if (!ok)
-				{
-					listener->criticalErrorOccured("File write error: Flushing file " + targetHlacFile.getFileName());
-					return false;
-				}
+	auto startTicks = Time::getHighResolutionTicks();
 
-				if (thread->threadShouldExit())
-					return false;
+	{
+		ThreadPool pool(numThreads);
 
-				writer = nullptr;
-			}
+		for (const auto& m : monoliths)
+			pool.addJob(new ExtractionJob(*this, m, data, state), true);
 
-			flacReader = nullptr;
-			tmpFlacFile.deleteFile();
-			currentFlag = readFlag(fis);
-		}
-		else
+		while (pool.getNumJobs() > 0)
 		{
-			VERBOSE_LOG("  Skipping File ");
-
-			CHECK_FLAG(Flag::BeginMonolithLength);
-			auto bytesToSkip = fis->readInt64();
-			CHECK_FLAG(Flag::EndMonolithLength);
-
-			CHECK_FLAG(Flag::BeginMonolith);
-			fis->skipNextBytes(bytesToSkip);
-			currentFlag = readFlag(fis);
+			if (thread->threadShouldExit())
+				state.aborted = true;
 
-			while (currentFlag == Flag::SplitMonolith)
-			{
-				partIndex++;
+			*data.progress = ExtractionState::getCurrentProgress(state.monoliths);
+			*data.partProgress = ExtractionState::getCurrentProgress(state.parts);
+			*data.totalProgress = state.total.get();
 
-				fis = nullptr;
-				fis = new FileInputStream(getPartFile(sourceFile, partIndex));
+			Thread::sleep(50);
+		}
+	}
 
-				CHECK_FLAG(Flag::BeginMonolithLength);
-				bytesToSkip = fis->readInt64();
-				CHECK_FLAG(Flag::EndMonolithLength);
+	if (state.errorMessage.isNotEmpty())
+	{
+		listener->criticalErrorOccured(state.errorMessage);
+		return false;
+	}
 
-				if (thread->threadShouldExit())
-					return false;
+	if (state.shouldAbort())
+		return false;
 
-				CHECK_FLAG(Flag::ResumeMonolith);
-				fis->skipNextBytes(bytesToSkip);
+	*data.progress = 1.0;
+	*data.partProgress = 1.0;
+	*data.totalProgress = 1.0;
 
-				currentFlag = readFlag(fis);
-			}
+	auto seconds = Time::highResolutionTicksToSeconds(Time::getHighResolutionTicks() - startTicks);
 
-			jassert(currentFlag == Flag::EndMonolith);
-			currentFlag = readFlag(fis);
-		}
-	}
+	STATUS_LOG("Throughput per thread: " + state.read.toString("Read") + ", " + state.decode.toString("FLAC decode") + ", " +
+			   state.encode.toString("HLAC encode") + ", " + state.write.toString("Write"));
 
-	jassert(currentFlag == Flag::EndOfArchive);
+	STATUS_LOG("Extracted " + String((double)state.total.numBytes / 1024.0 / 1024.0, 1) + " MB in " + String(seconds, 1) + " seconds");
 
 	return true;
 }
@@ -1583,7 +1945,9 @@ void HlacArchiver::compressSampleData(const CompressData& data)
 
 			*data.totalProgress = ((double)i / (double)hlacFiles.size());
 
-			auto sizeLeftInPart = data.partSize - fos->getPosition();
+			// The flags of the previous monolith can exceed the part size, and a negative
+			// amount would make writeFromInputStream() copy the entire monolith.
+			auto sizeLeftInPart = jmax<int64>(0, data.partSize - fos->getPosition());
 
 			FileInputStream* fis = new FileInputStream(hlacFiles[i]);
 
@@ -423,7 +423,12 @@ struct HlacArchiver
 		virtual void criticalErrorOccured(const String& message) = 0;
 	};
 
-	/** Extracts the compressed data from the given file. */
+	/** Extracts the compressed data from the given file.
+	
+		The archive (and all its parts) is scanned first, then the monoliths that need to be written
+		are decoded in parallel. The FLAC data is streamed directly from the archive into the HLAC
+		writer, so there is no temporary FLAC file on the disk.
+	*/
 	bool extractSampleData(const DecompressData& data);
 
 	/** Compressed the given data using the supplied Thread. */
@@ -440,8 +445,45 @@ struct HlacArchiver
 
 private:
 
+	/** A part of the FLAC data of a monolith inside one of the archive files. */
+	struct MonolithSegment
+	{
+		File file;
+		int partIndex = 0;
+		int64 offset = 0;
+		int64 numBytes = 0;
+	};
+
+	/** The location of a monolith inside the archive and the file it will be extracted to. */
+	struct MonolithInfo
+	{
+		/** Adds a segment. The part index is zero based (the first archive file is part 0). */
+		void addSegment(const File& f, int partIndex, int64 offset, int64 numBytesInSegment)
+		{
+			segments.add({ f, partIndex, offset, numBytesInSegment });
+			numBytes += numBytesInSegment;
+		}
+
+		String name;
+		File targetFile;
+		Array<MonolithSegment> segments;
+		int64 numBytes = 0;
+
+		/** The index of the monolith in the list of monoliths that are extracted. */
+		int index = -1;
+	};
+
+	struct ExtractionState;
+	struct ExtractionJob;
+	class MonolithInputStream;
+	class TimedFileOutputStream;
+
+	bool extractMonolith(const MonolithInfo& info, const DecompressData& data, ExtractionState& state);
+
 	FileInputStream* writeTempFile(AudioFormatReader* reader, int bitDepth=16);
 
+	CriticalSection listenerLock;
+
 	Listener* listener = nullptr;
 
 	String getFlagName(Flag f);
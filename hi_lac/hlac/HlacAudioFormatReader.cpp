@@ -51,6 +51,8 @@ HiseLosslessAudioFormatReader::HiseLosslessAudioFormatReader(InputStream* input_
 
 bool HiseLosslessAudioFormatReader::readSamples(int** destSamples, int numDestChannels, int startOffsetInDestBuffer, int64 startSampleInFile, int numSamples)
 {
+	ScopedLock sl(decoderLock);
+
 	if (isMonolith)
 	{
 		clearSamplesBeyondAvailableLength(destSamples, numDestChannels, startOffsetInDestBuffer,
@@ -398,6 +400,7 @@ bool HlacMemoryMappedAudioFormatReader::readSamples(int** destSamples, int numDe
 	{
 		if (internalReader.input != nullptr)
 		{
+			ScopedLock sl(decoderLock);
 			return internalReader.internalHlacRead(destSamples, numDestChannels, startOffsetInDestBuffer, startSampleInFile, numSamples);
 		}
 
@@ -576,12 +579,22 @@ void HlacSubSectionReader::readIntoFixedBuffer(HiseSampleBuffer& buffer, int sta
 		}
 		else
 		{
+			ScopedLock sl(normalReader->decoderLock);
 			normalReader->copyFromMonolith(buffer, startSample, buffer.getNumChannels(), start + readerStartSample, numChannels, numSamples);
 		}
 	}
 	else
 	{
-		internalReader->fixedBufferRead(buffer, numChannels, startSample, start + readerStartSample, numSamples);
+		if (memoryReader != nullptr)
+		{
+			ScopedLock sl(memoryReader->decoderLock);
+			internalReader->fixedBufferRead(buffer, numChannels, startSample, start + readerStartSample, numSamples);
+		}
+		else
+		{
+			ScopedLock sl(normalReader->decoderLock);
+			internalReader->fixedBufferRead(buffer, numChannels, startSample, start + readerStartSample, numSamples);
+		}
 
 		if (buffer.getNumChannels() == 1 || numChannels == 1)
 		{
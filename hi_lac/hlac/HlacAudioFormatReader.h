@@ -152,6 +152,10 @@ private:
 
 	HlacReaderCommon internalReader;
 
+	/** The fallback reader of a monolith is shared by all subsection readers and reads through a single
+	    stream, so it must not be used by multiple loading threads at the same time. */
+	CriticalSection decoderLock;
+
 	bool isMonolith = false;
 
 };
@@ -199,6 +203,10 @@ private:
 	ScopedPointer<MemoryInputStream> mis;
 	HlacReaderCommon internalReader;
 
+	/** The decoder and the input stream are shared by all subsection readers of a compressed monolith,
+	    so multiple loading threads must not decode at the same time. */
+	CriticalSection decoderLock;
+
 	bool isMonolith = false;
 };
 
@@ -61,13 +61,14 @@ bool HiseLosslessAudioFormatWriter::flush()
 	if (!writeHeader())
 		return false;
 
+	// The temporary file must be flushed before it is copied to the output
+	tempOutputStream->flush();
+
 	if (!writeDataFromTemp())
 		return false;
 
 	tempWasFlushed = true;
 
-	tempOutputStream->flush();
-
 	deleteTemp();
 	return true;
 }
@@ -193,6 +194,48 @@ int64 HiseLosslessAudioFormatWriter::getNumBytesWritten() const
 	return numBytesWritten;
 }
 
+void HiseLosslessAudioFormatWriter::setThreadPool(ThreadPool* newPool)
+{
+	encoder.setThreadPool(newPool);
+}
+
+bool HiseLosslessAudioFormatWriter::writeFromAudioReaderWithChunkSize(AudioFormatReader& reader, int chunkSize)
+{
+	jassert(chunkSize % COMPRESSION_BLOCK_SIZE == 0);
+
+	AudioSampleBuffer tempBuffer((int)numChannels, chunkSize);
+
+	int* buffers[3] = { nullptr, nullptr, nullptr };
+
+	for (int i = 0; i < jmin(2, tempBuffer.getNumChannels()); i++)
+		buffers[i] = reinterpret_cast<int*>(tempBuffer.getWritePointer(i, 0));
+
+	int64 startSample = 0;
+	int64 numSamplesToRead = reader.lengthInSamples;
+
+	while (numSamplesToRead > 0)
+	{
+		const int numToDo = (int)jmin(numSamplesToRead, (int64)chunkSize);
+
+		if (!reader.read(buffers, (int)numChannels, startSample, numToDo, false))
+			return false;
+
+		if (!reader.usesFloatingPointData)
+		{
+			for (int i = 0; buffers[i] != nullptr; i++)
+				FloatVectorOperations::convertFixedToFloat((float*)buffers[i], buffers[i], 1.0f / (float)0x7fffffff, numToDo);
+		}
+
+		if (!write(const_cast<const int**>(buffers), numToDo))
+			return false;
+
+		numSamplesToRead -= numToDo;
+		startSample += numToDo;
+	}
+
+	return true;
+}
+
 bool HiseLosslessAudioFormatWriter::writeHeader()
 {
 	if (options.useCompression)
@@ -71,6 +71,17 @@ public:
 	/** Returns the number of written bytes for this reader. */
 	int64 getNumBytesWritten() const;
 
+	/** Sets a thread pool that the encoder uses to compress multiple blocks at once. */
+	void setThreadPool(ThreadPool* newPool);
+
+	/** Writes the data from the reader in chunks of the given size.
+	*
+	*	This does the same as AudioFormatWriter::writeFromAudioReader(), but with a bigger chunk size
+	*	so that a multithreaded encoder has enough blocks to work with. The chunk size must be a multiple
+	*	of COMPRESSION_BLOCK_SIZE so that the block layout is not changed.
+	*/
+	bool writeFromAudioReaderWithChunkSize(AudioFormatReader& reader, int chunkSize);
+
 private:
 
 	bool writeHeader();
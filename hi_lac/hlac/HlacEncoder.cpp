@@ -67,6 +67,16 @@ void HlacEncoder::compress(AudioSampleBuffer& source, OutputStream& output, uint
 	blockOffset = 0;
 	int32 numSamplesRemaining = source.getNumSamples();
 
+	const int numFullBlocks = numSamplesRemaining / COMPRESSION_BLOCK_SIZE;
+
+	if (encoderPool != nullptr && numFullBlocks > 1)
+	{
+		encodeBlocksInParallel(source, numFullBlocks, output, blockOffsetData);
+
+		blockOffset = numFullBlocks * COMPRESSION_BLOCK_SIZE;
+		numSamplesRemaining -= (int32)blockOffset;
+	}
+
 	while (numSamplesRemaining >= COMPRESSION_BLOCK_SIZE)
 	{
 		blockOffsetData[blockIndex] = numBytesWritten;
@@ -142,6 +152,87 @@ HlacEncoder::~HlacEncoder()
 
 }
 
+void HlacEncoder::encodeBlocksInParallel(AudioSampleBuffer& source, int numBlocks, OutputStream& output, uint32* blockOffsetData)
+{
+	struct EncodedBlock
+	{
+		MemoryOutputStream data;
+		uint32 numBytesWritten = 0;
+		uint32 numBytesUncompressed = 0;
+		uint32 numTemplates = 0;
+	};
+
+	OwnedArray<EncodedBlock> encodedBlocks;
+
+	for (int i = 0; i < numBlocks; i++)
+		encodedBlocks.add(new EncodedBlock());
+
+	const bool compressStereo = source.getNumChannels() == 2;
+	const int numJobs = jmin(encoderPool->getNumThreads(), numBlocks);
+
+	std::atomic<int> nextBlock = { 0 };
+	std::atomic<int> numActiveJobs = { numJobs };
+	WaitableEvent allJobsFinished;
+
+	for (int i = 0; i < numJobs; i++)
+	{
+		encoderPool->addJob([&]()
+		{
+			// The encoder keeps the state of the current block, so every job needs its own instance
+			HlacEncoder blockEncoder;
+			blockEncoder.setOptions(options);
+
+			for (int index = nextBlock++; index < numBlocks; index = nextBlock++)
+			{
+				auto eb = encodedBlocks.getUnchecked(index);
+
+				blockEncoder.numBytesWritten = 0;
+				blockEncoder.numBytesUncompressed = 0;
+				blockEncoder.numTemplates = 0;
+				blockEncoder.blockOffset = (uint32)index * COMPRESSION_BLOCK_SIZE;
+
+				eb->data.preallocate(COMPRESSION_BLOCK_SIZE * 2 * source.getNumChannels());
+
+				if (compressStereo)
+				{
+					auto l = CompressionHelpers::getPart(source, 0, blockEncoder.blockOffset, COMPRESSION_BLOCK_SIZE);
+					auto r = CompressionHelpers::getPart(source, 1, blockEncoder.blockOffset, COMPRESSION_BLOCK_SIZE);
+
+					blockEncoder.encodeBlock(l, eb->data);
+					blockEncoder.encodeBlock(r, eb->data);
+				}
+				else
+				{
+					auto b = CompressionHelpers::getPart(source, blockEncoder.blockOffset, COMPRESSION_BLOCK_SIZE);
+
+					blockEncoder.encodeBlock(b, eb->data);
+				}
+
+				eb->numBytesWritten = blockEncoder.numBytesWritten;
+				eb->numBytesUncompressed = blockEncoder.numBytesUncompressed;
+				eb->numTemplates = blockEncoder.numTemplates;
+			}
+
+			if (--numActiveJobs == 0)
+				allJobsFinished.signal();
+		});
+	}
+
+	allJobsFinished.wait();
+
+	for (auto eb : encodedBlocks)
+	{
+		blockOffsetData[blockIndex] = numBytesWritten;
+		++blockIndex;
+
+		numBytesWritten += eb->numBytesWritten;
+		numBytesUncompressed += eb->numBytesUncompressed;
+		numTemplates += eb->numTemplates;
+
+		output.write(eb->data.getData(), eb->data.getDataSize());
+	}
+}
+
 
 
 
@@ -445,7 +536,7 @@ bool HlacEncoder::encodeDiff(CompressionHelpers::AudioBufferInt16& cycle, Output
 	if (numBytesForFull > 0)
 	{
 		MemoryBlock mbFull;
-		mbFull.setSize(numBytesForFull);
+		mbFull.setSize(numBytesForFull, true);
 		compressorFull->compress((uint8*)mbFull.getData(), packedBuffer.getReadPointer(), numFullValues);
 
 		if (!output.write(mbFull.getData(), numBytesForFull))
@@ -457,7 +548,7 @@ bool HlacEncoder::encodeDiff(CompressionHelpers::AudioBufferInt16& cycle, Output
 	if (numBytesForError > 0)
 	{
 		MemoryBlock mbError;
-		mbError.setSize(numBytesForError);
+		mbError.setSize(numBytesForError, true);
 		compressorError->compress((uint8*)mbError.getData(), packedErrorBuffer.getReadPointer(), numErrorValues);
 
 		
@@ -141,8 +141,17 @@ public:
 
 	uint32 getNumBlocksWritten() const { return blockIndex; }
 
+	/** Sets a thread pool that is used to compress the blocks of a buffer in parallel.
+	*
+	*	Every block is encoded independently, so the blocks are written in their original order and
+	*	the output (and the block offset table) is the same as with the single threaded encoder.
+	*/
+	void setThreadPool(ThreadPool* newPool) { encoderPool = newPool; }
+
 private:
 
+	void encodeBlocksInParallel(AudioSampleBuffer& source, int numBlocks, OutputStream& output, uint32* blockOffsetData);
+
 	bool encodeBlock(AudioSampleBuffer& block, OutputStream& output);
 
 	bool encodeBlock(CompressionHelpers::AudioBufferInt16& block, OutputStream& output);
@@ -207,6 +216,8 @@ private:
 	uint64 readIndex = 0;
 
 	double decompressionSpeed = 0.0;
+
+	ThreadPool* encoderPool = nullptr;
 };
 
 } // namespace hlac
@@ -46,6 +46,8 @@ public:
 
 	SET_PROCESSOR_NAME("Chorus", "Chorus", "A simple chorus effect.");
 
+	bool canBeProcessedConcurrently() const override { return true; }
+
 	/** The parameters */
 	enum Parameters
 	{
@@ -59,6 +59,8 @@ public:
 
 	SET_PROCESSOR_NAME("CurveEq", "Parametriq EQ", "A parametric EQ with a variable amount of filter bands.")
 
+	bool canBeProcessedConcurrently() const override { return true; }
+
 	enum Parameters
 	{
 		numEffectParameters
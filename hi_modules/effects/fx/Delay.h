@@ -45,6 +45,8 @@ public:
 
 	SET_PROCESSOR_NAME("Delay", "Delay", "A stereo delay effect");
 
+	bool canBeProcessedConcurrently() const override { return true; }
+
 	/** The parameters*/
 	enum Parameters
 	{
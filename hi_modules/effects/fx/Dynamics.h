@@ -44,6 +44,8 @@ public:
 
 	SET_PROCESSOR_NAME("Dynamics", "Dynamics", "A general purpose dynamics processor based on chunkware's SimpleCompressor");
 
+	bool canBeProcessedConcurrently() const override { return true; }
+
 		enum Parameters
 	{
 		GateEnabled,
@@ -47,6 +47,8 @@ public:
 
 	SET_PROCESSOR_NAME("MonophonicFilter", "Monophonic Filter", "deprecated");
 
+	bool canBeProcessedConcurrently() const override { return true; }
+
 	enum InternalChains
 	{
 		FrequencyChain = 0,
@@ -146,6 +148,8 @@ public:
 
 	SET_PROCESSOR_NAME("PolyphonicFilter", "Filter", "The filter module of HISE.");
 
+	bool canBeProcessedConcurrently() const override { return true; }
+
 	enum InternalChains
 	{
 		FrequencyChain = 0,
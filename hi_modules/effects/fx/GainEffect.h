@@ -42,6 +42,8 @@ public:
 
 	SET_PROCESSOR_NAME("EmptyFX", "Empty", "A simple effect that does nothing.");
 
+	bool canBeProcessedConcurrently() const override { return true; }
+
 	EmptyFX(MainController *mc, const String &uid) :
 		MasterEffectProcessor(mc, uid)
 	{
@@ -309,6 +311,8 @@ public:
 
 	SET_PROCESSOR_NAME("SimpleGain", "Simple Gain", "A utility effect that allows smooth gain changes, static delays and panning.")
 
+	bool canBeProcessedConcurrently() const override { return true; }
+
 	enum InternalChains
 	{
 		GainChain = 0,
@@ -306,6 +306,8 @@ public:
 
 	SET_PROCESSOR_NAME("HarmonicFilter", "Harmonic Filter", "A set of tuned hi-resonant peak filters that are set to the root frequency and harmonics of each note");
 
+	bool canBeProcessedConcurrently() const override { return true; }
+
 	enum InternalChains
 	{
 		XFadeChain = 0,
@@ -399,6 +401,8 @@ public:
 
 	SET_PROCESSOR_NAME("HarmonicFilterMono", "Harmonic Filter Monophonic", "A set of tuned hi-resonant peak filters that are set to the root frequency and harmonics of the last played note");
 
+	bool canBeProcessedConcurrently() const override { return true; }
+
 	enum InternalChains
 	{
 		XFadeChain = 0,
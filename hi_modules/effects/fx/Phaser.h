@@ -43,6 +43,8 @@ class PhaseFX: public MasterEffectProcessor
 public:
     
 	SET_PROCESSOR_NAME("PhaseFX", "Phase FX", "A general purpose phase effect used for phasers.");
+
+	bool canBeProcessedConcurrently() const override { return true; }
     
     enum Attributes
     {
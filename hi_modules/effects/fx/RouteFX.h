@@ -116,6 +116,9 @@ struct SendContainer : public ModulatorSynth
 		prepareToPlay(getSampleRate(), getLargestBlockSize());
 	}
 
+	/** The send effects write into the internal buffer from other synths. */
+	bool canBeProcessedConcurrently() const override { return false; }
+
 	float getAttribute(int) const override { return 1.0f; };
 	void setInternalAttribute(int, float) override {};
 
@@ -264,6 +267,8 @@ struct SendEffect : public MasterEffectProcessor
     {
         modChains.clear();
     }
+
+    bool canBeProcessedConcurrently() const override { return false; }
     
 	float getAttribute(int index) const override 
 	{
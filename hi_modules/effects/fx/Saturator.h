@@ -44,6 +44,8 @@ public:
 
 	SET_PROCESSOR_NAME("Saturator", "Saturator", "deprecated")
 
+	bool canBeProcessedConcurrently() const override { return true; }
+
 	enum InternalChains
 	{
 		SaturationChain = 0,
@@ -46,6 +46,8 @@ public:
 
 	SET_PROCESSOR_NAME("SimpleReverb", "Simple Reverb", "a algorithmic reverb based on Freeverb.");
 
+	bool canBeProcessedConcurrently() const override { return true; }
+
 	/** The parameters */
 	enum Parameters
 	{
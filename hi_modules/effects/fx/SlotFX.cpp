@@ -863,6 +863,10 @@ void HardcodedSwappableEffect::prepareOpaqueNode(OpaqueNode* n)
 		ps.blockSize = asProcessor().getLargestBlockSize();
 		ps.sampleRate = asProcessor().getSampleRate();
 		ps.voiceIndex = &polyHandler;
+
+		// The compiled network might contain parallel containers
+		polyHandler.setWorkerPool(asProcessor().getMainController()->getRealtimeWorkerPool());
+
 		n->prepare(ps);
 		n->reset();
 
@@ -188,6 +188,8 @@ public:
 
 	bool hasTail() const override;
 
+	bool canBeProcessedConcurrently() const override { return false; }
+
     bool isFadeOutPending() const noexcept override
     {
         if(numChannelsToRender == 2)
@@ -260,6 +262,8 @@ public:
 
 	bool hasTail() const override;;
 
+	bool canBeProcessedConcurrently() const override { return false; }
+
 	Processor *getChildProcessor(int processorIndex) override { return nullptr; };
 	const Processor *getChildProcessor(int processorIndex) const override { return nullptr; };
 	int getNumChildProcessors() const override { return 0; };
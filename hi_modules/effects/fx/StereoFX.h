@@ -64,6 +64,8 @@ public:
 
 	SET_PROCESSOR_NAME("StereoFX", "Stereo FX", "A polyphonic stereo panner.");
 
+	bool canBeProcessedConcurrently() const override { return true; }
+
 	enum InternalChains
 	{
 		BalanceChain = 0,
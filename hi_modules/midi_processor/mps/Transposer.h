@@ -156,6 +156,8 @@ public:
 
 	SET_PROCESSOR_NAME("Transposer", "Transposer", "Transposes all midi note messages by the specified amount.");
 
+	bool canBeProcessedConcurrently() const override { return true; }
+
 	Transposer(MainController *mc, const String &id):
 		MidiProcessor(mc, id),
 		transposeAmount(0)
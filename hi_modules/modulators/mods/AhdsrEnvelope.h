@@ -68,6 +68,8 @@ public:
 
 	SET_PROCESSOR_NAME("AHDSR", "AHDSR Envelope", "A envelope modulator with five states")
 
+	bool canBeProcessedConcurrently() const override { return true; }
+
 	/// @brief special parameters for AhdsrEnvelope
 	enum SpecialParameters
 	{
@@ -45,6 +45,8 @@ public:
 
 	SET_PROCESSOR_NAME("ArrayModulator", "Array Modulator", "Creates a modulation signal from an array (note-number based).")
 
+	bool canBeProcessedConcurrently() const override { return true; }
+
 		/// Additional Parameters for the constant modulator
 	enum SpecialParameters
 	{
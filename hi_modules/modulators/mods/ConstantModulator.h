@@ -45,6 +45,8 @@ public:
 
 	SET_PROCESSOR_NAME("Constant", "Constant", "creates a constant modulation signal (1.0).");
 
+	bool canBeProcessedConcurrently() const override { return true; }
+
 	/// Additional Parameters for the constant modulator
 	enum SpecialParameters
 	{
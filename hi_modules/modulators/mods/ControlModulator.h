@@ -49,6 +49,8 @@ public:
 
 	SET_PROCESSOR_NAME("MidiController", "Midi Controller", "Creates a modulation signal from MIDI-CC messages.");
 
+	bool canBeProcessedConcurrently() const override { return true; }
+
 	/** Special Parameters for the ControlModulator. */
 	enum Parameters
 	{
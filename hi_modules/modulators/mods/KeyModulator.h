@@ -48,6 +48,8 @@ public:
 
 	SET_PROCESSOR_NAME("KeyNumber", "Notenumber Modulator", "Creates a modulation value based on the note-number.")
 
+	bool canBeProcessedConcurrently() const override { return true; }
+
 	KeyModulator(MainController *mc, const String &id, int numVoices, Modulation::Mode m);
 
 	void restoreFromValueTree(const ValueTree &v) override
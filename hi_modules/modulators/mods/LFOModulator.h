@@ -69,6 +69,8 @@ public:
 
 	SET_PROCESSOR_NAME("LFO", "LFO Modulator", "A LFO Modulator modulates the signal with a low frequency")
 
+	bool canBeProcessedConcurrently() const override { return true; }
+
 	LfoModulator(MainController *mc, const String &id, Modulation::Mode m);
 
 	~LfoModulator();
@@ -49,6 +49,8 @@ public:
 
 	SET_PROCESSOR_NAME("PitchWheel", "Pitch Wheel Modulator", "Creates a monophonic modulation signal from the pitch-wheel");
 
+	bool canBeProcessedConcurrently() const override { return true; }
+
 	PitchwheelModulator(MainController *mc, const String &id, Modulation::Mode m);
 
 	~PitchwheelModulator();
@@ -47,6 +47,8 @@ public:
 
 	SET_PROCESSOR_NAME("Random", "Random Modulator", "Creates a random modulation value at voice start.");
 
+	bool canBeProcessedConcurrently() const override { return true; }
+
 	/** Special Parameters for the Random Modulator */
 	enum Parameters
 	{
@@ -56,6 +56,8 @@ public:
 
 	SET_PROCESSOR_NAME("SimpleEnvelope", "Simple Envelope", "The most simple envelope (only attack and release).")
 
+	bool canBeProcessedConcurrently() const override { return true; }
+
 	/// @brief special parameters for SimpleEnvelope
 	enum SpecialParameters
 	{
@@ -50,6 +50,8 @@ public:
 
 	SET_PROCESSOR_NAME("TableEnvelope", "Table Envelope", "A Envelope that uses two Tables for the attack and release time.")
 
+	bool canBeProcessedConcurrently() const override { return true; }
+
 
 	/** SpecialParameters for the TableEnvelope */
 	enum SpecialParameters
@@ -46,6 +46,8 @@ public:
 
 	SET_PROCESSOR_NAME("Velocity", "Velocity Modulator", "Creates a modulation value from the velocity of a incoming message.")
 
+	bool canBeProcessedConcurrently() const override { return true; }
+
 	/// Additional parameters
 	enum SpecialParameters
 	{
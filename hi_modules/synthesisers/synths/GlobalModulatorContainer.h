@@ -335,6 +335,9 @@ public:
 
 	~GlobalModulatorContainer();
 
+	/** The modulation values are read by the global modulators in other synths. */
+	bool canBeProcessedConcurrently() const override { return false; }
+
 	void processorChanged(EventType /*t*/, Processor* /*p*/) override { refreshList(); }
 
 	void restoreFromValueTree(const ValueTree &v) override;
@@ -85,6 +85,9 @@ public:
 
 	~MacroModulationSource();
 
+	/** The modulation values are read by other processors. */
+	bool canBeProcessedConcurrently() const override { return false; }
+
 	int getNumChildProcessors() const override
 	{
 		return ModulatorSynth::numInternalChains + HISE_NUM_MACROS;
@@ -85,6 +85,8 @@ public:
 
 	SET_PROCESSOR_NAME("Noise", "Noise Generator", "A simple noise generator.");
 
+	bool canBeProcessedConcurrently() const override { return true; }
+
 	NoiseSynth(MainController *mc, const String &id, int numVoices);
 
 	void setTestSignal(TestSignal newSignalType)
@@ -166,6 +168,8 @@ public:
 
 	SET_PROCESSOR_NAME("SilentSynth", "Silent Synth", "A sound generator that produces silence.");
 
+	bool canBeProcessedConcurrently() const override { return true; }
+
 	SilentSynth(MainController *mc, const String &id, int numVoices);
 
 	void addProcessorsWhenEmpty() override
@@ -109,6 +109,8 @@ public:
 
 	SET_PROCESSOR_NAME("SineSynth", "Sine Wave Generator", "A sine wave generator");
 
+	bool canBeProcessedConcurrently() const override { return true; }
+
 	/** The parameters. */
 	enum SpecialParameters
 	{
@@ -123,6 +125,8 @@ public:
 
 	SineSynth(MainController *mc, const String &id, int numVoices);;
 
+	bool supportsParallelVoiceRendering() const override { return true; }
+
 	void restoreFromValueTree(const ValueTree &v) override
 	{
 		ModulatorSynth::restoreFromValueTree(v);
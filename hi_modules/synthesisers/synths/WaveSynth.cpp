@@ -290,9 +290,28 @@ void WaveSynth::prepareToPlay(double newSampleRate, int samplesPerBlock)
 	if (newSampleRate != -1.0)
 	{
 		ProcessorHelpers::increaseBufferIfNeeded(tempBuffer, samplesPerBlock);
+
+		for (auto b : parallelTempBuffers)
+			ProcessorHelpers::increaseBufferIfNeeded(*b, samplesPerBlock);
 	}
 }
 
+void WaveSynth::prepareParallelVoiceRendering(int numThreads)
+{
+	// The buffers are never removed because the voices might still point to them
+	while (parallelTempBuffers.size() < numThreads - 1)
+		parallelTempBuffers.add(new AudioSampleBuffer(2, 0));
+
+	for (auto b : parallelTempBuffers)
+		ProcessorHelpers::increaseBufferIfNeeded(*b, tempBuffer.getNumSamples());
+}
+
+void WaveSynth::prepareVoiceForParallelRendering(ModulatorSynthVoice* v, int threadIndex)
+{
+	auto b = threadIndex == 0 ? &tempBuffer : parallelTempBuffers[threadIndex - 1];
+	static_cast<WaveSynthVoice*>(v)->setTempBufferForMixCalculation(b);
+}
+
 ProcessorEditorBody* WaveSynth::createEditor(ProcessorEditor *parentEditor)
 {
 #if USE_BACKEND
@@ -570,7 +589,7 @@ void WaveSynthVoice::calculateBlock(int startSample, int numSamples)
 
 		
 
-		auto& tBuffer = wavesynth->getTempBufferForMixCalculation();
+		auto& tBuffer = mixBuffer != nullptr ? *mixBuffer : wavesynth->getTempBufferForMixCalculation();
 
 		// Copy all samples to the temporary buffer which contains the separated generators
 		FloatVectorOperations::copy(tBuffer.getWritePointer(0, startIndex), leftSamples, samplesToCopy);
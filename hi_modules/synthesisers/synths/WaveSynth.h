@@ -74,8 +74,13 @@ public:
 
 	void prepareToPlay(double sampleRate, int samplesPerBlock) override;
 
+	/** Sets the buffer that is used for the mix calculation (each thread needs its own buffer when the voices are rendered in parallel). */
+	void setTempBufferForMixCalculation(AudioSampleBuffer* newBuffer) { mixBuffer = newBuffer; }
+
 private:
 
+	AudioSampleBuffer* mixBuffer = nullptr;
+
 	float(*getLeftSample)(double, double);
 	float(*getRightSample)(double, double);
 
@@ -195,6 +200,8 @@ public:
 
 	SET_PROCESSOR_NAME("WaveSynth", "Waveform Generator", "A waveform generator based on BLIP synthesis of common synthesiser waveforms.");
 
+	bool canBeProcessedConcurrently() const override { return true; }
+
 	enum EditorStates
 	{
 		MixChainShown = ModulatorSynth::numEditorStates
@@ -270,6 +277,12 @@ public:
 
 	void prepareToPlay(double newSampleRate, int samplesPerBlock) override;
 
+	bool supportsParallelVoiceRendering() const override { return true; }
+
+	void prepareParallelVoiceRendering(int numThreads) override;
+
+	void prepareVoiceForParallelRendering(ModulatorSynthVoice* v, int threadIndex) override;
+
 	ProcessorEditorBody* createEditor(ProcessorEditor *parentEditor) override;
 
 	const float* getPitch2ModValues(int startSample)
@@ -326,6 +339,8 @@ private:
 
 	AudioSampleBuffer tempBuffer;
 
+	OwnedArray<AudioSampleBuffer> parallelTempBuffers;
+
 	int octaveTranspose1, octaveTranspose2;
 
 	float mix;
@@ -34,6 +34,157 @@
 
 namespace hise { using namespace juce;
 
+namespace WavetableRenderHelpers
+{
+struct Phase
+{
+	Phase(const WavetableRenderKernel::Data& d) :
+		value(d.phase),
+		uptime(d.uptime),
+		size((double)d.tableSize),
+		tableSize(d.tableSize)
+	{
+		calculate();
+	}
+
+	void calculate()
+	{
+		i1 = (int)value;
+		i2 = i1 + 1 == tableSize ? 0 : i1 + 1;
+		alpha = (float)(value - (double)i1);
+	}
+
+	void advance(double delta)
+	{
+		value += delta;
+		uptime += delta;
+
+		while (value >= size)
+			value -= size;
+
+		calculate();
+	}
+
+	float get(const float* table) const
+	{
+		return table[i1] + alpha * (table[i2] - table[i1]);
+	}
+
+	double value;
+	double uptime;
+	const double size;
+	const int tableSize;
+
+	int i1;
+	int i2;
+	float alpha;
+};
+
+template <bool UsePitch> static void processConstantTable(WavetableRenderKernel::Data& d)
+{
+	Phase p(d);
+
+	const float tableValue = jlimit<float>(0.0f, 1.0f, d.constantTableModValue) * (float)(d.numTables - 1);
+	const int lowerTableIndex = (int)tableValue;
+	const int upperTableIndex = jmin(d.numTables - 1, lowerTableIndex + 1);
+	const float tableDelta = tableValue - (float)lowerTableIndex;
+
+	auto lowerTable = d.mipData + lowerTableIndex * d.tableSize;
+	auto upperTable = d.mipData + upperTableIndex * d.tableSize;
+
+	auto lowerGain = d.tableGainValues[lowerTableIndex];
+	auto upperGain = d.tableGainValues[upperTableIndex];
+	auto gain = (lowerGain + tableDelta * (upperGain - lowerGain)) * d.normaliseGain;
+
+	if (lowerTableIndex == upperTableIndex || tableDelta == 0.0f)
+	{
+		for (int i = 0; i < d.numSamples; i++)
+		{
+			d.output[i] = p.get(lowerTable);
+			p.advance(UsePitch ? d.uptimeDelta * (double)d.pitchData[i] : d.uptimeDelta);
+		}
+	}
+	else
+	{
+		for (int i = 0; i < d.numSamples; i++)
+		{
+			const float lowerSample = p.get(lowerTable);
+			const float upperSample = p.get(upperTable);
+
+			d.output[i] = lowerSample + tableDelta * (upperSample - lowerSample);
+			p.advance(UsePitch ? d.uptimeDelta * (double)d.pitchData[i] : d.uptimeDelta);
+		}
+	}
+
+	FloatVectorOperations::multiply(d.output, gain, d.numSamples);
+
+	d.phase = p.value;
+	d.uptime = p.uptime;
+}
+
+template <bool UsePitch> static void processModulatedTable(WavetableRenderKernel::Data& d)
+{
+	Phase p(d);
+
+	const float maxTableIndex = (float)(d.numTables - 1);
+
+	for (int i = 0; i < d.numSamples; i++)
+	{
+		const float tableValue = jlimit<float>(0.0f, 1.0f, d.tableModValues[i]) * maxTableIndex;
+		const int lowerTableIndex = (int)tableValue;
+		const int upperTableIndex = jmin(d.numTables - 1, lowerTableIndex + 1);
+		const float tableDelta = tableValue - (float)lowerTableIndex;
+
+		const float lowerSample = p.get(d.mipData + lowerTableIndex * d.tableSize);
+		const float upperSample = p.get(d.mipData + upperTableIndex * d.tableSize);
+
+		const float lowerGain = d.tableGainValues[lowerTableIndex];
+		const float upperGain = d.tableGainValues[upperTableIndex];
+
+		const float sample = lowerSample + tableDelta * (upperSample - lowerSample);
+		d.output[i] = sample * (lowerGain + tableDelta * (upperGain - lowerGain));
+
+		p.advance(UsePitch ? d.uptimeDelta * (double)d.pitchData[i] : d.uptimeDelta);
+	}
+
+	FloatVectorOperations::multiply(d.output, d.normaliseGain, d.numSamples);
+
+	d.phase = p.value;
+	d.uptime = p.uptime;
+}
+}
+
+void WavetableRenderKernel::process(Data& d)
+{
+	using namespace WavetableRenderHelpers;
+
+	if (d.tableModValues != nullptr)
+	{
+		if (d.pitchData != nullptr)
+			processModulatedTable<true>(d);
+		else
+			processModulatedTable<false>(d);
+	}
+	else
+	{
+		if (d.pitchData != nullptr)
+			processConstantTable<true>(d);
+		else
+			processConstantTable<false>(d);
+	}
+}
+
+void WavetableRenderKernel::crossfade(const float* from, float* to, int numSamples)
+{
+	const float delta = 1.0f / (float)numSamples;
+
+	for (int i = 0; i < numSamples; i++)
+	{
+		const float alpha = (float)(i + 1) * delta;
+		to[i] = from[i] + alpha * (to[i] - from[i]);
+	}
+}
+
 WavetableSynth::WavetableSynth(MainController *mc, const String &id, int numVoices) :
 	ModulatorSynth(mc, id, numVoices),
 	SliderPackProcessor(mc, 1),
@@ -121,7 +272,18 @@ WavetableSynthVoice::WavetableSynthVoice(ModulatorSynth *ownerSynth):
 
 float WavetableSynthVoice::getGainValue(float modValue)
 {
-	return wavetableSynth->getGainValueFromTable(modValue);
+	if (!wavetableSynth->isRenderingVoicesInParallel())
+		return wavetableSynth->getGainValueFromTable(modValue);
+
+	auto index = WavetableSynth::getGainTableIndex(modValue);
+
+	if (index != lastParallelGainIndex)
+	{
+		lastParallelGainIndex = index;
+		lastParallelGainValue = wavetableSynth->getGainValueForTableIndex(index);
+	}
+
+	return lastParallelGainValue;
 }
 
 void WavetableSynthVoice::calculateBlock(int startSample, int numSamples)
@@ -130,135 +292,67 @@ void WavetableSynthVoice::calculateBlock(int startSample, int numSamples)
 	const int samplesToCopy = numSamples;
 
 	const float *voicePitchValues = getOwnerSynth()->getPitchValuesForVoice();
-		
-	if (auto tableValues = getTableModulationValues())
-	{
-		while (--numSamples >= 0)
-		{
-			int index = (int)voiceUptime;
-
-			const int i1 = index % (tableSize);
-
-			int i2 = i1 + 1;
-
-			auto numTables = currentSound->getWavetableAmount();
-
-			if (i2 >= tableSize)
-			{
-				const float tableModValue = tableValues[startSample];
-				currentTableIndex = roundToInt(tableModValue * (double)(numTables-1));
-				i2 = 0;
-			}
-			
-			const float tableModValue = tableValues[startSample];
-			const float tableValue = jlimit<float>(0.0f, 1.0f, tableModValue) * (float)(numTables -1);
-
-			const int lowerTableIndex = (int)(tableValue);
-			const int upperTableIndex = jmin(numTables-1, lowerTableIndex + 1);
-			const float tableDelta = tableValue - (float)lowerTableIndex;
-			jassert(0.0f <= tableDelta && tableDelta <= 1.0f);
 
-			lowerTable = currentSound->getWaveTableData(lowerTableIndex);
-			upperTable = currentSound->getWaveTableData(upperTableIndex);
+	WavetableRenderKernel::Data d;
 
-			float tableGainValue = tableGainInterpolator.interpolateLinear(currentSound->getUnnormalizedGainValue(lowerTableIndex), currentSound->getUnnormalizedGainValue(upperTableIndex), tableDelta);
+	d.pitchData = voicePitchValues != nullptr ? voicePitchValues + startSample : nullptr;
+	d.tableModValues = getTableModulationValues();
 
-			tableGainValue *= getGainValue(tableModValue);
+	if (d.tableModValues != nullptr)
+		d.tableModValues += startSample;
+	else
+		d.constantTableModValue = static_cast<WavetableSynth*>(getOwnerSynth())->getConstantTableModValue();
 
-			float u1 = upperTable[i1];
-			float u2 = upperTable[i2];
+	// Pick the mip level for the highest pitch in this block
+	auto maxDelta = uptimeDelta;
 
-			float l1 = lowerTable[i1];
-			float l2 = lowerTable[i2];
+	if (d.pitchData != nullptr)
+		maxDelta *= (double)FloatVectorOperations::findMaximum(d.pitchData, numSamples);
 
-			const float alpha = float(voiceUptime) - (float)index;
-			//const float invAlpha = 1.0f - alpha;
+	const int mipLevel = currentSound->getMipLevelForDelta(maxDelta);
 
-			const float upperSample = tableGainInterpolator.interpolateLinear(u1, u2, alpha);
+	d.mipData = currentSound->getMipLevelData(mipLevel);
+	d.tableGainValues = currentSound->getUnnormalizedGainValues();
+	d.normaliseGain = 1.0f / currentSound->getUnnormalizedMaximum();
+	d.numTables = currentSound->getWavetableAmount();
+	d.tableSize = tableSize;
+	d.numSamples = numSamples;
+	d.uptimeDelta = uptimeDelta;
+	d.phase = tablePhase;
+	d.uptime = voiceUptime;
+	d.output = voiceBuffer.getWritePointer(0, startSample);
 
-			const float lowerSample = tableGainInterpolator.interpolateLinear(l1, l2, alpha);
+	auto previousLevel = d;
 
-			float sample = lowerTableIndex != upperTableIndex ? tableGainInterpolator.interpolateLinear(lowerSample, upperSample, tableDelta) : lowerSample;
-
-			sample *= tableGainValue;
+	WavetableRenderKernel::process(d);
 
-			sample *= 1.0f / currentSound->getUnnormalizedMaximum();
+	if (mipLevel != currentMipLevel)
+	{
+		// Render the block with the previous mip level into the second channel
+		// (it will be overwritten below) and fade to the new level
+		previousLevel.mipData = currentSound->getMipLevelData(currentMipLevel);
+		previousLevel.output = voiceBuffer.getWritePointer(1, startSample);
 
-			// Stereo mode assumed
-			voiceBuffer.setSample(0, startSample, sample);
+		WavetableRenderKernel::process(previousLevel);
+		WavetableRenderKernel::crossfade(previousLevel.output, d.output, numSamples);
 
-			jassert(voicePitchValues == nullptr || voicePitchValues[startSample] > 0.0f);
+		currentMipLevel = mipLevel;
+	}
 
-			const double delta = (uptimeDelta * (voicePitchValues == nullptr ? 1.0 : voicePitchValues[startSample]));
+	tablePhase = d.phase;
+	voiceUptime = d.uptime;
 
-			voiceUptime += delta;
+	const auto lastTableModValue = d.tableModValues != nullptr ? d.tableModValues[numSamples - 1] : d.constantTableModValue;
+	currentTableIndex = jlimit(0, d.numTables - 1, roundToInt(lastTableModValue * (float)(d.numTables - 1)));
 
-			++startSample;
-		}
+	if (d.tableModValues != nullptr)
+	{
+		for (int i = 0; i < numSamples; i++)
+			d.output[i] *= getGainValue(d.tableModValues[i]);
 	}
 	else
 	{
-		const float tableModValue = static_cast<WavetableSynth*>(getOwnerSynth())->getConstantTableModValue();
-
-		while (--numSamples >= 0)
-		{
-			int index = (int)voiceUptime;
-
-			const int i1 = index % (tableSize);
-
-			int i2 = i1 + 1;
-
-			auto numTables = currentSound->getWavetableAmount();
-
-			if (i2 >= tableSize)
-			{
-				i2 = 0;
-			}
-
-			const float tableValue = jlimit<float>(0.0f, 1.0f, tableModValue) * (float)(numTables - 1);
-
-			const int lowerTableIndex = (int)(tableValue);
-			const int upperTableIndex = jmin(numTables - 1, lowerTableIndex + 1);
-			const float tableDelta = tableValue - (float)lowerTableIndex;
-			jassert(0.0f <= tableDelta && tableDelta <= 1.0f);
-
-			lowerTable = currentSound->getWaveTableData(lowerTableIndex);
-			upperTable = currentSound->getWaveTableData(upperTableIndex);
-
-			float tableGainValue = tableGainInterpolator.interpolateLinear(currentSound->getUnnormalizedGainValue(lowerTableIndex), currentSound->getUnnormalizedGainValue(upperTableIndex), tableDelta);
-
-			tableGainValue *= getGainValue(tableModValue);
-
-			float u1 = upperTable[i1];
-			float u2 = upperTable[i2];
-
-			float l1 = lowerTable[i1];
-			float l2 = lowerTable[i2];
-
-			const float alpha = float(voiceUptime) - (float)index;
-			//const float invAlpha = 1.0f - alpha;
-
-			const float upperSample = tableGainInterpolator.interpolateLinear(u1, u2, alpha);
-
-			const float lowerSample = tableGainInterpolator.interpolateLinear(l1, l2, alpha);
-
-			float sample = lowerTableIndex != upperTableIndex ? tableGainInterpolator.interpolateLinear(lowerSample, upperSample, tableDelta) : lowerSample;
-
-			sample *= tableGainValue;
-
-			sample *= 1.0f / currentSound->getUnnormalizedMaximum();
-
-			// Stereo mode assumed
-			voiceBuffer.setSample(0, startSample, sample);
-
-			jassert(voicePitchValues == nullptr || voicePitchValues[startSample] > 0.0f);
-
-			const double delta = (uptimeDelta * (voicePitchValues == nullptr ? 1.0 : voicePitchValues[startSample]));
-
-			voiceUptime += delta;
-
-			++startSample;
-		}
+		FloatVectorOperations::multiply(d.output, getGainValue(d.constantTableModValue), numSamples);
 	}
 
 	if (auto modValues = getOwnerSynth()->getVoiceGainValues())
@@ -304,6 +398,7 @@ void WavetableSynthVoice::startNote(int midiNoteNumber, float /*velocity*/, Synt
 	upperTable = lowerTable;
 
 	nextTable = lowerTable;
+	tablePhase = 0.0;
 	nextGainValue = getGainValue(0.0);
 	nextTableIndex = 0;
 	currentTableIndex = 0;
@@ -314,6 +409,8 @@ void WavetableSynthVoice::startNote(int midiNoteNumber, float /*velocity*/, Synt
 	smoothSize = tableSize;
 	uptimeDelta = currentSound->getPitchRatio();
 	uptimeDelta *= getOwnerSynth()->getMainController()->getGlobalPitchFactor();
+
+	currentMipLevel = currentSound->getMipLevelForDelta(uptimeDelta);
 }
 
 WavetableSound::WavetableSound(const ValueTree &wavetableData)
@@ -345,6 +442,7 @@ WavetableSound::WavetableSound(const ValueTree &wavetableData)
 	unnormalizedMaximum = 0.0f;
 
 	normalizeTables();
+	createMipLevels();
 
 	pitchRatio = 1.0;
 }
@@ -364,6 +462,27 @@ const float * WavetableSound::getWaveTableData(int wavetableIndex) const
 	}
 }
 
+const float* WavetableSound::getMipLevelData(int mipLevel) const
+{
+	return wavetables.getReadPointer(jlimit(0, numMipLevels - 1, mipLevel));
+}
+
+int WavetableSound::getMipLevelForDelta(double delta) const
+{
+	// The level n contains (tableSize / 2^(n+1)) harmonics, so
+	// it can be played back with a delta up to 2^n without aliasing
+	int level = 0;
+	double maxDelta = 1.0;
+
+	while (delta > maxDelta && level < numMipLevels - 1)
+	{
+		maxDelta *= 2.0;
+		++level;
+	}
+
+	return level;
+}
+
 void WavetableSound::calculatePitchRatio(double playBackSampleRate)
 {
 	const double idealCycleLength = playBackSampleRate / MidiMessage::getMidiNoteInHertz(noteNumber);
@@ -395,4 +514,322 @@ void WavetableSound::normalizeTables()
 	maximum = 1.0f;
 }
 
+void WavetableSound::createMipLevels()
+{
+	numMipLevels = 1;
+
+	if (!isPowerOfTwo(wavetableSize) || wavetableSize < 4)
+		return;
+
+	const int order = roundToInt(std::log2((double)wavetableSize));
+
+	numMipLevels = jmin(MaxNumMipLevels, order);
+
+	wavetables.setSize(numMipLevels, wavetables.getNumSamples(), true, true);
+
+	juce::dsp::FFT fft(order);
+
+	HeapBlock<float> spectrum, levelData;
+	spectrum.calloc(wavetableSize * 2);
+	levelData.calloc(wavetableSize * 2);
+
+	for (int t = 0; t < wavetableAmount; t++)
+	{
+		const int offset = t * wavetableSize;
+
+		FloatVectorOperations::clear(spectrum, wavetableSize * 2);
+		FloatVectorOperations::copy(spectrum, wavetables.getReadPointer(0, offset), wavetableSize);
+		fft.performRealOnlyForwardTransform(spectrum);
+
+		for (int level = 1; level < numMipLevels; level++)
+		{
+			const int maxHarmonic = wavetableSize >> (level + 1);
+
+			FloatVectorOperations::copy(levelData, spectrum, wavetableSize * 2);
+
+			// remove the harmonics above the limit (and their mirrored bins)
+			for (int bin = maxHarmonic + 1; bin < wavetableSize - maxHarmonic; bin++)
+			{
+				levelData[bin * 2] = 0.0f;
+				levelData[bin * 2 + 1] = 0.0f;
+			}
+
+			fft.performRealOnlyInverseTransform(levelData);
+
+			FloatVectorOperations::copy(wavetables.getWritePointer(level, offset), levelData, wavetableSize);
+		}
+	}
+}
+
+#if HI_RUN_UNIT_TESTS
+
+class WavetableRenderBenchmark : public UnitTest
+{
+public:
+
+	WavetableRenderBenchmark() :
+		UnitTest("Wavetable render benchmark", "benchmark")
+	{}
+
+	void runTest() override
+	{
+		ScopedPointer<WavetableSound> sound = createSawSound();
+
+		testMipLevels(*sound);
+		testReference(*sound, false, false);
+		testReference(*sound, true, true);
+		testMipLevelCrossfade(*sound);
+
+		runBenchmark(*sound, false, false);
+		runBenchmark(*sound, false, true);
+		runBenchmark(*sound, true, false);
+		runBenchmark(*sound, true, true);
+	}
+
+private:
+
+	static constexpr int TableSize = 2048;
+	static constexpr int NumTables = 16;
+	static constexpr int BlockSize = 512;
+	static constexpr int NumRepetitions = 200;
+	static constexpr double SampleRate = 44100.0;
+
+	static WavetableSound* createSawSound()
+	{
+		HeapBlock<float> data;
+		data.calloc(TableSize * NumTables);
+
+		for (int t = 0; t < NumTables; t++)
+		{
+			// add some harmonics to the saw the higher the table index gets
+			const int numHarmonics = 32 + t * 32;
+
+			for (int h = 1; h <= numHarmonics; h++)
+			{
+				for (int i = 0; i < TableSize; i++)
+					data[t * TableSize + i] += std::sin(MathConstants<float>::twoPi * (float)(h * i) / (float)TableSize) / (float)h;
+			}
+		}
+
+		ValueTree v("wavetable");
+		v.setProperty("data", var(MemoryBlock(data.get(), sizeof(float) * TableSize * NumTables)), nullptr);
+		v.setProperty("amount", NumTables, nullptr);
+		v.setProperty("noteNumber", 60, nullptr);
+		v.setProperty("sampleRate", SampleRate, nullptr);
+
+		auto s = new WavetableSound(v);
+		s->calculatePitchRatio(SampleRate);
+		return s;
+	}
+
+	void testMipLevels(WavetableSound& s)
+	{
+		beginTest("Testing band-limited mip levels");
+
+		expectEquals(s.getNumMipLevels(), (int)WavetableSound::MaxNumMipLevels, "mip level amount");
+		expectEquals(s.getMipLevelForDelta(0.5), 0, "level for delta 0.5");
+		expectEquals(s.getMipLevelForDelta(3.0), 2, "level for delta 3.0");
+		expectEquals(s.getMipLevelForDelta(10000.0), s.getNumMipLevels() - 1, "level for huge delta");
+
+		const int order = roundToInt(std::log2((double)TableSize));
+		juce::dsp::FFT fft(order);
+		HeapBlock<float> spectrum;
+		spectrum.calloc(TableSize * 2);
+
+		for (int level = 1; level < s.getNumMipLevels(); level++)
+		{
+			const int maxHarmonic = TableSize >> (level + 1);
+
+			FloatVectorOperations::clear(spectrum, TableSize * 2);
+			FloatVectorOperations::copy(spectrum, s.getMipLevelData(level) + (NumTables - 1) * TableSize, TableSize);
+			fft.performFrequencyOnlyForwardTransform(spectrum);
+
+			float maxAboveLimit = 0.0f;
+
+			for (int bin = maxHarmonic + 1; bin < TableSize / 2; bin++)
+				maxAboveLimit = jmax(maxAboveLimit, spectrum[bin]);
+
+			expect(maxAboveLimit < spectrum[1] * 0.001f, "Level " + String(level) + " has harmonics above " + String(maxHarmonic));
+		}
+	}
+
+	void testReference(WavetableSound& s, bool useTableModulation, bool usePitch)
+	{
+		beginTest("Testing render kernel against reference" + getSuffix(useTableModulation, usePitch));
+
+		HeapBlock<float> tableValues, pitch, outputReference, output;
+		prepareData(tableValues, pitch, outputReference, output);
+
+		auto d1 = createData(s, useTableModulation ? tableValues.get() : nullptr, usePitch ? pitch.get() : nullptr, outputReference.get(), 0);
+		auto d2 = createData(s, useTableModulation ? tableValues.get() : nullptr, usePitch ? pitch.get() : nullptr, output.get(), 0);
+
+		float maxError = 0.0f;
+
+		for (int b = 0; b < 8; b++)
+		{
+			processReference(d1);
+			WavetableRenderKernel::process(d2);
+
+			for (int i = 0; i < BlockSize; i++)
+				maxError = jmax(maxError, std::abs(outputReference[i] - output[i]));
+		}
+
+		expect(maxError < 1e-3f, "render kernel deviates from reference: " + String(maxError));
+	}
+
+	void testMipLevelCrossfade(WavetableSound& s)
+	{
+		beginTest("Testing the crossfade between mip levels");
+
+		HeapBlock<float> tableValues, pitch, previousLevel, output;
+		prepareData(tableValues, pitch, previousLevel, output);
+
+		auto d1 = createData(s, nullptr, nullptr, previousLevel.get(), 0);
+		auto d2 = createData(s, nullptr, nullptr, output.get(), s.getNumMipLevels() - 1);
+
+		WavetableRenderKernel::process(d1);
+		WavetableRenderKernel::process(d2);
+
+		float maxDifference = 0.0f;
+
+		for (int i = 0; i < BlockSize; i++)
+			maxDifference = jmax(maxDifference, std::abs(previousLevel[i] - output[i]));
+
+		const float lastNewLevelSample = output[BlockSize - 1];
+
+		WavetableRenderKernel::crossfade(previousLevel, output, BlockSize);
+
+		// The first sample must stay close to the previous level so that there's no jump at the block start
+		expect(std::abs(output[0] - previousLevel[0]) <= maxDifference / (float)BlockSize + 1e-6f, "first sample jumps to the new level");
+		expectWithinAbsoluteError(output[BlockSize - 1], lastNewLevelSample, 1e-6f, "last sample isn't the new level");
+	}
+
+	void runBenchmark(WavetableSound& s, bool useTableModulation, bool usePitch)
+	{
+		beginTest("Benchmarking render kernel" + getSuffix(useTableModulation, usePitch));
+
+		HeapBlock<float> tableValues, pitch, outputReference, output;
+		prepareData(tableValues, pitch, outputReference, output);
+
+		// Use a high note so that the mip levels are used
+		auto level = s.getMipLevelForDelta(s.getPitchRatio() * 8.0);
+
+		auto d1 = createData(s, useTableModulation ? tableValues.get() : nullptr, usePitch ? pitch.get() : nullptr, outputReference.get(), 0);
+		auto d2 = createData(s, useTableModulation ? tableValues.get() : nullptr, usePitch ? pitch.get() : nullptr, output.get(), level);
+
+		auto referenceTime = measure([&]() { processReference(d1); });
+		auto kernelTime = measure([&]() { WavetableRenderKernel::process(d2); });
+
+		// The time of one block in milliseconds divided by the time it takes to render one voice
+		const double blockTime = 1000.0 * (double)BlockSize / SampleRate;
+
+		String message;
+		message << "voices per core: reference " << String(roundToInt(blockTime / jmax(0.000001, referenceTime)));
+		message << ", kernel " << String(roundToInt(blockTime / jmax(0.000001, kernelTime)));
+		message << " (" << String(referenceTime / jmax(0.000001, kernelTime), 2) << "x)";
+		logMessage(message);
+	}
+
+	static String getSuffix(bool useTableModulation, bool usePitch)
+	{
+		String s;
+		s << (useTableModulation ? " with table modulation" : " with constant table");
+		s << (usePitch ? " and pitch modulation" : "");
+		return s;
+	}
+
+	static void prepareData(HeapBlock<float>& tableValues, HeapBlock<float>& pitch, HeapBlock<float>& outputReference, HeapBlock<float>& output)
+	{
+		tableValues.calloc(BlockSize);
+		pitch.calloc(BlockSize);
+		outputReference.calloc(BlockSize);
+		output.calloc(BlockSize);
+
+		for (int i = 0; i < BlockSize; i++)
+		{
+			tableValues[i] = (float)i / (float)BlockSize;
+			pitch[i] = 0.8f + 0.4f * (float)i / (float)BlockSize;
+		}
+	}
+
+	static WavetableRenderKernel::Data createData(WavetableSound& s, const float* tableValues, const float* pitch, float* output, int mipLevel)
+	{
+		WavetableRenderKernel::Data d;
+		d.mipData = s.getMipLevelData(mipLevel);
+		d.tableGainValues = s.getUnnormalizedGainValues();
+		d.tableModValues = tableValues;
+		d.constantTableModValue = 0.37f;
+		d.pitchData = pitch;
+		d.output = output;
+		d.normaliseGain = 1.0f / s.getUnnormalizedMaximum();
+		d.numTables = s.getWavetableAmount();
+		d.tableSize = s.getTableSize();
+		d.numSamples = BlockSize;
+		d.uptimeDelta = s.getPitchRatio();
+		return d;
+	}
+
+	/** The per-sample implementation that was used before the render kernel. */
+	static void processReference(WavetableRenderKernel::Data& d)
+	{
+		Interpolator tableGainInterpolator;
+
+		for (int i = 0; i < d.numSamples; i++)
+		{
+			int index = (int)d.uptime;
+
+			const int i1 = index % (d.tableSize);
+
+			int i2 = i1 + 1;
+
+			if (i2 >= d.tableSize)
+				i2 = 0;
+
+			const float tableModValue = d.tableModValues != nullptr ? d.tableModValues[i] : d.constantTableModValue;
+			const float tableValue = jlimit<float>(0.0f, 1.0f, tableModValue) * (float)(d.numTables - 1);
+
+			const int lowerTableIndex = (int)(tableValue);
+			const int upperTableIndex = jmin(d.numTables - 1, lowerTableIndex + 1);
+			const float tableDelta = tableValue - (float)lowerTableIndex;
+
+			auto lowerTable = d.mipData + lowerTableIndex * d.tableSize;
+			auto upperTable = d.mipData + upperTableIndex * d.tableSize;
+
+			float tableGainValue = tableGainInterpolator.interpolateLinear(d.tableGainValues[lowerTableIndex], d.tableGainValues[upperTableIndex], tableDelta);
+
+			const float alpha = float(d.uptime) - (float)index;
+
+			const float upperSample = tableGainInterpolator.interpolateLinear(upperTable[i1], upperTable[i2], alpha);
+			const float lowerSample = tableGainInterpolator.interpolateLinear(lowerTable[i1], lowerTable[i2], alpha);
+
+			float sample = lowerTableIndex != upperTableIndex ? tableGainInterpolator.interpolateLinear(lowerSample, upperSample, tableDelta) : lowerSample;
+
+			sample *= tableGainValue;
+			sample *= d.normaliseGain;
+
+			d.output[i] = sample;
+
+			const double delta = (d.uptimeDelta * (d.pitchData == nullptr ? 1.0 : d.pitchData[i]));
+
+			d.uptime += delta;
+			d.phase = std::fmod(d.uptime, (double)d.tableSize);
+		}
+	}
+
+	/** Returns the average time in milliseconds that it takes to render one block. */
+	template <typename F> static double measure(const F& f)
+	{
+		auto start = Time::getMillisecondCounterHiRes();
+
+		for (int i = 0; i < NumRepetitions; i++)
+			f();
+
+		return (Time::getMillisecondCounterHiRes() - start) / (double)NumRepetitions;
+	}
+};
+
+static WavetableRenderBenchmark wavetableRenderBenchmark;
+
+#endif
+
 } // namespace hise
@@ -41,10 +41,55 @@ namespace hise { using namespace juce;
 
 class WavetableSynth;
 
+/** The render loop of the WavetableSynthVoice.
+
+	It renders a mono block of the selected mip level and morphs between the two
+	tables around the table index. All table pointers and gain values that don't change
+	during the block are resolved before the loop and the gain is applied with vector operations. 
+*/
+struct WavetableRenderKernel
+{
+	struct Data
+	{
+		const float* mipData = nullptr;
+		const float* tableGainValues = nullptr;
+		const float* tableModValues = nullptr;
+		const float* pitchData = nullptr;
+		float* output = nullptr;
+
+		float constantTableModValue = 0.0f;
+		float normaliseGain = 1.0f;
+
+		int numTables = 0;
+		int tableSize = 0;
+		int numSamples = 0;
+
+		double uptimeDelta = 1.0;
+
+		/** The position within the table (wrapped around the table size). */
+		double phase = 0.0;
+
+		/** The total amount of table samples that were rendered. */
+		double uptime = 0.0;
+	};
+
+	/** Renders the block and advances the phase and uptime. */
+	static void process(Data& d);
+
+	/** Fades from the first buffer to the second buffer (in place) over the given amount of samples. 
+	
+		This is used to avoid a discontinuity when the voice switches to another mip level.
+	*/
+	static void crossfade(const float* from, float* to, int numSamples);
+};
+
 class WavetableSound: public ModulatorSynthSound
 {
 public:
 
+	/** The maximum amount of band-limited mip levels (including the original tables). */
+	static constexpr int MaxNumMipLevels = 8;
+
 	/** Creates a new wavetable sound.
 	*
 	*	You have to supply a ValueTree with the following properties:
@@ -67,6 +112,20 @@ public:
 	*/
 	const float *getWaveTableData(int wavetableIndex) const;
 
+	/** Returns a read pointer to the first table of the given mip level. 
+	
+		Level 0 contains the original tables, every further level contains only the lower half
+		of the harmonics of the previous level. 
+	*/
+	const float* getMipLevelData(int mipLevel) const;
+
+	/** Returns the mip level that can be played back without aliasing if the table is advanced by the given amount of samples per output sample. */
+	int getMipLevelForDelta(double delta) const;
+
+	int getNumMipLevels() const { return numMipLevels; }
+
+	const float* getUnnormalizedGainValues() const { return unnormalizedGainValues; }
+
 	float getUnnormalizedMaximum()
 	{
 		return unnormalizedMaximum;
@@ -97,6 +156,9 @@ public:
 
 	void normalizeTables();
 
+	/** Creates the band-limited mip levels. This needs a table size that is a power of two, otherwise only the original tables will be used. */
+	void createMipLevels();
+
 	float getUnnormalizedGainValue(int tableIndex)
 	{
 		jassert(tableIndex < 64);
@@ -122,6 +184,7 @@ private:
 
 	int wavetableSize;
 	int wavetableAmount;
+	int numMipLevels = 1;
 };
 
 class WavetableSynth;
@@ -199,6 +262,13 @@ private:
 
 	int smoothSize;
 
+	double tablePhase = 0.0;
+	int currentMipLevel = 0;
+
+	// The gain table cache of the synth can't be used when the voices are rendered in parallel
+	int lastParallelGainIndex = -1;
+	float lastParallelGainValue = 1.0f;
+
 };
 
 
@@ -213,6 +283,8 @@ public:
 
 	SET_PROCESSOR_NAME("WavetableSynth", "Wavetable Synthesiser", "A two-dimensional wavetable synthesiser.");
 
+	bool canBeProcessedConcurrently() const override { return true; }
+
 	enum EditorStates
 	{
 		TableIndexChainShow = ModulatorSynth::numEditorStates
@@ -261,10 +333,20 @@ public:
 
 	void getWaveformTableValues(int displayIndex, float const** tableValues, int& numValues, float& normalizeValue) override;
 
-	float getGainValueFromTable(float level)
+	static int getGainTableIndex(float level)
 	{
 		int index = roundToInt(128 * level);
-		index = jlimit<int>(0, 127, roundToInt(128.0 * index));
+		return jlimit<int>(0, 127, roundToInt(128.0 * index));
+	}
+
+	float getGainValueForTableIndex(int index) const
+	{
+		return pack->getValue(index);
+	}
+
+	float getGainValueFromTable(float level)
+	{
+		auto index = getGainTableIndex(level);
 
 		if (lastGainIndex != index)
 		{
@@ -306,6 +388,8 @@ public:
 
 	int getNumChildProcessors() const override { return numInternalChains;	};
 
+	bool supportsParallelVoiceRendering() const override { return true; }
+
 	int getNumInternalChains() const override {return numInternalChains; };
 
 	virtual Processor *getChildProcessor(int processorIndex) override
@@ -84,6 +84,9 @@ SET_DOCUMENTATION(ModulatorSampler)
 
     ADD_PARAMETER_DOC(UseStaticMatrix,
         "If this is true, then the routing matrix will not be resized when you load a sample map with another mic position amount.");
+
+	ADD_PARAMETER_DOC(InterpolationMode,
+		"The interpolation that is used for resampling. `0` uses linear interpolation, `1` uses 4-point Hermite interpolation (better quality for pitched samples, slightly more CPU).");
     
 	ADD_CHAIN_DOC(SampleStartModulation, "Sample Start", 
 		"Allows modification of the sample start if the sound allows this. The modulation range is depending on the *SampleStartMod* value of each sample.");
@@ -149,6 +152,7 @@ temporaryVoiceBuffer(DEFAULT_BUFFER_TYPE_IS_FLOAT, 2, 0)
 	parameterNames.add("Reversed");
     parameterNames.add("UseStaticMatrix");
 	parameterNames.add("LowPassEnvelopeOrder");
+	parameterNames.add("InterpolationMode");
 
 	editorStateIdentifiers.add("SampleStartChainShown");
 	editorStateIdentifiers.add("SettingsShown");
@@ -336,6 +340,7 @@ void ModulatorSampler::restoreFromValueTree(const ValueTree &v)
 	loadAttribute(Reversed, "Reversed");
 
 	loadAttribute(SamplerRepeatMode, "SamplerRepeatMode");
+	loadAttribute(InterpolationMode, "InterpolationMode");
 	loadAttribute(Purged, "Purged");
 
 	auto savedMap = v.getChildWithName("samplemap");
@@ -377,6 +382,7 @@ ValueTree ModulatorSampler::exportAsValueTree() const
 	saveAttribute(Reversed, "Reversed");
 	v.setProperty("NumChannels", numChannels, nullptr);
     saveAttribute(UseStaticMatrix, "UseStaticMatrix");
+	saveAttribute(InterpolationMode, "InterpolationMode");
 
 	ValueTree channels("channels");
 
@@ -450,6 +456,7 @@ float ModulatorSampler::getAttribute(int parameterIndex) const
 	case Reversed:			return reversed ? 1.0f : 0.0f;
     case UseStaticMatrix:   return useStaticMatrix ? 1.0f : 0.0f;
 	case LowPassEnvelopeOrder: return (float)lowPassOrder * 6.0f;
+	case InterpolationMode:	return (float)(int)interpolationMode;
 	default:				jassertfalse; return -1.0f;
 	}
 }
@@ -485,6 +492,16 @@ void ModulatorSampler::setInternalAttribute(int parameterIndex, float newValue)
 		if (envelopeFilter != nullptr)
 			envelopeFilter->setOrder(lowPassOrder);
 		break;
+	case InterpolationMode:
+	{
+		auto numModes = (int)SampleInterpolationMode::numInterpolationModes;
+		interpolationMode = (SampleInterpolationMode)jlimit(0, numModes - 1, roundToInt(newValue));
+
+		for (auto v : voices)
+			static_cast<ModulatorSamplerVoice*>(v)->setInterpolationMode(interpolationMode);
+
+		break;
+	}
 	default:				jassertfalse; break;
 	}
 }
@@ -676,6 +693,36 @@ double ModulatorSampler::getDiskUsage()
 	return diskUsage * 100.0;
 }
 
+void ModulatorSampler::prepareParallelVoiceRendering(int numThreads)
+{
+	// The buffers are never removed because the voices might still point to them
+	while (parallelTemporaryVoiceBuffers.size() < numThreads - 1)
+		parallelTemporaryVoiceBuffers.add(new hlac::HiseSampleBuffer(temporaryVoiceBuffer.isFloatingPoint(), 2, 0));
+
+	updateParallelTemporaryVoiceBuffers();
+}
+
+void ModulatorSampler::prepareVoiceForParallelRendering(ModulatorSynthVoice* v, int threadIndex)
+{
+	auto b = threadIndex == 0 ? &temporaryVoiceBuffer : parallelTemporaryVoiceBuffers[threadIndex - 1];
+	static_cast<ModulatorSamplerVoice*>(v)->setTemporaryVoiceBuffer(b);
+}
+
+void ModulatorSampler::updateParallelTemporaryVoiceBuffers()
+{
+	for (auto b : parallelTemporaryVoiceBuffers)
+	{
+		if (b->isFloatingPoint() != temporaryVoiceBuffer.isFloatingPoint())
+			*b = hlac::HiseSampleBuffer(temporaryVoiceBuffer.isFloatingPoint(), 2, 0);
+
+		if (b->getNumSamples() < temporaryVoiceBuffer.getNumSamples())
+		{
+			b->setSize(2, temporaryVoiceBuffer.getNumSamples());
+			b->clear();
+		}
+	}
+}
+
 void ModulatorSampler::refreshMemoryUsage()
 {
 	if (sampleMap == nullptr)
@@ -727,6 +774,8 @@ void ModulatorSampler::refreshMemoryUsage()
         }
 	}
 
+	updateParallelTemporaryVoiceBuffers();
+
 	const int64 streamBufferSizePerVoice = 2 *				// two buffers
 		bufferSize *		// buffer size per buffer
 		(sampleMap->isMonolith() ? 2 : 4) *  // bytes per sample
@@ -781,6 +830,7 @@ void ModulatorSampler::setVoiceAmountInternal()
 			}
 
 			dynamic_cast<ModulatorSamplerVoice*>(voices.getLast())->setStreamingBufferDataType(temporaryVoiceBuffer.isFloatingPoint());
+			dynamic_cast<ModulatorSamplerVoice*>(voices.getLast())->setInterpolationMode(interpolationMode);
 
 			if (Processor::getSampleRate() != -1.0)
 			{
@@ -1523,6 +1573,13 @@ bool ModulatorSampler::preloadAllSamples()
 	auto& progress = getMainController()->getSampleManager().getPreloadProgress();
 
 	auto threadPool = getMainController()->getSampleManager().getGlobalSampleThreadPool();
+	auto preloadPool = getMainController()->getSampleManager().getPreloadThreadPool();
+
+	const double startTime = Time::getMillisecondCounterHiRes();
+
+	// If the parallel preloading is available, the sounds will be collected here and loaded afterwards
+	PreloadList soundsToPreload;
+	ReferenceCountedArray<ModulatorSamplerSound> soundsToReverse;
 
 	while (auto sound = sIter.getNextSound())
 	{
@@ -1535,10 +1592,15 @@ bool ModulatorSampler::preloadAllSamples()
 		{
 			auto s = sound->getReferenceToSound().get();
 
-			progress = (double)currentIndex++ / (double)numToLoad;
+			if (preloadPool != nullptr)
+				addSoundToPreload(soundsToPreload, s, currentIndex);
+			else
+			{
+				progress = (double)currentIndex++ / (double)numToLoad;
 
-			if (!preloadSample(s, preloadSizeToUse))
-				return false;
+				if (!preloadSample(s, preloadSizeToUse))
+					return false;
+			}
 		}
 		else
 		{
@@ -1546,22 +1608,75 @@ bool ModulatorSampler::preloadAllSamples()
 			{
 				const bool isEnabled = getChannelData(j).enabled;
 
-				progress = (double)currentIndex++ / (double)numToLoad;
-
 				if (auto s = sound->getReferenceToSound(j))
 				{
 					if (isEnabled)
 					{
+						if (preloadPool != nullptr)
+						{
+							addSoundToPreload(soundsToPreload, s.get(), currentIndex);
+							continue;
+						}
+
+						progress = (double)currentIndex++ / (double)numToLoad;
+
 						if (!preloadSample(s.get(), preloadSizeToUse))
 							return false;
 					}
 					else
+					{
+						progress = (double)currentIndex++ / (double)numToLoad;
 						s->setPurged(true);
+					}
 				}
 			}
 		}
 
-		sound->setReversed(isReversed);
+		if (preloadPool != nullptr)
+			soundsToReverse.add(sound);
+		else
+			sound->setReversed(isReversed);
+	}
+
+	if (preloadPool != nullptr)
+	{
+		if (!preloadSamplesInParallel(*preloadPool, soundsToPreload.sounds, preloadSizeToUse, currentIndex, numToLoad))
+			return false;
+
+		for (auto sound : soundsToReverse)
+			sound->setReversed(isReversed);
+	}
+
+	{
+		PreloadStatistics stats;
+
+		stats.milliSeconds = Time::getMillisecondCounterHiRes() - startTime;
+		stats.numThreads = preloadPool != nullptr ? preloadPool->getNumThreads() : 1;
+
+		ModulatorSampler::SoundIterator statIter(this);
+
+		while (auto sound = statIter.getNextSound())
+		{
+			for (int j = 0; j < sound->getNumMultiMicSamples(); j++)
+			{
+				if (auto s = sound->getReferenceToSound(j))
+				{
+					stats.numBytes += (int64)s->getActualPreloadSize();
+					stats.numSounds++;
+				}
+			}
+		}
+
+		{
+			SpinLock::ScopedLockType sl(preloadStatisticsLock);
+			lastPreloadStatistics = stats;
+		}
+
+		String s;
+		s << "Preloaded " << String((double)stats.numBytes / 1024.0 / 1024.0, 1) << " MB in " << String(stats.milliSeconds, 0) << " ms (";
+		s << String(stats.getMegaBytesPerSecond(), 1) << " MB/s, " << String(stats.numThreads) << " threads)";
+
+		debugToConsole(this, s);
 	}
 
 	refreshMemoryUsage();
@@ -1573,32 +1688,144 @@ bool ModulatorSampler::preloadAllSamples()
 }
 
 
+bool ModulatorSampler::preloadSamplesInParallel(ThreadPool& pool, const ReferenceCountedArray<StreamingSamplerSound>& soundsToPreload, const int preloadSizeToUse, int numAlreadyProcessed, int numToLoad)
+{
+	if (soundsToPreload.isEmpty())
+		return true;
+
+	auto& progress = getMainController()->getSampleManager().getPreloadProgress();
+	auto loadingThread = getMainController()->getSampleManager().getGlobalSampleThreadPool();
+
+	std::atomic<int> nextIndex = { 0 };
+	std::atomic<int> numLoaded = { 0 };
+	std::atomic<bool> shouldAbort = { false };
+
+	const int numJobs = jmin(pool.getNumThreads(), soundsToPreload.size());
+	std::atomic<int> numActiveJobs = { numJobs };
+	WaitableEvent allJobsFinished;
+
+	String errorMessage;
+	SpinLock errorLock;
+
+	// Every job takes the next sound until the list is exhausted, so slow files won't block the other workers.
+	for (int i = 0; i < numJobs; i++)
+	{
+		pool.addJob([&]()
+		{
+			while (!shouldAbort.load())
+			{
+				auto index = nextIndex++;
+
+				if (index >= soundsToPreload.size())
+					break;
+
+				auto thisError = tryPreloadSample(soundsToPreload.getUnchecked(index).get(), preloadSizeToUse);
+
+				if (thisError.isNotEmpty())
+				{
+					SpinLock::ScopedLockType sl(errorLock);
+
+					if (errorMessage.isEmpty())
+						errorMessage = thisError;
+
+					shouldAbort.store(true);
+				}
+
+				numLoaded++;
+			}
+
+			if (--numActiveJobs == 0)
+				allJobsFinished.signal();
+		});
+	}
+
+	while (!allJobsFinished.wait(20))
+	{
+		progress = (double)(numAlreadyProcessed + numLoaded.load()) / (double)numToLoad;
+
+		if (loadingThread->threadShouldExit())
+			shouldAbort.store(true);
+	}
+
+	progress = (double)(numAlreadyProcessed + numLoaded.load()) / (double)numToLoad;
+
+	if (errorMessage.isNotEmpty())
+	{
+		reportPreloadError(errorMessage);
+		return false;
+	}
+
+	return !loadingThread->threadShouldExit();
+}
+
+bool ModulatorSampler::PreloadList::add(StreamingSamplerSound* s)
+{
+	if (lookup.contains(s))
+		return false;
+
+	lookup.set(s, sounds.size());
+	sounds.add(s);
+	return true;
+}
+
+void ModulatorSampler::addSoundToPreload(PreloadList& soundsToPreload, StreamingSamplerSound* s, int& numAlreadyProcessed)
+{
+	if (!soundsToPreload.add(s))
+		numAlreadyProcessed++;
+}
+
+double ModulatorSampler::PreloadStatistics::getMegaBytesPerSecond() const noexcept
+{
+	if (milliSeconds <= 0.0)
+		return 0.0;
+
+	return ((double)numBytes / 1024.0 / 1024.0) / (milliSeconds * 0.001);
+}
+
+ModulatorSampler::PreloadStatistics ModulatorSampler::getLastPreloadStatistics() const
+{
+	SpinLock::ScopedLockType sl(preloadStatisticsLock);
+	return lastPreloadStatistics;
+}
+
 bool ModulatorSampler::preloadSample(StreamingSamplerSound * s, const int preloadSizeToUse)
 {
-	jassert(s != nullptr);
+	auto errorMessage = tryPreloadSample(s, preloadSizeToUse);
 
-	String fileName = s->getFileName(false);
+	if (errorMessage.isEmpty())
+		return true;
+
+	reportPreloadError(errorMessage);
+	return false;
+}
+
+String ModulatorSampler::tryPreloadSample(StreamingSamplerSound * s, const int preloadSizeToUse)
+{
+	jassert(s != nullptr);
 
 	try
 	{
 		s->setPreloadSize(s->hasActiveState() ? preloadSizeToUse : 0, true);
 		s->closeFileHandle();
-		return true;
+		return {};
 	}
 	catch (StreamingSamplerSound::LoadingError l)
 	{
 		String x;
 		x << "Error at preloading sample " << l.fileName << ": " << l.errorDescription;
-		getMainController()->getDebugLogger().logMessage(x);
+		return x;
+	}
+}
+
+void ModulatorSampler::reportPreloadError(const String& x)
+{
+	getMainController()->getDebugLogger().logMessage(x);
 
 #if USE_FRONTEND
-		getMainController()->sendOverlayMessage(DeactiveOverlay::State::CustomErrorMessage, x);
+	getMainController()->sendOverlayMessage(DeactiveOverlay::State::CustomErrorMessage, x);
 #else
-		debugError(this, x);
+	debugError(this, x);
 #endif
-
-		return false;
-	}
 }
 
 ModulatorSampler::ScopedUpdateDelayer::ScopedUpdateDelayer(ModulatorSampler* s) :
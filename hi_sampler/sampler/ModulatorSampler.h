@@ -204,6 +204,8 @@ public:
 
 	SET_PROCESSOR_NAME("StreamingSampler", "Sampler", "The main sampler class of HISE.");
 
+	bool canBeProcessedConcurrently() const override { return true; }
+
 	/** Special Parameters for the ModulatorSampler. */
 	enum Parameters
 	{
@@ -219,6 +221,7 @@ public:
 		Reversed,
         UseStaticMatrix,
 		LowPassEnvelopeOrder,
+		InterpolationMode,
 		numModulatorSamplerParameters
 	};
 
@@ -282,6 +285,13 @@ public:
 
 	void prepareToPlay(double sampleRate, int samplesPerBlock) override;;
 
+	/** The voices can be rendered in parallel unless they use the crossfade groups or the envelope filter (which both write into data of the sampler). */
+	bool supportsParallelVoiceRendering() const override { return !crossfadeGroups && envelopeFilter == nullptr; }
+
+	void prepareParallelVoiceRendering(int numThreads) override;
+
+	void prepareVoiceForParallelRendering(ModulatorSynthVoice* v, int threadIndex) override;
+
 	ProcessorEditorBody* createEditor(ProcessorEditor *parentEditor) override;
 
 	void loadCacheFromFile(File &f);;
@@ -309,6 +319,27 @@ public:
 	/** Scans all sounds and voices and adds their memory usage. */
 	void refreshMemoryUsage();
 
+	/** The throughput of the last preloadAllSamples() call. */
+	struct PreloadStatistics
+	{
+		double getMegaBytesPerSecond() const noexcept;
+
+		/** The time of the whole preloading in milliseconds. */
+		double milliSeconds = 0.0;
+
+		/** The size of all preload buffers (a shared sound is counted for every sample that uses it). */
+		int64 numBytes = 0;
+
+		/** The number of loaded sounds (including all mic positions). */
+		int numSounds = 0;
+
+		/** The number of threads that preloaded the samples. */
+		int numThreads = 1;
+	};
+
+	/** Returns the statistics of the last sample preloading. */
+	PreloadStatistics getLastPreloadStatistics() const;
+
 	int getNumActiveVoices() const override
 	{
 		if (purged) return 0;
@@ -415,6 +446,37 @@ public:
 
 	bool preloadSample(StreamingSamplerSound * s, const int preloadSizeToUse);
 
+	/** Preloads the given sounds using the worker threads of the pool. 
+	
+		This is called from preloadAllSamples() if the parallel preloading is enabled and blocks until all sounds are loaded
+		(or the loading thread should exit). 
+
+		All samples of a compressed monolith file share one HLAC decoder which is locked while decoding, so the samples
+		of the same file are still decoded one after another. The speedup comes from decoding multiple monolith files
+		at once (eg. the mic positions of a multimic map, which use one file per channel) and from uncompressed samples.
+	*/
+	bool preloadSamplesInParallel(ThreadPool& pool, const ReferenceCountedArray<StreamingSamplerSound>& soundsToPreload, const int preloadSizeToUse, int numAlreadyProcessed, int numToLoad);
+
+	/** The list of sounds for the parallel preloading. */
+	struct PreloadList
+	{
+		/** Adds the sound if it's not in the list yet. Returns false if it was a duplicate. */
+		bool add(StreamingSamplerSound* s);
+
+		ReferenceCountedArray<StreamingSamplerSound> sounds;
+
+	private:
+
+		HashMap<const void*, int> lookup;
+	};
+
+	/** Adds the sound to the list for the parallel preloading.
+	
+		If the pool allows duplicate samples, multiple samples share the same sound. In this case it's only added once
+		(so that two workers never preload the same sound), and the duplicate is counted as processed instead.
+	*/
+	static void addSoundToPreload(PreloadList& soundsToPreload, StreamingSamplerSound* s, int& numAlreadyProcessed);
+
 	bool saveSampleMap() const;
 
 	bool saveSampleMapAsReference() const;
@@ -678,6 +740,14 @@ public:
 
 private:
 
+	/** Preloads the sample and returns the error message if something went wrong. This can be called from any thread. */
+	static String tryPreloadSample(StreamingSamplerSound * s, const int preloadSizeToUse);
+
+	void reportPreloadError(const String& errorMessage);
+
+	mutable SpinLock preloadStatisticsLock;
+	PreloadStatistics lastPreloadStatistics;
+
 	int lockVelocity = -1;
 	int lockRRGroup = -1;
 
@@ -809,8 +879,14 @@ private:
 
 	hlac::HiseSampleBuffer temporaryVoiceBuffer;
 
+	// One temporary voice buffer for each worker thread if the voices are rendered in parallel
+	OwnedArray<hlac::HiseSampleBuffer> parallelTemporaryVoiceBuffers;
+
+	void updateParallelTemporaryVoiceBuffers();
+
 	bool delayUpdate = false;
 	int lowPassOrder = 0;
+	SampleInterpolationMode interpolationMode = SampleInterpolationMode::Linear;
 
 	float groupGainValues[8];
 	float currentCrossfadeValue;
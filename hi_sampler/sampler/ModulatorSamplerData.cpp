@@ -1246,12 +1246,45 @@ juce::AudioFormatWriter* MonolithExporter::createWriter(hlac::HiseLosslessAudioF
 	auto hWriter = dynamic_cast<hlac::HiseLosslessAudioFormatWriter*>(writer.get());
 
 	hWriter->setOptions(options);
-
-	
+	hWriter->setThreadPool(getEncoderThreadPool());
 
 	return writer.release();
 }
 
+ThreadPool* MonolithExporter::getEncoderThreadPool()
+{
+	if (encoderPool == nullptr)
+	{
+		auto numThreads = jmax(1, SystemStats::getNumCpus());
+
+		if (numThreads < 2)
+			return nullptr;
+
+		encoderPool = new ThreadPool(numThreads);
+	}
+
+	return encoderPool;
+}
+
+void MonolithExporter::reportEncodingSpeed(int64 numBytesEncoded, double milliSeconds)
+{
+	const double seconds = milliSeconds * 0.001;
+	const double megaBytes = (double)numBytesEncoded / 1024.0 / 1024.0;
+	const double megaBytesPerSecond = seconds > 0.0 ? megaBytes / seconds : 0.0;
+	const int numThreads = encoderPool != nullptr ? encoderPool->getNumThreads() : 1;
+
+	String s;
+	s << "Encoded " << String(megaBytes, 1) << " MB in " << String(seconds, 1) << " s (";
+	s << String(megaBytesPerSecond, 1) << " MB/s, ";
+	s << String(megaBytesPerSecond / (double)numThreads, 1) << " MB/s per core, ";
+	s << String(numThreads) << " threads)";
+
+	showStatusMessage(s);
+
+	if (sampleMap != nullptr)
+		debugToConsole(sampleMap->getSampler(), s);
+}
+
 int64 MonolithExporter::getNumBytesForSplitSize() const
 {
 	auto mb = getComboBoxComponent("splitsize")->getText().getIntValue();
@@ -1387,6 +1420,8 @@ void MonolithExporter::writeFiles(int channelIndex, bool overwriteExistingData)
 
 		int64 numBytesWritten = 0;
 
+		const auto encodingStart = Time::getMillisecondCounterHiRes();
+
 		for (int i = 0; i < channelList->size(); i++)
 		{
 			auto s = channelList->getUnchecked(i);
@@ -1402,12 +1437,14 @@ void MonolithExporter::writeFiles(int channelIndex, bool overwriteExistingData)
 
 			if (reader != nullptr)
 			{
-				writer->writeFromAudioReader(*reader, 0, -1);
-				
 				if (auto hWriter = dynamic_cast<hlac::HiseLosslessAudioFormatWriter*>(writer.get()))
 				{
+					// Use bigger chunks so that the encoder threads have enough blocks to work with
+					hWriter->writeFromAudioReaderWithChunkSize(*reader, COMPRESSION_BLOCK_SIZE * 256);
 					numBytesWritten = hWriter->getNumBytesWritten();
 				}
+				else
+					writer->writeFromAudioReader(*reader, 0, -1);
 			}
 			else
 			{
@@ -1459,6 +1496,8 @@ void MonolithExporter::writeFiles(int channelIndex, bool overwriteExistingData)
 		writer->flush();
 		writer = nullptr;
 
+		reportEncodingSpeed(numSamplesToWrite * numChannelsInSample * 2, Time::getMillisecondCounterHiRes() - encodingStart);
+
 		if (monolithFileReference != nullptr && channelIndex == 0)
 		{
 			// If we're exporting multimic samples without splitting, we
@@ -552,6 +552,14 @@ private:
 
 	AudioFormatWriter* createWriter(hlac::HiseLosslessAudioFormat& hlaf, const File& f, bool isMono);
 
+	/** Returns the thread pool that is used by the HLAC encoder to compress the blocks in parallel. */
+	ThreadPool* getEncoderThreadPool();
+
+	/** Creates a console message with the throughput of the encoder. */
+	void reportEncodingSpeed(int64 numBytesEncoded, double milliSeconds);
+
+	ScopedPointer<ThreadPool> encoderPool;
+
 	/** The max monolith size is 2GB - 60MB (to guarantee to stay below 2GB for FAT32. */
 	//constexpr static int maxMonolithSize = 2084569088;
 
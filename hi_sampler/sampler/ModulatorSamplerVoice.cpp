@@ -330,6 +330,16 @@ void ModulatorSamplerVoice::setStreamingBufferDataType(bool shouldBeFloat)
 	wrappedVoice.loader.setStreamingBufferDataType(shouldBeFloat);
 }
 
+void ModulatorSamplerVoice::setInterpolationMode(SampleInterpolationMode newMode)
+{
+	wrappedVoice.setInterpolationMode(newMode);
+}
+
+void ModulatorSamplerVoice::setTemporaryVoiceBuffer(hlac::HiseSampleBuffer* buffer)
+{
+	wrappedVoice.setTemporaryVoiceBuffer(buffer);
+}
+
 float ModulatorSamplerVoice::getConstantCrossfadeModulationValue() const noexcept
 {
 	return sampler->getConstantCrossFadeModulationValue();
@@ -345,6 +355,9 @@ const float * ModulatorSamplerVoice::getCrossfadeModulationValues(int startSampl
 
 void ModulatorSamplerVoice::resetVoice()
 {
+	if (deferResetIfRenderingInParallel())
+		return;
+
 	sampler->resetNoteDisplay(this->getCurrentlyPlayingNote() + getTransposeAmount());
 
 	wrappedVoice.resetVoice();
@@ -622,8 +635,23 @@ void MultiMicModulatorSamplerVoice::setStreamingBufferDataType(bool shouldBeFloa
 	}
 }
 
+void MultiMicModulatorSamplerVoice::setInterpolationMode(SampleInterpolationMode newMode)
+{
+	for (auto v : wrappedVoices)
+		v->setInterpolationMode(newMode);
+}
+
+void MultiMicModulatorSamplerVoice::setTemporaryVoiceBuffer(hlac::HiseSampleBuffer* buffer)
+{
+	for (auto v : wrappedVoices)
+		v->setTemporaryVoiceBuffer(buffer);
+}
+
 void MultiMicModulatorSamplerVoice::resetVoice()
 {
+	if (deferResetIfRenderingInParallel())
+		return;
+
 	sampler->resetNoteDisplay(this->getCurrentlyPlayingNote());
 
 	for (int i = 0; i < wrappedVoices.size(); i++)
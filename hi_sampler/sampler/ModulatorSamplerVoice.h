@@ -78,6 +78,11 @@ public:
 
 	virtual void setStreamingBufferDataType(bool shouldBeFloat);
 
+	virtual void setInterpolationMode(SampleInterpolationMode newMode);
+
+	/** Sets the buffer that is used for the resampling (each thread needs its own buffer when the voices are rendered in parallel). */
+	virtual void setTemporaryVoiceBuffer(hlac::HiseSampleBuffer* buffer);
+
 	// ================================================================================================================
 
 	float getConstantCrossfadeModulationValue() const noexcept;
@@ -147,6 +152,10 @@ public:
 
 	void setStreamingBufferDataType(bool shouldBeFloat) override;
 
+	void setInterpolationMode(SampleInterpolationMode newMode) override;
+
+	void setTemporaryVoiceBuffer(hlac::HiseSampleBuffer* buffer) override;
+
 	/** Resets the display value for the current note. */
 	void resetVoice() override;
 
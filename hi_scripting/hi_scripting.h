@@ -60,6 +60,16 @@ compile / debug cycle and don't need all nodes in scriptnode you might want to t
 #define INCLUDE_BIG_SCRIPTNODE_OBJECT_COMPILATION 1
 #endif
 
+/** Config: HISE_USE_SCRIPT_BYTECODE
+
+If this is true, the script callbacks will be lowered to a register bytecode and executed by a
+small VM instead of walking the syntax tree. In the HISE backend this is also enabled by the
+EnableOptimizations setting.
+*/
+#ifndef HISE_USE_SCRIPT_BYTECODE
+#define HISE_USE_SCRIPT_BYTECODE 0
+#endif
+
 // Periodically dumps the value tree of a dsp network
 #define DUMP_SCRIPTNODE_VALUETREE 1
 
@@ -157,6 +157,7 @@ void JavascriptMidiProcessor::processHiseEvent(HiseEvent &m)
 	else
 	{
 		ADD_GLITCH_DETECTOR(this, DebugLogger::Location::ScriptMidiEventCallback);
+		ADD_AUDIO_PROFILER_SCOPE(this, DebugLogger::Location::ScriptMidiEventCallback);
 
 		if (currentMidiMessage != nullptr)
 		{
@@ -275,6 +276,8 @@ void JavascriptMidiProcessor::runScriptCallbacks()
 	{
 		if (!currentEvent->isIgnored() && currentEvent->getChannel() == getIndexInChain())
 		{
+			ADD_AUDIO_PROFILER_SCOPE(this, DebugLogger::Location::TimerCallback);
+
 			runTimerCallback(currentEvent->getTimeStamp());
 			currentEvent->ignoreEvent(true); 
 		}
@@ -489,7 +492,11 @@ void JavascriptPolyphonicEffect::prepareToPlay(double sampleRate, int samplesPer
 		auto numChannels = dynamic_cast<RoutableProcessor*>(getParentProcessor(true))->getMatrix().getNumSourceChannels();
 
         setVoiceKillerToUse(this);
+
+		if (auto synth = dynamic_cast<ModulatorSynth*>(getParentProcessor(true, false)))
+			synth->addVoiceLimitListener(this);
         
+		n->getPolyHandler()->setNumVoiceSlots(VoiceDataStack::getNumVoiceSlots(this));
 		n->setNumChannels(numChannels);
 		n->prepareToPlay(sampleRate, (double)samplesPerBlock);
 	}
@@ -499,6 +506,13 @@ void JavascriptPolyphonicEffect::renderVoice(int voiceIndex, AudioSampleBuffer &
 {
 	if (auto n = getActiveNetwork())
 	{
+		// The voice was refused because all voice slots are occupied, so we leave the signal dry
+		if (!n->getPolyHandler()->hasVoiceSlot(voiceIndex))
+		{
+			isTailing = false;
+			return;
+		}
+
 		float* channels[NUM_MAX_CHANNELS];
 
 		int numChannels = b.getNumChannels();
@@ -527,7 +541,7 @@ void JavascriptPolyphonicEffect::startVoice(int voiceIndex, const HiseEvent& e)
 
 void JavascriptPolyphonicEffect::reset(int voiceIndex)
 {
-	voiceData.reset(voiceIndex);
+	voiceData.reset(getActiveNetwork(), voiceIndex);
 }
 
 void JavascriptPolyphonicEffect::handleHiseEvent(const HiseEvent &m)
@@ -743,6 +757,8 @@ void JavascriptMasterEffect::renderWholeBuffer(AudioSampleBuffer &buffer)
 	}
 	else
 	{
+		ADD_AUDIO_PROFILER_SCOPE(this, DebugLogger::Location::ScriptFXRendering);
+
 		if (getActiveNetwork() != nullptr)
 		{
 			getActiveNetwork()->process(buffer, eventBuffer);
@@ -780,6 +796,8 @@ void JavascriptMasterEffect::applyEffect(AudioSampleBuffer &b, int startSample,
 {
 	ignoreUnused(startSample);
 
+	ADD_AUDIO_PROFILER_SCOPE(this, DebugLogger::Location::ScriptFXRendering);
+
 	if (getActiveNetwork() != nullptr)
 	{
 		getActiveNetwork()->process(b, eventBuffer);
@@ -1092,6 +1110,8 @@ void JavascriptTimeVariantModulator::prepareToPlay(double sampleRate, int sample
 
 void JavascriptTimeVariantModulator::calculateBlock(int startSample, int numSamples)
 {
+	ADD_AUDIO_PROFILER_SCOPE(this, DebugLogger::Location::ScriptFXRendering);
+
 	if (auto n = getActiveNetwork())
 	{
 		auto ptr = internalBuffer.getWritePointer(0, startSample);
@@ -1263,6 +1283,10 @@ void JavascriptEnvelopeModulator::prepareToPlay(double sampleRate, int samplesPe
 
 	if (auto n = getActiveNetwork())
 	{
+		if (auto synth = dynamic_cast<ModulatorSynth*>(getParentProcessor(true, false)))
+			synth->addVoiceLimitListener(this);
+
+		n->getPolyHandler()->setNumVoiceSlots(VoiceDataStack::getNumVoiceSlots(this));
 		n->prepareToPlay(getControlRate(), samplesPerBlock / HISE_EVENT_RASTER);
         n->setNumChannels(1);
 	}
@@ -1270,14 +1294,20 @@ void JavascriptEnvelopeModulator::prepareToPlay(double sampleRate, int samplesPe
 
 void JavascriptEnvelopeModulator::calculateBlock(int startSample, int numSamples)
 {
+	ADD_AUDIO_PROFILER_VOICE_SCOPE(this, DebugLogger::Location::ScriptFXRendering, polyManager.getCurrentVoice());
+
 	if (auto n = getActiveNetwork())
 	{
-		scriptnode::DspNetwork::VoiceSetter vs(*n, polyManager.getCurrentVoice());
-
 		float* ptr = internalBuffer.getWritePointer(0, startSample);
 
 		memset(ptr, 0, sizeof(float)*numSamples);
 
+		// The voice was refused because all voice slots are occupied
+		if (!n->getPolyHandler()->hasVoiceSlot(polyManager.getCurrentVoice()))
+			return;
+
+		scriptnode::DspNetwork::VoiceSetter vs(*n, polyManager.getCurrentVoice());
+
 		scriptnode::ProcessDataDyn d(&ptr, numSamples, 1);
 
 		if (auto s = SimpleReadWriteLock::ScopedTryReadLock(n->getConnectionLock()))
@@ -1303,7 +1333,9 @@ float JavascriptEnvelopeModulator::startVoice(int voiceIndex)
 
 	if (auto n = getActiveNetwork())
 	{
-		voiceData.startVoice(*n, *n->getPolyHandler(), voiceIndex, lastNoteOn);
+		// Stop the voice right away if it was refused because all voice slots are occupied
+		if (!voiceData.startVoice(*n, *n->getPolyHandler(), voiceIndex, lastNoteOn))
+			state->isPlaying = false;
 	}
 
     return 0.0f;
@@ -1323,7 +1355,7 @@ void JavascriptEnvelopeModulator::reset(int voiceIndex)
 	state->isPlaying = false;
 	state->isRingingOff = false;
 
-	voiceData.reset(voiceIndex);
+	voiceData.reset(getActiveNetwork(), voiceIndex);
 }
 
 bool JavascriptEnvelopeModulator::isPlaying(int voiceIndex) const
@@ -1542,6 +1574,7 @@ void JavascriptSynthesiser::prepareToPlay(double newSampleRate, int samplesPerBl
 		if (auto vk = ProcessorHelpers::getFirstProcessorWithType<ScriptnodeVoiceKiller>(gainChain))
 			setVoiceKillerToUse(vk);
 
+		n->getPolyHandler()->setNumVoiceSlots(VoiceDataStack::getNumVoiceSlots(this));
         n->prepareToPlay(newSampleRate, (double)samplesPerBlock);
         n->setNumChannels(getMatrix().getNumSourceChannels());
 		
@@ -1552,6 +1585,14 @@ void JavascriptSynthesiser::prepareToPlay(double newSampleRate, int samplesPerBl
 
 
 
+void JavascriptSynthesiser::setVoiceLimit(int newVoiceLimit)
+{
+	ModulatorSynth::setVoiceLimit(newVoiceLimit);
+
+	// The compact poly data containers need to be resized for the new voice limit
+	VoiceDataStack::updateNumVoiceSlots(this);
+}
+
 void JavascriptSynthesiser::restoreFromValueTree(const ValueTree &v)
 {
 	ModulatorSynth::restoreFromValueTree(v); 
@@ -1571,8 +1612,15 @@ void JavascriptSynthesiser::Voice::calculateBlock(int startSample, int numSample
 		if (isVoiceStart)
 		{
 			n->setVoiceKiller(synth->vk);
-			synth->voiceData.startVoice(*n, *n->getPolyHandler(), getVoiceIndex(), getCurrentHiseEvent());
 			isVoiceStart = false;
+
+			// All voice slots are occupied, so we refuse the voice
+			if (!synth->voiceData.startVoice(*n, *n->getPolyHandler(), getVoiceIndex(), getCurrentHiseEvent()))
+			{
+				voiceBuffer.clear();
+				resetVoice();
+				return;
+			}
 		}
 
 		float* channels[NUM_MAX_CHANNELS];
@@ -1651,6 +1699,48 @@ hise::ProcessorEditorBody * ScriptnodeVoiceKiller::createEditor(ProcessorEditor
 #endif
 }
 
+int VoiceDataStack::getNumVoiceSlots(const Processor* p)
+{
+	auto synth = dynamic_cast<const ModulatorSynth*>(p);
+
+	if (synth == nullptr)
+		synth = dynamic_cast<const ModulatorSynth*>(p->getParentProcessor(true, false));
+
+	if (synth == nullptr)
+		return p->getVoiceAmount();
+
+	// Killed voices are still fading out while the new voices start, so we need some headroom...
+	auto voiceLimit = (int)synth->getAttribute(ModulatorSynth::VoiceLimit);
+	return jlimit(1, jmin(p->getVoiceAmount(), NUM_POLYPHONIC_VOICES), 2 * voiceLimit);
+}
+
+void VoiceDataStack::updateNumVoiceSlots(Processor* p)
+{
+	auto holder = dynamic_cast<scriptnode::DspNetwork::Holder*>(p);
+
+	if (holder == nullptr || holder->getActiveNetwork() == nullptr || p->getSampleRate() <= 0.0)
+		return;
+
+	if (holder->getActiveNetwork()->getPolyHandler()->getNumVoiceSlots() == getNumVoiceSlots(p))
+		return;
+
+	auto f = [](Processor* p)
+	{
+		if (auto n = dynamic_cast<scriptnode::DspNetwork::Holder*>(p)->getActiveNetwork())
+		{
+			LockHelpers::SafeLock sl(p->getMainController(), LockHelpers::AudioLock);
+
+			// Only prepare again if the containers need to grow...
+			if (!n->getPolyHandler()->changeNumVoiceSlots(getNumVoiceSlots(p)))
+				p->prepareToPlay(p->getSampleRate(), p->getLargestBlockSize());
+		}
+
+		return SafeFunctionCall::OK;
+	};
+
+	p->getMainController()->getKillStateHandler().killVoicesAndCall(p, f, MainController::KillStateHandler::TargetThread::SampleLoadingThread);
+}
+
 void VoiceDataStack::reset(int voiceIndex)
 {
 	for (int i = 0; i < voiceNoteOns.size(); i++)
@@ -71,6 +71,9 @@ public:
 	JavascriptMidiProcessor(MainController *mc, const String &id);
 	~JavascriptMidiProcessor();;
 
+	/** The callbacks can access the engine globals and the API of other processors. */
+	bool canBeProcessedConcurrently() const override { return false; }
+
 	Path getSpecialSymbol() const override;
 
 	void suspendStateChanged(bool shouldBeSuspended) override
@@ -250,6 +253,8 @@ public:
 	JavascriptVoiceStartModulator(MainController *mc, const String &id, int voiceAmount, Modulation::Mode m);;
 	~JavascriptVoiceStartModulator();
 
+	bool canBeProcessedConcurrently() const override { return false; }
+
 	Path getSpecialSymbol() const override;
 
 	float getAttribute(int index) const override { return getControlValue(index); }
@@ -332,6 +337,8 @@ public:
 	JavascriptTimeVariantModulator(MainController *mc, const String &id, Modulation::Mode m);
 	~JavascriptTimeVariantModulator();
 
+	bool canBeProcessedConcurrently() const override { return false; }
+
 	Path getSpecialSymbol() const override;
 
 	float getAttribute(int index) const override
@@ -498,6 +505,24 @@ struct VoiceDataStack
 
 	void reset(int voiceIndex);
 
+	/** Removes the voice and releases its slot in the poly handler of the network. */
+	template <typename T> void reset(T* n, int voiceIndex)
+	{
+		reset(voiceIndex);
+
+		if (n != nullptr)
+			n->getPolyHandler()->releaseVoiceSlot(voiceIndex);
+	}
+
+	/** Returns the amount of voices that the CompactPolyData containers of a network inside the
+	    given processor need to allocate. */
+	static int getNumVoiceSlots(const Processor* p);
+
+	/** Call this when the voice limit of the parent synth has changed. It kills all voices and then
+	    changes the voice slots of the network under the audio lock. The processor is only prepared 
+		again if the containers need to allocate more slots. */
+	static void updateNumVoiceSlots(Processor* p);
+
 	bool containsVoiceIndex(int voiceIndex) const
 	{
 		for (const auto& vd : voiceNoteOns)
@@ -554,8 +579,13 @@ struct VoiceDataStack
 		}
 	}
 
-	template <typename T> void startVoice(T& n, PolyHandler& ph, int voiceIndex, const HiseEvent& e)
+	/** Starts the voice in the network. Returns false if the voice was refused because all voice slots
+	    are occupied - in this case the network must not render the voice. */
+	template <typename T> bool startVoice(T& n, PolyHandler& ph, int voiceIndex, const HiseEvent& e)
 	{
+		if (!ph.tryAcquireVoiceSlot(voiceIndex))
+			return false;
+
 		voiceNoteOns.insertWithoutSearch({ voiceIndex, e });
 		HiseEvent c(e);
 
@@ -570,6 +600,7 @@ struct VoiceDataStack
 		}
 
 		n.handleHiseEvent(copy);
+		return true;
 	}
 
 	UnorderedStack<VoiceData, NUM_POLYPHONIC_VOICES> voiceNoteOns;
@@ -579,7 +610,8 @@ struct VoiceDataStack
 class JavascriptEnvelopeModulator : public JavascriptProcessor,
 								    public ProcessorWithScriptingContent,
 									public EnvelopeModulator,
-									public snex::Types::VoiceResetter
+									public snex::Types::VoiceResetter,
+									public ModulatorSynth::VoiceLimitListener
 {
 public:
 
@@ -603,6 +635,8 @@ public:
 	JavascriptEnvelopeModulator(MainController *mc, const String &id, int numVoices, Modulation::Mode m);
 	~JavascriptEnvelopeModulator();
 
+	bool canBeProcessedConcurrently() const override { return false; }
+
 	Path getSpecialSymbol() const override;
 
 	bool isPolyphonic() const override { return true; }
@@ -680,6 +714,9 @@ public:
 
 	void handleHiseEvent(const HiseEvent &m) override;
 	void prepareToPlay(double sampleRate, int samplesPerBlock) override;
+
+	void voiceLimitChanged(int ) override { VoiceDataStack::updateNumVoiceSlots(this); }
+
 	void calculateBlock(int startSample, int numSamples) override;;
 
 	float startVoice(int voiceIndex) override;
@@ -762,6 +799,8 @@ public:
 	
 	JavascriptMasterEffect(MainController *mc, const String &id);
 	~JavascriptMasterEffect();
+
+	bool canBeProcessedConcurrently() const override { return false; }
 	
 
 	Path getSpecialSymbol() const override;
@@ -839,7 +878,8 @@ private:
 class JavascriptPolyphonicEffect : public JavascriptProcessor,
 	public ProcessorWithScriptingContent,
 	public VoiceEffectProcessor,
-    public VoiceResetter
+    public VoiceResetter,
+	public ModulatorSynth::VoiceLimitListener
 {
 public:
 
@@ -862,6 +902,8 @@ public:
 	JavascriptPolyphonicEffect(MainController *mc, const String &id, int numVoices);
 	~JavascriptPolyphonicEffect();
 
+	bool canBeProcessedConcurrently() const override { return false; }
+
 	bool isPolyphonic() const override { return true; }
 
 	Path getSpecialSymbol() const override;
@@ -892,6 +934,8 @@ public:
 
 	void prepareToPlay(double sampleRate, int samplesPerBlock) override;
 
+	void voiceLimitChanged(int ) override { VoiceDataStack::updateNumVoiceSlots(this); }
+
 	ValueTree exportAsValueTree() const override { ValueTree v = VoiceEffectProcessor::exportAsValueTree(); saveContent(v); saveScript(v); return v; }
 	void restoreFromValueTree(const ValueTree &v) override { VoiceEffectProcessor::restoreFromValueTree(v); restoreScript(v); restoreContent(v); }
 
@@ -940,9 +984,14 @@ public:
     void onVoiceReset(bool allVoices, int voiceIndex) override
     {
         if (allVoices)
+        {
             voiceData.voiceNoteOns.clear();
+
+            if (auto n = getActiveNetwork())
+                n->getPolyHandler()->releaseAllVoiceSlots();
+        }
         else
-            voiceData.reset(voiceIndex);
+            voiceData.reset(getActiveNetwork(), voiceIndex);
     }
     
 private:
@@ -992,7 +1041,7 @@ public:
 		virtual void resetVoice() override
 		{
 			ModulatorSynthVoice::resetVoice();
-			synth->voiceData.reset(getVoiceIndex());
+			synth->voiceData.reset(synth->getActiveNetwork(), getVoiceIndex());
 		}
 
 		JavascriptSynthesiser* synth;
@@ -1020,6 +1069,8 @@ public:
 		
 	~JavascriptSynthesiser();
 
+	bool canBeProcessedConcurrently() const override { return false; }
+
 	Path getSpecialSymbol() const override;
 
 	ProcessorEditorBody *createEditor(ProcessorEditor *parentEditor)  override;
@@ -1036,6 +1087,8 @@ public:
 
 	void prepareToPlay(double sampleRate, int samplesPerBlock) override;
 
+	void setVoiceLimit(int newVoiceLimit) override;
+
 	bool isPolyphonic() const override { return true; }
 
 	float getModValueForNode(int modIndex, int startSample) const
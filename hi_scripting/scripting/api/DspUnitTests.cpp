@@ -36,6 +36,8 @@
 
 #include  "JuceHeader.h"
 
+#include "../scriptnode/nodes/NodeContainer.h"
+
 using namespace hise;
 
 
@@ -1941,6 +1943,962 @@ private:
 
 static CustomContainerTest unorderedStackTest;
 
+class ScriptBytecodeTests : public UnitTest
+{
+public:
+
+	ScriptBytecodeTests() :
+		UnitTest("Script bytecode tests")
+	{}
+
+	void runTest() override
+	{
+		ScopedValueSetter<bool> s(MainController::unitTestMode, true);
+
+		ScopedPointer<BackendProcessor> bp = new BackendProcessor(nullptr, nullptr);
+
+		auto jp = new JavascriptMidiProcessor(bp, "scripter");
+		auto mpc = dynamic_cast<MidiProcessorChain*>(bp->getMainSynthChain()->getChildProcessor(ModulatorSynth::MidiProcessor));
+		jp->setOwnerSynth(bp->getMainSynthChain());
+		mpc->getHandler()->add(jp, nullptr);
+
+		auto engine = jp->getScriptEngine();
+
+		beginTest("Compiling the test callbacks");
+
+		expectResult(engine->execute(getInitCode(), true, "onInit"), "onInit");
+		expectResult(engine->execute(getNoteOnCode(), false, "onNoteOn"), "onNoteOn");
+		expectResult(engine->execute(getNoteOffCode(), false, "onNoteOff"), "onNoteOff");
+		expectResult(engine->execute(getControllerCode(), false, "onController"), "onController");
+		expectResult(engine->execute(getTimerCode(), false, "onTimer"), "onTimer");
+
+		beginTest("Comparing the tree interpreter with the bytecode VM");
+
+		compareCallback(engine, JavascriptMidiProcessor::onNoteOn, "onNoteOn");
+		compareCallback(engine, JavascriptMidiProcessor::onController, "onController");
+		compareCallback(engine, JavascriptMidiProcessor::onTimer, "onTimer");
+
+		testRecompilationInCallback(engine);
+
+		bp = nullptr;
+	}
+
+private:
+
+	static constexpr int NumIterations = 2000;
+
+	void expectResult(Result r, String errorMessage)
+	{
+		expect(r.wasOk(), errorMessage + " - " + r.getErrorMessage());
+	}
+
+	void compareCallback(HiseJavascriptEngine* engine, int callbackIndex, const String& name)
+	{
+		double treeMs, bytecodeMs;
+
+		auto treeResult = runCallback(engine, callbackIndex, false, treeMs);
+		auto bytecodeResult = runCallback(engine, callbackIndex, true, bytecodeMs);
+
+		expectEquals(bytecodeResult, treeResult, name + " result");
+
+		String m;
+		m << name << ": tree " << String(treeMs, 2) << "ms, bytecode " << String(bytecodeMs, 2) << "ms";
+		m << " (" << String(treeMs / jmax(0.001, bytecodeMs), 2) << "x)";
+		logMessage(m);
+	}
+
+	void testRecompilationInCallback(HiseJavascriptEngine* engine)
+	{
+		beginTest("Calling exec() and eval() from a lowered callback");
+
+		engine->setUseBytecodeForCallbacks(true);
+
+		// exec() recompiles the bytecode of all callbacks while the VM is running the old program
+		expectResult(engine->execute(getRecompilingNoteOnCode(), false, "onNoteOn"), "onNoteOn with exec()");
+
+		Result r = Result::ok();
+		engine->executeCallback(JavascriptMidiProcessor::onNoteOff, &r);
+		expectResult(r, "reset");
+
+		const int numCalls = 32;
+
+		for (int i = 0; i < numCalls; i++)
+		{
+			engine->executeCallback(JavascriptMidiProcessor::onNoteOn, &r);
+
+			if (!r.wasOk())
+			{
+				expectResult(r, "callback execution");
+				break;
+			}
+		}
+
+		expect(engine->isUsingBytecodeForCallbacks(), "bytecode mode");
+		expectEquals((int)engine->evaluate("counter"), numCalls * 32, "counter");
+		expectEquals((int)engine->evaluate("checksum"), numCalls * 2, "checksum");
+	}
+
+	String runCallback(HiseJavascriptEngine* engine, int callbackIndex, bool useBytecode, double& milliSeconds)
+	{
+		engine->setUseBytecodeForCallbacks(useBytecode);
+		expect(engine->isUsingBytecodeForCallbacks() == useBytecode, "bytecode mode");
+
+		// onNoteOff resets the registers
+		Result r = Result::ok();
+		engine->executeCallback(JavascriptMidiProcessor::onNoteOff, &r);
+		expectResult(r, "reset");
+
+		auto before = Time::getMillisecondCounterHiRes();
+
+		for (int i = 0; i < NumIterations; i++)
+		{
+			engine->executeCallback(callbackIndex, &r);
+
+			if (!r.wasOk())
+			{
+				expectResult(r, "callback execution");
+				break;
+			}
+		}
+
+		milliSeconds = Time::getMillisecondCounterHiRes() - before;
+
+		return engine->evaluate("checksum").toString() + " " + engine->evaluate("counter").toString();
+	}
+
+	static String getInitCode()
+	{
+		return R"(reg counter = 0;
+reg checksum = 0.0;
+reg i = 0;
+reg table = [1, 2, 3, 4];)";
+	}
+
+	static String getNoteOnCode()
+	{
+		return R"(function onNoteOn()
+{
+	local sum = 0.0;
+
+	for(i = 0; i < 128; i++)
+	{
+		sum += Math.sin(i * 0.1) * 0.5;
+
+		if(i % 3 == 0)
+			counter++;
+		else
+			counter += 2;
+	}
+
+	checksum += sum;
+})";
+	}
+
+	static String getRecompilingNoteOnCode()
+	{
+		return R"(function onNoteOn()
+{
+	for(i = 0; i < 16; i++)
+		counter++;
+
+	exec("checksum += 1;");
+	checksum += eval("counter % 2 == 0 ? 1 : 0");
+
+	for(i = 0; i < 16; i++)
+		counter++;
+})";
+	}
+
+	static String getNoteOffCode()
+	{
+		return R"(function onNoteOff()
+{
+	checksum = 0.0;
+	counter = 0;
+})";
+	}
+
+	static String getControllerCode()
+	{
+		return R"(function onController()
+{
+	local v = 0;
+
+	for(i = 0; i < 64; i++)
+	{
+		if(i == 48)
+			break;
+
+		if(i % 2)
+			continue;
+
+		v += table[i % 4] * 2;
+	}
+
+	checksum += v > 100 ? v : -v;
+	counter = counter + 1;
+})";
+	}
+
+	static String getTimerCode()
+	{
+		return R"(function onTimer()
+{
+	checksum = Math.max(Math.min(checksum + 0.5, 1000000.0), -1000000.0);
+	counter = (counter && i) ? counter + 1 : counter - 1;
+})";
+	}
+};
+
+static ScriptBytecodeTests scriptBytecodeTests;
+
+class ScriptPropertyCacheTests : public UnitTest
+{
+public:
+
+	ScriptPropertyCacheTests() :
+		UnitTest("Script property cache tests")
+	{}
+
+	void runTest() override
+	{
+		ScopedValueSetter<bool> s(MainController::unitTestMode, true);
+
+		ScopedPointer<BackendProcessor> bp = new BackendProcessor(nullptr, nullptr);
+
+		auto jp = new JavascriptMidiProcessor(bp, "scripter");
+		auto mpc = dynamic_cast<MidiProcessorChain*>(bp->getMainSynthChain()->getChildProcessor(ModulatorSynth::MidiProcessor));
+		jp->setOwnerSynth(bp->getMainSynthChain());
+		mpc->getHandler()->add(jp, nullptr);
+
+		auto engine = jp->getScriptEngine();
+
+		expectResult(engine->execute(getInitCode(), true, "onInit"), "onInit");
+		expectResult(engine->execute(getNoteOnCode(), false, "onNoteOn"), "onNoteOn");
+
+		beginTest("Monomorphic lookups");
+
+		auto before = getStatistics(engine);
+		expectEquals(runNoteOn(engine), String(NumIterations * (1 + 2 + 2)), "result");
+		auto after = getStatistics(engine);
+
+		// Every site misses once for the first object and hits for the rest
+		expect(after.first - before.first > NumIterations, "hits");
+		expect(after.second - before.second <= 8, "misses");
+
+		beginTest("Invalidation after the layout changed");
+
+		// Same properties, different order: the cached slots are stale
+		engine->evaluate("obj = {y: 20, x: 10}");
+		expectEquals(runNoteOn(engine), String(NumIterations * (10 + 20 + 20)), "result after layout change");
+
+		// The new property shifts the slots of the existing properties
+		engine->evaluate("obj = {z: 0, y: 3, x: 7}");
+		expectEquals(runNoteOn(engine), String(NumIterations * (7 + 3 + 3)), "result after adding a property");
+
+		beginTest("Polymorphic lookups with more layouts than cache entries");
+
+		const auto numLayouts = 5;
+		auto expected = 0;
+
+		for (int i = 0; i < numLayouts; i++)
+			expected += i + 1;
+
+		engine->evaluate("sumX()");
+		expectEquals((int)engine->evaluate("sumX()"), expected, "polymorphic result");
+
+		beginTest("Statistics");
+
+		auto stats = getStatistics(engine);
+		auto obj = engine->getPropertyCacheStatistics();
+
+		expect(stats.first > 0 && stats.second > 0, "counters");
+		expectEquals((double)obj["HitRate"], (double)stats.first / (double)(stats.first + stats.second), "hit rate");
+
+		bp = nullptr;
+	}
+
+private:
+
+	static constexpr int NumIterations = 100;
+
+	void expectResult(Result r, String errorMessage)
+	{
+		expect(r.wasOk(), errorMessage + " - " + r.getErrorMessage());
+	}
+
+	String runNoteOn(HiseJavascriptEngine* engine)
+	{
+		Result r = Result::ok();
+		engine->executeCallback(JavascriptMidiProcessor::onNoteOn, &r);
+		expectResult(r, "onNoteOn");
+		return engine->evaluate("result").toString();
+	}
+
+	static std::pair<int64, int64> getStatistics(HiseJavascriptEngine* engine)
+	{
+		auto obj = engine->getPropertyCacheStatistics();
+		return { (int64)obj["Hits"], (int64)obj["Misses"] };
+	}
+
+	static String getInitCode()
+	{
+		return R"(reg obj = {x: 1, y: 2};
+reg result = 0;
+reg i = 0;
+const var layouts = [{x: 1}, {a: 0, x: 2}, {a: 0, b: 0, x: 3}, {a: 0, b: 0, c: 0, x: 4}, {a: 0, b: 0, c: 0, d: 0, x: 5}];
+
+inline function sumX()
+{
+	local sum = 0;
+
+	for(o in layouts)
+		sum += o.x;
+
+	return sum;
+})";
+	}
+
+	static String getNoteOnCode()
+	{
+		return R"(function onNoteOn()
+{
+	result = 0;
+
+	for(i = 0; i < 100; i++)
+		result += obj.x + obj.y + obj["y"];
+})";
+	}
+};
+
+static ScriptPropertyCacheTests scriptPropertyCacheTests;
+
+/** Helper functions for the tests that build and render a scriptnode network. */
+struct NetworkTestHelpers
+{
+	static void addOpNode(scriptnode::DspNetwork* network, var parent, const String& path, double value)
+	{
+		auto node = dynamic_cast<scriptnode::NodeBase*>(network->createAndAdd(path, "", parent).getObject());
+
+		if (auto p = node->getParameterFromName("Value"))
+			p->data.setProperty(scriptnode::PropertyIds::Value, value, nullptr);
+	}
+
+	/** Resets the network and renders a noise signal through it (using the active freeze mode). */
+	static AudioSampleBuffer render(scriptnode::DspNetwork* network, int numChannels, int blockSize, int numBlocks)
+	{
+		AudioSampleBuffer buffer(numChannels, blockSize * numBlocks);
+		Random r(0x1234);
+
+		for (int c = 0; c < numChannels; c++)
+		{
+			for (int i = 0; i < buffer.getNumSamples(); i++)
+				buffer.setSample(c, i, r.nextFloat() * 2.0f - 1.0f);
+		}
+
+		HiseEventBuffer events;
+		network->reset();
+
+		for (int b = 0; b < numBlocks; b++)
+		{
+			float* ptrs[NUM_MAX_CHANNELS];
+
+			for (int c = 0; c < numChannels; c++)
+				ptrs[c] = buffer.getWritePointer(c, b * blockSize);
+
+			scriptnode::ProcessDataDyn d(ptrs, blockSize, numChannels);
+			d.setEventBuffer(events);
+			network->process(d);
+		}
+
+		return buffer;
+	}
+
+	static float getMaxDelta(const AudioSampleBuffer& a, const AudioSampleBuffer& b, int channel)
+	{
+		auto maxDelta = 0.0f;
+
+		for (int i = 0; i < a.getNumSamples(); i++)
+			maxDelta = jmax(maxDelta, std::abs(a.getSample(channel, i) - b.getSample(channel, i)));
+
+		return maxDelta;
+	}
+};
+
+class ParallelContainerTests : public UnitTest
+{
+public:
+
+	ParallelContainerTests() :
+		UnitTest("Testing parallel scriptnode containers")
+	{}
+
+	void runTest() override
+	{
+		ScopedValueSetter<bool> s(MainController::unitTestMode, true);
+
+		ScopedPointer<BackendProcessor> bp = new BackendProcessor(nullptr, nullptr);
+
+		{
+			ScopedPointer<JavascriptMasterEffect> fx = new JavascriptMasterEffect(bp, "fx");
+
+			auto network = fx->getOrCreate("parallel_test");
+			network->setNumChannels(NumChannels);
+
+			testContainer(network, "container.split");
+			testContainer(network, "container.multi");
+		}
+
+		bp = nullptr;
+	}
+
+private:
+
+	static constexpr int NumChannels = 4;
+	static constexpr int BlockSize = 512;
+	static constexpr int NumBlocks = 16;
+
+	void testContainer(scriptnode::DspNetwork* network, const String& path)
+	{
+		using namespace scriptnode;
+
+		beginTest("Comparing serial and parallel processing of " + path);
+
+		network->clear(true, true);
+
+		auto container = dynamic_cast<ParallelNode*>(network->createAndAdd(path, "", var(network)).getObject());
+
+		expect(container != nullptr, "create " + path);
+
+		if (container == nullptr)
+			return;
+
+		// One branch per channel so that the multi container has something to distribute
+		for (int i = 0; i < NumChannels; i++)
+		{
+			auto branch = network->createAndAdd("container.chain", "", var(container));
+
+			NetworkTestHelpers::addOpNode(network, branch, "math.mul", 0.5 + (double)i);
+			NetworkTestHelpers::addOpNode(network, branch, "math.tanh", 1.0 + (double)i);
+			NetworkTestHelpers::addOpNode(network, branch, "math.add", 0.1 * (double)i);
+		}
+
+		// Prepare before enabling the property so that the branch buffers must be allocated by the property callback
+		network->prepareToPlay(44100.0, (double)BlockSize);
+
+		auto serialOutput = NetworkTestHelpers::render(network, NumChannels, BlockSize, NumBlocks);
+		expect(!container->isParallelProcessingActive(), "serial processing");
+
+		container->setNodeProperty(PropertyIds::Parallel, true);
+		expect(container->isParallelProcessingActive(), "parallel processing after enabling the property");
+
+		auto parallelOutput = NetworkTestHelpers::render(network, NumChannels, BlockSize, NumBlocks);
+
+		for (int c = 0; c < NumChannels; c++)
+			expectEquals(NetworkTestHelpers::getMaxDelta(serialOutput, parallelOutput, c), 0.0f, path + ": channel " + String(c));
+
+		container->setNodeProperty(PropertyIds::Parallel, false);
+		expect(!container->isParallelProcessingActive(), "serial processing after disabling the property");
+	}
+};
+
+static ParallelContainerTests parallelContainerTests;
+
+class FreezeModeTests : public UnitTest
+{
+public:
+
+	FreezeModeTests() :
+		UnitTest("Testing frozen scriptnode networks")
+	{}
+
+	void runTest() override
+	{
+		ScopedValueSetter<bool> s(MainController::unitTestMode, true);
+
+		ScopedPointer<BackendProcessor> bp = new BackendProcessor(nullptr, nullptr);
+
+		{
+			ScopedPointer<JavascriptMasterEffect> fx = new JavascriptMasterEffect(bp, "fx");
+
+			auto network = fx->getOrCreate("freeze_test");
+			network->setNumChannels(NumChannels);
+
+			createNetwork(network);
+
+			testOutputFormats(network);
+			testFreezeModes(network);
+		}
+
+		bp = nullptr;
+	}
+
+private:
+
+	static constexpr int NumChannels = 2;
+	static constexpr int BlockSize = 512;
+	static constexpr int NumBlocks = 16;
+
+	/** Creates a chain with a parallel split so that the JIT compiled instance needs the serial fallback. */
+	void createNetwork(scriptnode::DspNetwork* network)
+	{
+		using namespace scriptnode;
+
+		auto root = var(network->getRootNode());
+
+		NetworkTestHelpers::addOpNode(network, root, "math.mul", 0.8);
+
+		auto split = dynamic_cast<NodeBase*>(network->createAndAdd("container.split", "", root).getObject());
+
+		for (int i = 0; i < 2; i++)
+		{
+			auto branch = network->createAndAdd("container.chain", "", var(split));
+			NetworkTestHelpers::addOpNode(network, branch, "math.mul", 0.25 + 0.5 * (double)i);
+			NetworkTestHelpers::addOpNode(network, branch, "math.add", 0.1 * (double)i);
+		}
+
+		split->setNodeProperty(PropertyIds::Parallel, true);
+
+		NetworkTestHelpers::addOpNode(network, root, "math.clip", 0.7);
+	}
+
+	/** The ValueTreeBuilder used to ignore the format and always created the DLL code. */
+	void testOutputFormats(scriptnode::DspNetwork* network)
+	{
+		using Format = snex::cppgen::ValueTreeBuilder::Format;
+
+		beginTest("Testing the ValueTreeBuilder output formats");
+
+		auto rootTree = network->getValueTree().getChild(0);
+
+		auto createCode = [&](Format f)
+		{
+			snex::cppgen::ValueTreeBuilder vb(rootTree, f);
+			auto br = vb.createCppCode();
+			expect(br.r.wasOk(), br.r.getErrorMessage());
+			return br.code;
+		};
+
+		auto jitCode = createCode(Format::JitCompiledInstance);
+
+		expect(jitCode.contains("/* Autogenerated code */"), "JIT: header");
+		expect(jitCode.contains("namespace impl"), "JIT: namespace");
+		expect(!jitCode.contains("#pragma once"), "JIT: no DLL glue code");
+		expect(!jitCode.contains("JuceHeader.h"), "JIT: no include");
+		expect(jitCode.contains("container::split"), "JIT: serial split");
+		expect(!jitCode.contains("parallel_split"), "JIT: no parallel split");
+
+		auto dllCode = createCode(Format::CppDynamicLibrary);
+
+		expect(dllCode.contains("#pragma once"), "DLL: glue code");
+		expect(dllCode.contains("namespace project"), "DLL: public definition");
+		expect(dllCode.contains("container::parallel_split"), "DLL: parallel split");
+
+		auto testCode = createCode(Format::TestCaseFile);
+
+		expect(testCode.contains("BEGIN_TEST_DATA"), "Test case: header");
+		expect(testCode.contains("processor") && testCode.contains("wrap::node"), "Test case: public definition");
+		expect(!testCode.contains("#pragma once"), "Test case: no DLL glue code");
+	}
+
+	void testFreezeModes(scriptnode::DspNetwork* network)
+	{
+		beginTest("Comparing the interpreted and frozen network output");
+
+		network->prepareToPlay(44100.0, (double)BlockSize);
+
+		auto interpreted = NetworkTestHelpers::render(network, NumChannels, BlockSize, NumBlocks);
+
+		auto r = network->setUseJitFrozenNode(true);
+		expect(r.wasOk(), r.getErrorMessage());
+		expect(network->isJitFrozen(), "JIT frozen");
+
+		if (r.wasOk())
+		{
+			auto jitFrozen = NetworkTestHelpers::render(network, NumChannels, BlockSize, NumBlocks);
+
+			for (int c = 0; c < NumChannels; c++)
+				expectEquals(NetworkTestHelpers::getMaxDelta(interpreted, jitFrozen, c), 0.0f, "JIT: channel " + String(c));
+
+			network->setUseJitFrozenNode(false);
+		}
+
+		expect(!network->isJitFrozen(), "JIT frozen node removed");
+
+		if (network->canBeFrozen())
+		{
+			network->setUseFrozenNode(true);
+
+			auto dllFrozen = NetworkTestHelpers::render(network, NumChannels, BlockSize, NumBlocks);
+
+			for (int c = 0; c < NumChannels; c++)
+				expectEquals(NetworkTestHelpers::getMaxDelta(interpreted, dllFrozen, c), 0.0f, "DLL: channel " + String(c));
+
+			network->setUseFrozenNode(false);
+		}
+		else
+		{
+			logMessage("Skipping the DLL comparison because no project DLL is loaded");
+		}
+
+		auto interpretedAgain = NetworkTestHelpers::render(network, NumChannels, BlockSize, NumBlocks);
+
+		for (int c = 0; c < NumChannels; c++)
+			expectEquals(NetworkTestHelpers::getMaxDelta(interpreted, interpretedAgain, c), 0.0f, "Interpreted after unfreezing: channel " + String(c));
+	}
+};
+
+static FreezeModeTests freezeModeTests;
+
+class AudioThreadProfilerTests : public UnitTest
+{
+public:
+
+	AudioThreadProfilerTests() :
+		UnitTest("Testing the audio thread profiler")
+	{}
+
+	void runTest() override
+	{
+		ScopedValueSetter<bool> s(MainController::unitTestMode, true);
+
+		AudioThreadProfiler::setEnabled(true);
+
+		testNestedScopes();
+		testRingBufferOverflow();
+		testThreadSlots();
+		testWriters();
+
+		AudioThreadProfiler::setEnabled(false);
+		AudioThreadProfiler::clear();
+	}
+
+private:
+
+	using Location = DebugLogger::Location;
+	using ScopedEvent = AudioThreadProfiler::ScopedEvent;
+
+	static Array<AudioThreadProfiler::Event> getEventsWithLocation(Location l)
+	{
+		Array<AudioThreadProfiler::Event> list;
+
+		for (const auto& e : AudioThreadProfiler::getEvents())
+		{
+			if (e.location == (int16)l)
+				list.add(e);
+		}
+
+		return list;
+	}
+
+	void testNestedScopes()
+	{
+		beginTest("Testing nested scopes");
+
+		AudioThreadProfiler::clear();
+
+		{
+			ScopedEvent outer(nullptr, (int)Location::MainRenderCallback);
+
+			{
+				ScopedEvent inner(nullptr, (int)Location::SynthVoiceRendering, 3);
+				Thread::sleep(1);
+			}
+		}
+
+		auto outer = getEventsWithLocation(Location::MainRenderCallback);
+		auto inner = getEventsWithLocation(Location::SynthVoiceRendering);
+
+		expectEquals(outer.size(), 1, "outer event");
+		expectEquals(inner.size(), 1, "inner event");
+
+		if (outer.size() != 1 || inner.size() != 1)
+			return;
+
+		auto o = outer.getFirst();
+		auto i = inner.getFirst();
+
+		expectEquals((int)o.depth, 0, "outer depth");
+		expectEquals((int)i.depth, 1, "inner depth");
+		expectEquals((int)o.voiceIndex, -1, "outer voice index");
+		expectEquals((int)i.voiceIndex, 3, "inner voice index");
+		expectEquals((int)o.threadIndex, (int)i.threadIndex, "thread index");
+		expect(i.startTicks >= o.startTicks, "inner starts after outer");
+		expect(i.startTicks + i.durationTicks <= o.startTicks + o.durationTicks, "inner ends before outer");
+		expect(i.durationTicks > 0, "duration");
+
+		AudioThreadProfiler::clear();
+
+		expect(AudioThreadProfiler::getEvents().isEmpty(), "clear() removes all events");
+	}
+
+	void testRingBufferOverflow()
+	{
+		beginTest("Testing ring buffer overflow");
+
+		AudioThreadProfiler::clear();
+
+		constexpr int NumToWrite = AudioThreadProfiler::NumEventsPerThread + 100;
+
+		for (int i = 0; i < NumToWrite; i++)
+			ScopedEvent e(nullptr, (int)Location::SampleRendering, i & 0x7FFF);
+
+		auto events = getEventsWithLocation(Location::SampleRendering);
+
+		// The slot of the next event is not valid, so one event less than the buffer size is returned
+		expectEquals(events.size(), AudioThreadProfiler::NumEventsPerThread - 1, "number of events");
+
+		if (events.isEmpty())
+			return;
+
+		expectEquals((int)events.getLast().voiceIndex, (NumToWrite - 1) & 0x7FFF, "last event");
+		expectEquals((int)events.getFirst().voiceIndex, (NumToWrite - events.size()) & 0x7FFF, "first event");
+
+		AudioThreadProfiler::clear();
+	}
+
+	void testThreadSlots()
+	{
+		beginTest("Testing that exited threads release their slot");
+
+		AudioThreadProfiler::clear();
+
+		constexpr int NumThreads = AudioThreadProfiler::MaxNumThreads + 4;
+
+		for (int i = 0; i < NumThreads; i++)
+		{
+			// std::thread::join() waits until the thread_local objects are destroyed
+			std::thread t([i]()
+			{
+				ScopedEvent e(nullptr, (int)Location::SampleLoaderReadOperation, i);
+			});
+
+			t.join();
+		}
+
+		expectEquals(getEventsWithLocation(Location::SampleLoaderReadOperation).size(), NumThreads, "every thread got a slot");
+
+		AudioThreadProfiler::clear();
+	}
+
+	/** Records events for the processors of two instances and checks that each dump only contains its own. */
+	void testWriters()
+	{
+		beginTest("Testing the Chrome trace and binary writers");
+
+		ScopedPointer<BackendProcessor> bp = new BackendProcessor(nullptr, nullptr);
+		ScopedPointer<BackendProcessor> other = new BackendProcessor(nullptr, nullptr);
+
+		auto chain = bp->getMainSynthChain();
+		auto otherChain = other->getMainSynthChain();
+
+		chain->setId("ProfiledChain");
+		otherChain->setId("OtherChain");
+
+		AudioThreadProfiler::clear();
+
+		{
+			ScopedEvent e1(chain, (int)Location::MainRenderCallback);
+			ScopedEvent e2(chain, (int)Location::SynthVoiceRendering, 7);
+			ScopedEvent e3(otherChain, (int)Location::MainRenderCallback);
+		}
+
+		MemoryOutputStream json;
+		expect(AudioThreadProfiler::writeChromeTrace(json, bp), "Chrome trace written");
+
+		auto obj = JSON::parse(json.toString());
+		expect(obj.isObject(), "valid JSON");
+
+		int numJsonEvents = 0;
+
+		if (auto traceEvents = obj["traceEvents"].getArray())
+		{
+			for (const auto& e : *traceEvents)
+			{
+				if (e["ph"].toString() != "X")
+					continue;
+
+				numJsonEvents++;
+
+				expect(e["name"].toString().startsWith("ProfiledChain"), "only events of this instance: " + e["name"].toString());
+				expect((double)e["dur"] >= 0.0, "duration");
+				expect((int)e["tid"] >= 0 && (int)e["tid"] < AudioThreadProfiler::MaxNumThreads, "thread index");
+			}
+		}
+
+		expectEquals(numJsonEvents, 2, "number of JSON events");
+
+		MemoryOutputStream binary;
+		expect(AudioThreadProfiler::writeBinary(binary, bp), "binary written");
+
+		MemoryInputStream mis(binary.getData(), binary.getDataSize(), false);
+
+		char magic[4];
+		mis.read(magic, 4);
+
+		expect(String(magic, 4) == "HPRF", "magic number");
+		expectEquals(mis.readInt(), 1, "version");
+
+		StringArray ids;
+		auto numIds = mis.readInt();
+
+		for (int i = 0; i < numIds; i++)
+			ids.add(mis.readString());
+
+		expect(ids.contains("ProfiledChain") && !ids.contains("OtherChain"), "processor IDs");
+
+		auto numEvents = mis.readInt();
+		expectEquals(numEvents, 2, "number of binary events");
+
+		for (int i = 0; i < numEvents; i++)
+		{
+			auto start = mis.readInt64();
+			auto duration = mis.readInt64();
+			auto processorIndex = mis.readInt();
+			auto location = mis.readShort();
+			auto voiceIndex = mis.readShort();
+			auto depth = mis.readShort();
+			auto threadIndex = mis.readShort();
+
+			expect(start >= 0 && duration >= 0, "time values");
+			expectEquals(ids[processorIndex], String("ProfiledChain"), "processor");
+
+			// The events are sorted by start time, then by depth
+			expectEquals((int)depth, i, "depth");
+			expectEquals((int)location, (int)(i == 0 ? Location::MainRenderCallback : Location::SynthVoiceRendering), "location");
+			expectEquals((int)voiceIndex, i == 0 ? -1 : 7, "voice index");
+			expect(isPositiveAndBelow((int)threadIndex, AudioThreadProfiler::MaxNumThreads), "thread index");
+		}
+
+		expect(mis.isExhausted(), "no trailing data");
+
+		AudioThreadProfiler::clear();
+
+		MemoryOutputStream empty;
+		expect(!AudioThreadProfiler::writeBinary(empty, other), "nothing to write after clear()");
+
+		other = nullptr;
+		bp = nullptr;
+	}
+};
+
+static AudioThreadProfilerTests audioThreadProfilerTests;
+
+class ParallelPreloadTests : public UnitTest
+{
+public:
+
+	ParallelPreloadTests() :
+		UnitTest("Testing the parallel sample preloading")
+	{}
+
+	void runTest() override
+	{
+		ScopedValueSetter<bool> s(MainController::unitTestMode, true);
+
+		auto sampleFile = File::createTempFile(".wav");
+		writeSampleFile(sampleFile);
+
+		ScopedPointer<BackendProcessor> bp = new BackendProcessor(nullptr, nullptr);
+
+		{
+			ScopedPointer<ModulatorSampler> sampler = new ModulatorSampler(bp, "sampler", 8);
+
+			testSharedSounds(bp, sampler, sampleFile);
+		}
+
+		bp = nullptr;
+
+		sampleFile.deleteFile();
+	}
+
+private:
+
+	static void writeSampleFile(const File& f)
+	{
+		AudioSampleBuffer b(2, 44100);
+
+		for (int i = 0; i < b.getNumSamples(); i++)
+		{
+			auto v = 0.5f * std::sin((float)i * 0.05f);
+			b.setSample(0, i, v);
+			b.setSample(1, i, -v);
+		}
+
+		WavAudioFormat wav;
+		ScopedPointer<AudioFormatWriter> writer = wav.createWriterFor(new FileOutputStream(f), 44100.0, 2, 24, {}, 0);
+
+		if (writer != nullptr)
+			writer->writeFromAudioSampleBuffer(b, 0, b.getNumSamples());
+	}
+
+	static ValueTree createSample(const File& f, int loKey, int hiKey)
+	{
+		ValueTree s("sample");
+		s.setProperty(SampleIds::FileName, f.getFullPathName(), nullptr);
+		s.setProperty(SampleIds::Root, loKey, nullptr);
+		s.setProperty(SampleIds::LoKey, loKey, nullptr);
+		s.setProperty(SampleIds::HiKey, hiKey, nullptr);
+		s.setProperty(SampleIds::LoVel, 0, nullptr);
+		s.setProperty(SampleIds::HiVel, 127, nullptr);
+		s.setProperty(SampleIds::RRGroup, 1, nullptr);
+		return s;
+	}
+
+	void testSharedSounds(BackendProcessor* bp, ModulatorSampler* sampler, const File& sampleFile)
+	{
+		beginTest("Preloading two samples that share one sound");
+
+		ValueTree map("samplemap");
+		map.setProperty("ID", "preload_test", nullptr);
+		map.setProperty("SaveMode", 0, nullptr);
+		map.setProperty("RRGroupAmount", 1, nullptr);
+		map.addChild(createSample(sampleFile, 0, 63), -1, nullptr);
+		map.addChild(createSample(sampleFile, 64, 127), -1, nullptr);
+
+		sampler->getSampleMap()->loadUnsavedValueTree(map);
+
+		Array<StreamingSamplerSound*> streamingSounds;
+
+		{
+			ModulatorSampler::SoundIterator iter(sampler);
+
+			while (auto sound = iter.getNextSound())
+				streamingSounds.add(sound->getReferenceToSound().get());
+		}
+
+		expectEquals(streamingSounds.size(), 2, "two samples");
+
+		if (streamingSounds.size() != 2)
+			return;
+
+		expect(streamingSounds[0] != nullptr && streamingSounds[0] == streamingSounds[1], "both samples share one sound");
+
+		ModulatorSampler::PreloadList soundsToPreload;
+		int numAlreadyProcessed = 0;
+
+		for (auto ss : streamingSounds)
+			ModulatorSampler::addSoundToPreload(soundsToPreload, ss, numAlreadyProcessed);
+
+		expectEquals(soundsToPreload.sounds.size(), 1, "the shared sound is only preloaded once");
+		expectEquals(numAlreadyProcessed, 1, "the duplicate is counted as processed");
+
+		expect(bp->getSampleManager().getPreloadThreadPool() != nullptr, "parallel preloading is available");
+		expect(sampler->preloadAllSamples(), "preloading succeeds");
+		expectEquals(bp->getSampleManager().getPreloadProgress(), 1.0, "progress reaches the end");
+		expect(streamingSounds[0]->getActualPreloadSize() > 0, "the shared sound is preloaded");
+		expect(!streamingSounds[0]->isOpened(), "the file handle is closed again");
+
+		auto stats = sampler->getLastPreloadStatistics();
+
+		expectEquals(stats.numSounds, 2, "statistics: sounds");
+		expectEquals(stats.numBytes, (int64)streamingSounds[0]->getActualPreloadSize() * 2, "statistics: bytes");
+		expectEquals(stats.numThreads, bp->getSampleManager().getPreloadThreadPool()->getNumThreads(), "statistics: threads");
+	}
+};
+
+static ParallelPreloadTests parallelPreloadTests;
+
 
 
 #endif
@@ -218,24 +218,17 @@ struct ScriptedPostDrawActions
 
 namespace ScriptedDrawActions
 {
-	struct fillAll : public DrawActions::ActionBase
-	{
-		fillAll(Colour c_) : c(c_) {};
-		void perform(Graphics& g) { g.fillAll(c); };
-		Colour c;
-	};
-
-	struct setColour : public DrawActions::ActionBase
-	{
-		setColour(Colour c_) : c(c_) {};
-		void perform(Graphics& g) { g.setColour(c); };
-		Colour c;
-	};
+	// The simple draw operations are stored as DrawActions::Command records in a command buffer.
 
 	struct addTransform : public DrawActions::ActionBase
 	{
 		addTransform(AffineTransform a_) : a(a_) {};
 		void perform(Graphics& g) override { g.addTransform(a); };
+		bool isEqualTo(const ActionBase& other) const override
+		{
+			auto o = dynamic_cast<const addTransform*>(&other);
+			return o != nullptr && o->a == a;
+		}
 		AffineTransform a;
 	};
 
@@ -243,6 +236,11 @@ namespace ScriptedDrawActions
 	{
 		fillPath(const Path& p_) : p(p_) {};
 		void perform(Graphics& g) override { g.fillPath(p); };
+		bool isEqualTo(const ActionBase& other) const override
+		{
+			auto o = dynamic_cast<const fillPath*>(&other);
+			return o != nullptr && o->p == p;
+		}
 		Path p;
 	};
 
@@ -253,94 +251,15 @@ namespace ScriptedDrawActions
 		{
 			g.strokePath(p, s);
 		}
+		bool isEqualTo(const ActionBase& other) const override
+		{
+			auto o = dynamic_cast<const drawPath*>(&other);
+			return o != nullptr && o->p == p && o->s == s;
+		}
 		Path p;
 		PathStrokeType s;
 	};
 
-	struct fillRect : public DrawActions::ActionBase
-	{
-		fillRect(Rectangle<float> area_) : area(area_) {};
-		void perform(Graphics& g) { g.fillRect(area); };
-		Rectangle<float> area;
-	};
-
-	struct fillEllipse : public DrawActions::ActionBase
-	{
-		fillEllipse(Rectangle<float> area_) : area(area_) {};
-		void perform(Graphics& g) { g.fillEllipse(area); };
-		Rectangle<float> area;
-	};
-
-	struct drawRect : public DrawActions::ActionBase
-	{
-		drawRect(Rectangle<float> area_, float borderSize_) : area(area_), borderSize(borderSize_) {};
-		void perform(Graphics& g) { g.drawRect(area, borderSize); };
-		Rectangle<float> area;
-		float borderSize;
-	};
-
-	struct drawEllipse : public DrawActions::ActionBase
-	{
-		drawEllipse(Rectangle<float> area_, float borderSize_) : area(area_), borderSize(borderSize_) {};
-		void perform(Graphics& g) { g.drawEllipse(area, borderSize); };
-		Rectangle<float> area;
-		float borderSize;
-	};
-
-	struct fillRoundedRect : public DrawActions::ActionBase
-	{
-		fillRoundedRect(Rectangle<float> area_, float cornerSize_) :
-			area(area_), cornerSize(cornerSize_) {};
-		void perform(Graphics& g) 
-		{ 
-			if(allRounded)
-				g.fillRoundedRectangle(area, cornerSize); 
-			else if (!rounded[0] && !rounded[1] && !rounded[2] && !rounded[3])
-				g.fillRect(area);
-			else
-			{
-				Path p;
-				p.addRoundedRectangle(area.getX(), area.getY(), area.getWidth(), area.getHeight(), 
-									  cornerSize, cornerSize, 
-									  rounded[0], rounded[1], rounded[2], rounded[3]);
-
-				g.fillPath(p);
-			}
-		};
-		Rectangle<float> area;
-		float cornerSize;
-
-		bool allRounded = true;
-		bool rounded[4] = { true, true, true, true };
-	};
-
-	struct drawRoundedRectangle : public DrawActions::ActionBase
-	{
-		drawRoundedRectangle(Rectangle<float> area_, float borderSize_, float cornerSize_) :
-			area(area_), borderSize(borderSize_), cornerSize(cornerSize_) {};
-		void perform(Graphics& g) 
-		{ 
-			if(allRounded)
-				g.drawRoundedRectangle(area, cornerSize, borderSize); 
-			else if (!rounded[0] && !rounded[1] && !rounded[2] && !rounded[3])
-				g.drawRect(area, borderSize);
-			else
-			{
-				Path p;
-				p.addRoundedRectangle(area.getX(), area.getY(), area.getWidth(), area.getHeight(),
-					cornerSize, cornerSize,
-					rounded[0], rounded[1], rounded[2], rounded[3]);
-
-				g.strokePath(p, PathStrokeType(borderSize));
-			}
-		};
-		Rectangle<float> area;
-		float cornerSize, borderSize;
-
-		bool allRounded = true;
-		bool rounded[4] = { true, true, true, true };
-	};
-
 	struct drawImageWithin : public DrawActions::ActionBase
 	{
 		drawImageWithin(const Image& img_, Rectangle<float> r_) :
@@ -377,42 +296,15 @@ namespace ScriptedDrawActions
 		int yOffset;
 	};
 
-	struct drawHorizontalLine : public DrawActions::ActionBase
-	{
-		drawHorizontalLine(int y_, float x1_, float x2_) :
-			y(y_), x1(x1_), x2(x2_) {};
-		void perform(Graphics& g) { g.drawHorizontalLine(y, x1, x2); };
-		int y; float x1; float x2;
-	};
-
-	struct drawVerticalLine : public DrawActions::ActionBase
-	{
-		drawVerticalLine(int x_, float y1_, float y2_) :
-			x(x_), y1(y1_), y2(y2_) {};
-		void perform(Graphics& g) { g.drawVerticalLine(x, y1, y2); };
-		int x; float y1; float y2;
-	};
-
-	struct setOpacity : public DrawActions::ActionBase
-	{
-		setOpacity(float alpha_) :
-			alpha(alpha_) {};
-		void perform(Graphics& g) { g.setOpacity(alpha); };
-		float alpha;
-	};
-
-	struct drawLine : public DrawActions::ActionBase
-	{
-		drawLine(float x1_, float x2_, float y1_, float y2_, float lineThickness_) :
-			x1(x1_), x2(x2_), y1(y1_), y2(y2_), lineThickness(lineThickness_) {};
-		void perform(Graphics& g) { g.drawLine(x1, x2, y1, y2, lineThickness); };
-		float x1, x2, y1, y2, lineThickness;
-	};
-
 	struct setFont : public DrawActions::ActionBase
 	{
 		setFont(Font f_) : f(f_) {};
 		void perform(Graphics& g) { g.setFont(f); };
+		bool isEqualTo(const ActionBase& other) const override
+		{
+			auto o = dynamic_cast<const setFont*>(&other);
+			return o != nullptr && o->f == f;
+		}
 		Font f;
 	};
 
@@ -420,6 +312,11 @@ namespace ScriptedDrawActions
 	{
 		setGradientFill(ColourGradient grad_) : grad(grad_) {};
 		void perform(Graphics& g) { g.setGradientFill(grad); };
+		bool isEqualTo(const ActionBase& other) const override
+		{
+			auto o = dynamic_cast<const setGradientFill*>(&other);
+			return o != nullptr && o->grad == grad;
+		}
 		ColourGradient grad;
 	};
 
@@ -427,6 +324,11 @@ namespace ScriptedDrawActions
 	{
 		drawText(const String& text_, Rectangle<float> area_, Justification j_ = Justification::centred) : text(text_), area(area_), j(j_) {};
 		void perform(Graphics& g) override { g.drawText(text, area, j); };
+		bool isEqualTo(const ActionBase& other) const override
+		{
+			auto o = dynamic_cast<const drawText*>(&other);
+			return o != nullptr && o->area == area && o->j == j && o->text == text;
+		}
 		String text;
 		Rectangle<float> area;
 		Justification j;
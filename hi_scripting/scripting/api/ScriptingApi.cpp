@@ -837,7 +837,11 @@ struct ScriptingApi::Engine::Wrapper
 	API_METHOD_WRAPPER_0(Engine, getHostBpm);
 	API_VOID_METHOD_WRAPPER_1(Engine, setHostBpm);
 	API_METHOD_WRAPPER_0(Engine, getCpuUsage);
+	API_METHOD_WRAPPER_0(Engine, getStreamingStatistics);
+	API_VOID_METHOD_WRAPPER_1(Engine, setAudioProfilerEnabled);
+	API_METHOD_WRAPPER_1(Engine, dumpAudioProfile);
 	API_METHOD_WRAPPER_0(Engine, getNumVoices);
+	API_METHOD_WRAPPER_0(Engine, getPropertyCacheStatistics);
 	API_METHOD_WRAPPER_0(Engine, getMemoryUsage);
 	API_METHOD_WRAPPER_1(Engine, getTempoName);
 	API_METHOD_WRAPPER_1(Engine, getMilliSecondsForTempo);
@@ -979,7 +983,11 @@ parentMidiProcessor(dynamic_cast<ScriptBaseMidiProcessor*>(p))
 	ADD_API_METHOD_0(getHostBpm);
 	ADD_API_METHOD_1(setHostBpm);
 	ADD_API_METHOD_0(getCpuUsage);
+	ADD_API_METHOD_0(getStreamingStatistics);
+	ADD_API_METHOD_1(setAudioProfilerEnabled);
+	ADD_API_METHOD_1(dumpAudioProfile);
 	ADD_API_METHOD_0(getNumVoices);
+	ADD_API_METHOD_0(getPropertyCacheStatistics);
 	ADD_API_METHOD_0(getMemoryUsage);
 	ADD_API_METHOD_1(getTempoName);
 	ADD_API_METHOD_1(getMilliSecondsForTempo);
@@ -1366,6 +1374,54 @@ double ScriptingApi::Engine::getMemoryUsage() const
 }
 
 double ScriptingApi::Engine::getCpuUsage() const { return (double)getProcessor()->getMainController()->getCpuUsage(); }
+
+var ScriptingApi::Engine::getStreamingStatistics() const
+{
+	auto pool = getProcessor()->getMainController()->getSampleManager().getGlobalSampleThreadPool();
+
+	Array<var> list;
+
+	for (int i = 0; i < pool->getNumWorkers(); i++)
+	{
+		auto stats = pool->getWorkerStatistics(i);
+
+		auto obj = new DynamicObject();
+		obj->setProperty("DiskUsage", stats.diskUsage);
+		obj->setProperty("NumJobsExecuted", stats.numJobsExecuted);
+		obj->setProperty("NumMissedDeadlines", stats.numMissedDeadlines);
+
+		list.add(var(obj));
+	}
+
+	return var(list);
+}
+
+void ScriptingApi::Engine::setAudioProfilerEnabled(bool shouldBeEnabled)
+{
+	AudioThreadProfiler::setEnabled(shouldBeEnabled);
+}
+
+bool ScriptingApi::Engine::dumpAudioProfile(var targetFile)
+{
+	File f;
+
+	if (auto sf = dynamic_cast<ScriptingObjects::ScriptFile*>(targetFile.getObject()))
+		f = sf->f;
+	else if (targetFile.isString() && File::isAbsolutePath(targetFile.toString()))
+		f = File(targetFile.toString());
+	else
+		reportScriptError("targetFile must be a File object or an absolute path");
+
+	auto mc = getScriptProcessor()->getMainController_();
+
+	// The writers return false if there are no events, so we only replace the file if they succeed
+	MemoryOutputStream mos;
+
+	auto ok = f.hasFileExtension(".json") ? AudioThreadProfiler::writeChromeTrace(mos, mc) :
+											AudioThreadProfiler::writeBinary(mos, mc);
+
+	return ok && f.replaceWithData(mos.getData(), mos.getDataSize());
+}
 int ScriptingApi::Engine::getNumVoices() const { return getProcessor()->getMainController()->getNumActiveVoices(); }
 
 String ScriptingApi::Engine::getMacroName(int index)
@@ -2260,6 +2316,11 @@ void ScriptingApi::Engine::extendTimeOut(int additionalMilliseconds)
 	dynamic_cast<JavascriptProcessor*>(getScriptProcessor())->getScriptEngine()->extendTimeout(additionalMilliseconds);
 }
 
+var ScriptingApi::Engine::getPropertyCacheStatistics()
+{
+	return dynamic_cast<JavascriptProcessor*>(getScriptProcessor())->getScriptEngine()->getPropertyCacheStatistics();
+}
+
 void ScriptingApi::Engine::setGlobalPitchFactor(double pitchFactorInSemitones)
 {
 	pitchFactorInSemitones = jlimit(-12.0, 12.0, pitchFactorInSemitones);
@@ -474,9 +474,21 @@ public:
 		/** Returns the current CPU usage in percent (0 ... 100) */
 		double getCpuUsage() const;
 
+		/** Returns an array with the disk usage, executed jobs and missed deadlines of each sample streaming thread. */
+		var getStreamingStatistics() const;
+
+		/** Enables the recording of the audio thread profiler. This affects all instances in the process (eg. in a DAW). */
+		void setAudioProfilerEnabled(bool shouldBeEnabled);
+
+		/** Writes the recorded audio thread profile to the given file. Use the .json extension for Chrome trace JSON, any other extension writes the binary format. Returns false (and leaves the file untouched) if there was nothing recorded. */
+		bool dumpAudioProfile(var targetFile);
+
 		/** Returns the amount of currently active voices. */
 		int getNumVoices() const;
 
+		/** Returns an object with the hit rate of the property lookup caches of this script processor. */
+		var getPropertyCacheStatistics();
+
 		/** Returns the name for the given macro index. */
 		String getMacroName(int index);
 
@@ -3298,6 +3298,7 @@ struct ScriptingApi::Content::ScriptPanel::Wrapper
 	API_VOID_METHOD_WRAPPER_1(ScriptPanel, setAnimation);
 	API_VOID_METHOD_WRAPPER_1(ScriptPanel, setAnimationFrame);
 	API_METHOD_WRAPPER_0(ScriptPanel, getAnimationData);
+	API_METHOD_WRAPPER_0(ScriptPanel, getPaintStatistics);
 	API_METHOD_WRAPPER_0(ScriptPanel, isVisibleAsPopup);
 	API_VOID_METHOD_WRAPPER_1(ScriptPanel, setIsModalPopup);
 	API_METHOD_WRAPPER_3(ScriptPanel, startExternalFileDrag);
@@ -3407,6 +3408,7 @@ void ScriptingApi::Content::ScriptPanel::init()
 	ADD_API_METHOD_0(getParentPanel);
 	ADD_API_METHOD_3(setMouseCursor);
 	ADD_API_METHOD_0(getAnimationData);
+	ADD_API_METHOD_0(getPaintStatistics);
 	ADD_API_METHOD_1(setAnimation);
 	ADD_API_METHOD_1(setAnimationFrame);
 	ADD_API_METHOD_3(startExternalFileDrag);
@@ -4051,6 +4053,25 @@ var ScriptingApi::Content::ScriptPanel::getAnimationData()
 #endif
 }
 
+var ScriptingApi::Content::ScriptPanel::getPaintStatistics()
+{
+	auto obj = new DynamicObject();
+
+	if (auto drawHandler = getDrawActionHandler())
+	{
+		auto s = drawHandler->getStatistics();
+
+		obj->setProperty("NumFrames", s.numFrames);
+		obj->setProperty("SkippedFrames", s.numSkippedFrames);
+		obj->setProperty("PartialRepaints", s.numPartialRepaints);
+		obj->setProperty("Replays", s.numReplays);
+		obj->setProperty("AllocationsLastFrame", s.numAllocationsLastFrame);
+		obj->setProperty("CommandsLastFrame", s.numCommandsLastFrame);
+	}
+
+	return var(obj);
+}
+
 void ScriptingApi::Content::ScriptPanel::setAnimation(String base64LottieAnimation)
 {
 #if HISE_INCLUDE_RLOTTIE
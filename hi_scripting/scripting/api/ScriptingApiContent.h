@@ -1817,6 +1817,9 @@ public:
 		/** Returns a JSON object containing the data of the animation object. */
 		var getAnimationData();
 
+		/** Returns a JSON object with the number of frames, skipped frames, allocations and replays of the paint routine. */
+		var getPaintStatistics();
+
 		/** Sets a paint routine (a function with one parameter). */
 		void setPaintRoutine(var paintFunction);
 
@@ -3538,6 +3538,7 @@ struct ScriptingObjects::ScriptingSynth::Wrapper
 	API_METHOD_WRAPPER_1(ScriptingSynth, getChildSynthByIndex);
 	API_METHOD_WRAPPER_0(ScriptingSynth, exportState);
 	API_METHOD_WRAPPER_1(ScriptingSynth, getCurrentLevel);
+	API_METHOD_WRAPPER_0(ScriptingSynth, getCpuUsage);
 	API_VOID_METHOD_WRAPPER_1(ScriptingSynth, restoreState);
 	API_METHOD_WRAPPER_3(ScriptingSynth, addModulator);
 	API_METHOD_WRAPPER_1(ScriptingSynth, getModulatorChain);
@@ -3578,6 +3579,7 @@ ScriptingObjects::ScriptingSynth::ScriptingSynth(ProcessorWithScriptingContent *
 	ADD_API_METHOD_0(isBypassed);
 	ADD_API_METHOD_1(getChildSynthByIndex);
 	ADD_API_METHOD_1(getCurrentLevel);
+	ADD_API_METHOD_0(getCpuUsage);
 	ADD_API_METHOD_0(exportState);
 	ADD_API_METHOD_1(restoreState);
 	ADD_API_METHOD_0(getNumAttributes);
@@ -3723,6 +3725,17 @@ float ScriptingObjects::ScriptingSynth::getCurrentLevel(bool leftChannel)
 	return 0.0f;
 }
 
+float ScriptingObjects::ScriptingSynth::getCpuUsage()
+{
+	if (checkValidObject())
+	{
+		if (auto s = dynamic_cast<ModulatorSynth*>(synth.get()))
+			return s->getCpuUsage();
+	}
+
+	return 0.0f;
+}
+
 var ScriptingObjects::ScriptingSynth::addModulator(var chainIndex, var typeName, var modName)
 {
 	if (checkValidObject())
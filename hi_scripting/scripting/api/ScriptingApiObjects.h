@@ -1946,6 +1946,9 @@ namespace ScriptingObjects
 		/** Returns the current peak level for the given channel. */
 		float getCurrentLevel(bool leftChannel);
 
+		/** Returns the CPU usage of the synth in percent of the buffer duration (only measured for children of a container). */
+		float getCpuUsage();
+
 		/** Adds a modulator to the given chain and returns a reference. */
 		var addModulator(var chainIndex, var typeName, var modName);
 
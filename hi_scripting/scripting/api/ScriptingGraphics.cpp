@@ -1591,18 +1591,34 @@ void ScriptingObjects::GraphicsObject::applyMask(var path, var area, bool invert
 void ScriptingObjects::GraphicsObject::fillAll(var colour)
 {
 	Colour c = ScriptingApi::Content::Helpers::getCleanedObjectColour(colour);
-	drawActionHandler.addDrawAction(new ScriptedDrawActions::fillAll(c));
+	drawActionHandler.addCommand(DrawActions::Command::fillAll(c));
 }
 
 void ScriptingObjects::GraphicsObject::fillRect(var area)
 {
-	drawActionHandler.addDrawAction(new ScriptedDrawActions::fillRect(getRectangleFromVar(area)));
+	drawActionHandler.addCommand(DrawActions::Command::fillRect(getRectangleFromVar(area)));
 }
 
 void ScriptingObjects::GraphicsObject::drawRect(var area, float borderSize)
 {
 	auto bs = (float)borderSize;
-	drawActionHandler.addDrawAction(new ScriptedDrawActions::drawRect(getRectangleFromVar(area), SANITIZED(bs)));
+	drawActionHandler.addCommand(DrawActions::Command::drawRect(getRectangleFromVar(area), SANITIZED(bs)));
+}
+
+static uint8 getRoundedCorners(const var& roundedArray)
+{
+	if (!roundedArray.isArray())
+		return 0xF;
+
+	uint8 corners = 0;
+
+	for (int i = 0; i < 4; i++)
+	{
+		if ((bool)roundedArray[i])
+			corners |= (uint8)(1 << i);
+	}
+
+	return corners;
 }
 
 void ScriptingObjects::GraphicsObject::fillRoundedRectangle(var area, var cornerData)
@@ -1612,25 +1628,13 @@ void ScriptingObjects::GraphicsObject::fillRoundedRectangle(var area, var corner
 		auto cs = (float)cornerData["CornerSize"];
 		cs = SANITIZED(cs);
 
-		auto newAction = new ScriptedDrawActions::fillRoundedRect(getRectangleFromVar(area), cs);
-		auto ra = cornerData["Rounded"];
-
-		if (ra.isArray())
-		{
-			newAction->allRounded = false;
-			newAction->rounded[0] = ra[0];
-			newAction->rounded[1] = ra[1];
-			newAction->rounded[2] = ra[2];
-			newAction->rounded[3] = ra[3];
-		}
-
-		drawActionHandler.addDrawAction(newAction);
+		drawActionHandler.addCommand(DrawActions::Command::fillRoundedRect(getRectangleFromVar(area), cs, getRoundedCorners(cornerData["Rounded"])));
 	}
 	else
 	{
 		auto cs = (float)cornerData;
 		cs = SANITIZED(cs);
-		drawActionHandler.addDrawAction(new ScriptedDrawActions::fillRoundedRect(getRectangleFromVar(area), cs));
+		drawActionHandler.addCommand(DrawActions::Command::fillRoundedRect(getRectangleFromVar(area), cs));
 	}
 }
 
@@ -1644,53 +1648,41 @@ void ScriptingObjects::GraphicsObject::drawRoundedRectangle(var area, var corner
 		auto cs = (float)cornerData["CornerSize"];
 		cs = SANITIZED(cs);
 
-		auto newAction = new ScriptedDrawActions::drawRoundedRectangle(getRectangleFromVar(area), borderSize, cs);
-		auto ra = cornerData["Rounded"];
-
-		if (ra.isArray())
-		{
-			newAction->allRounded = false;
-			newAction->rounded[0] = ra[0];
-			newAction->rounded[1] = ra[1];
-			newAction->rounded[2] = ra[2];
-			newAction->rounded[3] = ra[3];
-		}
-
-		drawActionHandler.addDrawAction(newAction);
+		drawActionHandler.addCommand(DrawActions::Command::drawRoundedRect(ar, cs, bs, getRoundedCorners(cornerData["Rounded"])));
 	}
 	else
 	{
 		auto cs = (float)cornerData;
 		cs = SANITIZED(cs);
-		drawActionHandler.addDrawAction(new ScriptedDrawActions::drawRoundedRectangle(ar, bs, cs));
+		drawActionHandler.addCommand(DrawActions::Command::drawRoundedRect(ar, cs, bs));
 	}
 }
 
 void ScriptingObjects::GraphicsObject::drawHorizontalLine(int y, float x1, float x2)
 {
-	drawActionHandler.addDrawAction(new ScriptedDrawActions::drawHorizontalLine(y, SANITIZED(x1), SANITIZED(x2)));
+	drawActionHandler.addCommand(DrawActions::Command::drawHorizontalLine(y, SANITIZED(x1), SANITIZED(x2)));
 }
 
 void ScriptingObjects::GraphicsObject::drawVerticalLine(int x, float y1, float y2)
 {
-	drawActionHandler.addDrawAction(new ScriptedDrawActions::drawVerticalLine(x, SANITIZED(y1), SANITIZED(y2)));
+	drawActionHandler.addCommand(DrawActions::Command::drawVerticalLine(x, SANITIZED(y1), SANITIZED(y2)));
 }
 
 void ScriptingObjects::GraphicsObject::setOpacity(float alphaValue)
 {
-	drawActionHandler.addDrawAction(new ScriptedDrawActions::setOpacity(alphaValue));
+	drawActionHandler.addCommand(DrawActions::Command::setOpacity(alphaValue));
 }
 
 void ScriptingObjects::GraphicsObject::drawLine(float x1, float x2, float y1, float y2, float lineThickness)
 {
-	drawActionHandler.addDrawAction(new ScriptedDrawActions::drawLine(
+	drawActionHandler.addCommand(DrawActions::Command::drawLine(
 		SANITIZED(x1), SANITIZED(y1), SANITIZED(x2), SANITIZED(y2), SANITIZED(lineThickness)));
 }
 
 void ScriptingObjects::GraphicsObject::setColour(var colour)
 {
 	auto c = ScriptingApi::Content::Helpers::getCleanedObjectColour(colour);
-	drawActionHandler.addDrawAction(new ScriptedDrawActions::setColour(c));
+	drawActionHandler.addCommand(DrawActions::Command::setColour(c));
 }
 
 void ScriptingObjects::GraphicsObject::setFont(String fontName, float fontSize)
@@ -1827,14 +1819,14 @@ void ScriptingObjects::GraphicsObject::setGradientFill(var gradientData)
 
 void ScriptingObjects::GraphicsObject::drawEllipse(var area, float lineThickness)
 {
-	drawActionHandler.addDrawAction(new ScriptedDrawActions::drawEllipse(getRectangleFromVar(area), lineThickness));
+	drawActionHandler.addCommand(DrawActions::Command::drawEllipse(getRectangleFromVar(area), lineThickness));
 }
 
 
 
 void ScriptingObjects::GraphicsObject::fillEllipse(var area)
 {
-	drawActionHandler.addDrawAction(new ScriptedDrawActions::fillEllipse(getRectangleFromVar(area)));
+	drawActionHandler.addCommand(DrawActions::Command::fillEllipse(getRectangleFromVar(area)));
 }
 
 void ScriptingObjects::GraphicsObject::drawImage(String imageName, var area, int /*xOffset*/, int yOffset)
@@ -1866,10 +1858,10 @@ void ScriptingObjects::GraphicsObject::drawImage(String imageName, var area, int
 	}
 	else
 	{
-		drawActionHandler.addDrawAction(new ScriptedDrawActions::setColour(Colours::grey));
-		drawActionHandler.addDrawAction(new ScriptedDrawActions::fillRect(getRectangleFromVar(area)));
-		drawActionHandler.addDrawAction(new ScriptedDrawActions::setColour(Colours::black));
-		drawActionHandler.addDrawAction(new ScriptedDrawActions::drawRect(getRectangleFromVar(area), 1.0f));
+		drawActionHandler.addCommand(DrawActions::Command::setColour(Colours::grey));
+		drawActionHandler.addCommand(DrawActions::Command::fillRect(getRectangleFromVar(area)));
+		drawActionHandler.addCommand(DrawActions::Command::setColour(Colours::black));
+		drawActionHandler.addCommand(DrawActions::Command::drawRect(getRectangleFromVar(area), 1.0f));
 		drawActionHandler.addDrawAction(new ScriptedDrawActions::setFont(GLOBAL_BOLD_FONT()));
 		drawActionHandler.addDrawAction(new ScriptedDrawActions::drawText("XXX", getRectangleFromVar(area), Justification::centred));
 
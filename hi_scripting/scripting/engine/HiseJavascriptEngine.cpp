@@ -1124,6 +1124,18 @@ void HiseJavascriptEngine::extendTimeout(int milliSeconds)
 	root->timeout = Time(newTimeout);
 }
 
+var HiseJavascriptEngine::getPropertyCacheStatistics() const
+{
+	const auto& stats = root->hiseSpecialData.propertyCacheStatistics;
+
+	DynamicObject::Ptr obj = new DynamicObject();
+	obj->setProperty("Hits", stats.numHits.load());
+	obj->setProperty("Misses", stats.numMisses.load());
+	obj->setProperty("HitRate", stats.getHitRate());
+
+	return var(obj.get());
+}
+
 void HiseJavascriptEngine::abortEverything()
 {
     preCompileListeners.sendMessage(sendNotificationSync, true);
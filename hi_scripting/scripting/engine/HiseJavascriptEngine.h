@@ -276,6 +276,16 @@ public:
 
 	var executeCallback(int callbackIndex, Result *result);
 
+	/** Enables the bytecode VM for the callbacks (or goes back to the syntax tree interpreter).
+
+		Don't call this while a callback might be executed. */
+	void setUseBytecodeForCallbacks(bool shouldUseBytecode);
+
+	bool isUsingBytecodeForCallbacks() const;
+
+	/** Returns a JSON object with the hit rate of the property lookup caches of this engine. */
+	var getPropertyCacheStatistics() const;
+
 	void setCallbackParameter(int callbackIndex, int parameterIndex, const var& newValue);
 
 
@@ -574,6 +584,7 @@ public:
         
 		struct Statement;
 		struct Expression;
+		struct BytecodeProgram;
 		
 		struct OptimizationPass
 		{
@@ -710,7 +721,7 @@ public:
 		// Variables
 
 		struct VarStatement;			struct LiteralValue; 		struct UnqualifiedName;
-		struct ArraySubscript;			struct Assignment;
+		struct ArraySubscript;			struct Assignment;			struct PropertyCache;
 		struct SelfAssignment;			struct PostAssignment;		struct AnonymousFunctionWithCapture;
 
 		// Function / Objects
@@ -774,10 +785,19 @@ public:
 
 			Callback(const Identifier &id, int numArgs, double bufferTime_);
 
+			~Callback();
+
 			var perform(RootObject *root);
 
 			void setStatements(BlockStatement *s) noexcept;
 
+			/** Lowers the statements into a BytecodeProgram that will be used by perform() instead of the syntax tree.
+
+				Returns false if the callback can't be lowered (or shouldUseBytecode is false). */
+			bool compileBytecode(bool shouldUseBytecode);
+
+			String getBytecodeDescription() const;
+
 			bool isDefined() const noexcept{ return isCallbackDefined; }
 
 			Identifier getObjectName() const override { return getName(); }
@@ -884,6 +904,8 @@ public:
 
 			private:
 
+			ReferenceCountedObjectPtr<BytecodeProgram> program;
+
 			double lastExecutionTime;
 			const Identifier callbackName;
 			int numArgs;
@@ -1011,6 +1033,9 @@ public:
 
 			void registerOptimisationPasses();
 
+			/** Recreates the bytecode programs of all callbacks. Returns the number of lowered callbacks. */
+			int compileCallbackBytecode();
+
 			static bool initHiddenProperties;
 
 			
@@ -1028,6 +1053,24 @@ public:
 
 			OwnedArray<OptimizationPass> optimizations;
 
+			bool useBytecode = false;
+
+			/** The hit / miss counters of the property caches in DotOperator and ArraySubscript.
+
+				The callbacks can run on different threads, so these are relaxed atomic counters. */
+			struct PropertyCacheStatistics
+			{
+				double getHitRate() const
+				{
+					const auto h = numHits.load(std::memory_order_relaxed);
+					const auto numLookups = h + numMisses.load(std::memory_order_relaxed);
+					return numLookups > 0 ? (double)h / (double)numLookups : 0.0;
+				}
+
+				std::atomic<int64> numHits = { 0 };
+				std::atomic<int64> numMisses = { 0 };
+			} propertyCacheStatistics;
+
 			DynamicObject::Ptr globals;
 
 			DynamicObject::Ptr preparsedconstVariableNames;
@@ -1182,6 +1182,7 @@ var HiseJavascriptEngine::executeCallback(int callbackIndex, Result *result)
 
 void HiseJavascriptEngine::RootObject::Callback::setStatements(BlockStatement *s) noexcept
 {
+	program = nullptr;
 	statements = s;
 	isCallbackDefined = s->statements.size() != 0;
 }
@@ -1202,14 +1203,25 @@ var HiseJavascriptEngine::RootObject::Callback::perform(RootObject *root)
 
     LocalScopeCreator::ScopedSetter svs(root, this);
 
-	statements->perform(s, &returnValue);
+	// Keeps the program alive if the callback recompiles the bytecode
+	BytecodeProgram::Ptr runningProgram = program;
+
+	if (runningProgram != nullptr)
+		runningProgram->execute(s, &returnValue);
+	else
+		statements->perform(s, &returnValue);
 
 	root->removeFromCallStack(callbackName);
 
 	const double post = Time::getMillisecondCounterHiRes();
 	lastExecutionTime = post - pre;
 #else
-	statements->perform(s, &returnValue);
+	BytecodeProgram::Ptr runningProgram = program;
+
+	if (runningProgram != nullptr)
+		runningProgram->execute(s, &returnValue);
+	else
+		statements->perform(s, &returnValue);
 #endif
 
 	return returnValue;
@@ -0,0 +1,728 @@
+/*  ===========================================================================
+*
+*   This file is part of HISE.
+*   Copyright 2016 Christoph Hart
+*
+*   HISE is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   HISE is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Commercial licenses for using HISE in an closed source project are
+*   available on request. Please visit the project's website to get more
+*   information about commercial licensing:
+*
+*   http://www.hise.audio/
+*
+*   HISE is based on the JUCE library,
+*   which also must be licenced for commercial applications:
+*
+*   http://www.juce.com
+*
+*   ===========================================================================
+*/
+
+namespace hise { using namespace juce;
+
+/** A flat register bytecode for the body of a callback.
+
+	The (already optimised) syntax tree of a callback is lowered into a list of instructions
+	that operate on a small register file. Variables with a fixed storage location (registers,
+	callback parameters and callback locals) are resolved to direct slot pointers and API calls
+	are dispatched without walking the expression tree.
+
+	Every node that can't be lowered is kept as a fallback instruction that calls back into the
+	syntax tree, so a program always behaves exactly like the tree interpreter. The program does
+	not own any nodes, so it must be recreated whenever the statements of the callback change.
+
+	The program is reference counted because a callback can recompile the programs of all callbacks
+	(eg. by calling exec()) while it is executed. Callback::perform() keeps a reference to the running
+	program, so the old program stays alive until the VM loop has returned.
+*/
+struct HiseJavascriptEngine::RootObject::BytecodeProgram: public ReferenceCountedObject
+{
+	using Ptr = ReferenceCountedObjectPtr<BytecodeProgram>;
+
+	enum class OpCode : uint8
+	{
+		LoadConstant,		// r[dst] = constants[index]
+		LoadSlot,			// r[dst] = *slots[index]
+		StoreSlot,			// *slots[index] = r[a]
+		Add,				// r[dst] = r[a] + r[b]
+		Subtract,
+		Multiply,
+		Equals,
+		NotEquals,
+		LessThan,
+		LessThanOrEqual,
+		GreaterThan,
+		GreaterThanOrEqual,
+		BinaryOp,			// r[dst] = nodes[index]->evaluate(r[a], r[b])
+		TypeEquals,
+		TypeNotEquals,
+		ToBool,				// r[dst] = (bool)r[a]
+		Jump,				// pc = index
+		JumpIfFalse,		// if (!r[a]) pc = index
+		JumpIfTrue,			// if (r[a]) pc = index
+		CheckParameter,		// checkValidParameter(b, r[a], nodes[index]->location)
+		ApiCall,			// r[dst] = nodes[index]->apiClass->callFunction(r + a)
+		Evaluate,			// r[dst] = nodes[index]->getResult(s)
+		Perform,			// nodes[index]->perform(s, returnValue)
+		CheckTimeout,
+		Return,				// *returnValue = r[a]
+		ExitWithCode,		// return (ResultCode)index
+		numOpCodes
+	};
+
+	struct Instruction
+	{
+		OpCode op;
+		int16 dst;
+		int16 a;
+		int16 b;
+		int index;
+
+		// Jump targets for break / continue statements that are returned by a Perform instruction
+		int breakTarget;
+		int continueTarget;
+	};
+
+	/** The maximum size of the register file. Callbacks that need more registers are not lowered. */
+	static constexpr int MaxRegisters = 64;
+
+	struct Compiler;
+
+	/** Lowers the statements of the given callback. Returns nullptr if the callback can't be lowered. */
+	static Ptr compile(Callback& c);
+
+	Statement::ResultCode execute(const Scope& s, var* returnValue) const
+	{
+		if (numRegisters <= 16)
+			return run<16>(s, returnValue);
+		else
+			return run<MaxRegisters>(s, returnValue);
+	}
+
+	String getDescription() const
+	{
+		String d;
+		d << String(instructions.size()) << " instructions, ";
+		d << String(numRegisters) << " registers, ";
+		d << String(numFallbacks) << " tree fallbacks";
+		return d;
+	}
+
+	Array<Instruction> instructions;
+	Array<var> constants;
+	Array<var*> slots;
+	Array<Statement*> nodes;
+
+	int numRegisters = 0;
+	int numFallbacks = 0;
+
+private:
+
+	/** Computes the result for two numeric operands without calling into the operator node.
+
+		This mirrors BinaryOperator::evaluate(): two integers are processed as int64, as soon as one
+		operand is a double, both are processed as double. Any other type combination returns false
+		and must be handled by the operator node.
+	*/
+	template <typename IntOp, typename DoubleOp> static bool evaluateNumeric(const var& a, const var& b, var& result, const IntOp& intOp, const DoubleOp& doubleOp)
+	{
+		const bool aIsInt = a.isInt() || a.isInt64();
+		const bool bIsInt = b.isInt() || b.isInt64();
+
+		if (aIsInt && bIsInt)
+		{
+			result = intOp((int64)a, (int64)b);
+			return true;
+		}
+
+		if ((aIsInt || a.isDouble()) && (bIsInt || b.isDouble()))
+		{
+			result = doubleOp((double)a, (double)b);
+			return true;
+		}
+
+		return false;
+	}
+
+	template <typename IntOp, typename DoubleOp> void binaryOp(const Instruction& i, var* r, const IntOp& intOp, const DoubleOp& doubleOp) const
+	{
+		if (!evaluateNumeric(r[i.a], r[i.b], r[i.dst], intOp, doubleOp))
+			r[i.dst] = static_cast<BinaryOperator*>(nodes.getUnchecked(i.index))->evaluate(r[i.a], r[i.b]);
+	}
+
+	static var callApi(const ApiCall& call, var* arguments)
+	{
+		const auto& location = call.location;
+
+		CHECK_CONDITION_WITH_LOCATION(call.apiClass != nullptr, "API class does not exist");
+
+		try
+		{
+			return call.apiClass->callFunction(call.functionIndex, arguments, call.expectedNumArguments);
+		}
+		catch (String& error)
+		{
+			throw Error::fromLocation(location, error);
+		}
+	}
+
+	template <int NumRegisters> Statement::ResultCode run(const Scope& s, var* returnValue) const
+	{
+		var r[NumRegisters];
+
+		auto code = instructions.begin();
+		const int numInstructions = instructions.size();
+		int pc = 0;
+
+		while (pc < numInstructions)
+		{
+			const auto& i = code[pc++];
+
+			switch (i.op)
+			{
+			case OpCode::LoadConstant:	r[i.dst] = constants.getReference(i.index); break;
+			case OpCode::LoadSlot:		r[i.dst] = *slots.getUnchecked(i.index); break;
+			case OpCode::StoreSlot:		*slots.getUnchecked(i.index) = r[i.a]; break;
+			case OpCode::Add:			binaryOp(i, r, [](int64 a, int64 b) { return a + b; }, [](double a, double b) { return a + b; }); break;
+			case OpCode::Subtract:		binaryOp(i, r, [](int64 a, int64 b) { return a - b; }, [](double a, double b) { return a - b; }); break;
+			case OpCode::Multiply:		binaryOp(i, r, [](int64 a, int64 b) { return a * b; }, [](double a, double b) { return a * b; }); break;
+			case OpCode::Equals:		binaryOp(i, r, [](int64 a, int64 b) { return a == b; }, [](double a, double b) { return a == b; }); break;
+			case OpCode::NotEquals:		binaryOp(i, r, [](int64 a, int64 b) { return a != b; }, [](double a, double b) { return a != b; }); break;
+			case OpCode::LessThan:		binaryOp(i, r, [](int64 a, int64 b) { return a < b; }, [](double a, double b) { return a < b; }); break;
+			case OpCode::LessThanOrEqual:	 binaryOp(i, r, [](int64 a, int64 b) { return a <= b; }, [](double a, double b) { return a <= b; }); break;
+			case OpCode::GreaterThan:		 binaryOp(i, r, [](int64 a, int64 b) { return a > b; }, [](double a, double b) { return a > b; }); break;
+			case OpCode::GreaterThanOrEqual: binaryOp(i, r, [](int64 a, int64 b) { return a >= b; }, [](double a, double b) { return a >= b; }); break;
+			case OpCode::BinaryOp:
+				r[i.dst] = static_cast<BinaryOperator*>(nodes.getUnchecked(i.index))->evaluate(r[i.a], r[i.b]);
+				break;
+			case OpCode::TypeEquals:	r[i.dst] = areTypeEqual(r[i.a], r[i.b]); break;
+			case OpCode::TypeNotEquals:	r[i.dst] = !areTypeEqual(r[i.a], r[i.b]); break;
+			case OpCode::ToBool:		r[i.dst] = (bool)r[i.a]; break;
+			case OpCode::Jump:			pc = i.index; break;
+			case OpCode::JumpIfFalse:	if (!(bool)r[i.a]) pc = i.index; break;
+			case OpCode::JumpIfTrue:	if ((bool)r[i.a]) pc = i.index; break;
+			case OpCode::CheckParameter:
+				HiseJavascriptEngine::checkValidParameter(i.b, r[i.a], nodes.getUnchecked(i.index)->location);
+				break;
+			case OpCode::ApiCall:
+				r[i.dst] = callApi(*static_cast<ApiCall*>(nodes.getUnchecked(i.index)), r + i.a);
+				break;
+			case OpCode::Evaluate:
+				r[i.dst] = static_cast<Expression*>(nodes.getUnchecked(i.index))->getResult(s);
+				break;
+			case OpCode::Perform:
+			{
+				if (auto rc = nodes.getUnchecked(i.index)->perform(s, returnValue))
+				{
+					if (rc == Statement::breakWasHit && i.breakTarget != -1)
+						pc = i.breakTarget;
+					else if (rc == Statement::continueWasHit && i.continueTarget != -1)
+						pc = i.continueTarget;
+					else
+						return rc;
+				}
+
+				break;
+			}
+			case OpCode::CheckTimeout:	s.checkTimeOut(nodes.getUnchecked(i.index)->location); break;
+			case OpCode::Return:
+				if (returnValue != nullptr)
+					*returnValue = r[i.a];
+
+				return Statement::returnWasHit;
+			case OpCode::ExitWithCode:	return (Statement::ResultCode)i.index;
+			case OpCode::numOpCodes:	jassertfalse; break;
+			}
+		}
+
+		return Statement::ok;
+	}
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(BytecodeProgram);
+};
+
+struct HiseJavascriptEngine::RootObject::BytecodeProgram::Compiler
+{
+	Compiler(BytecodeProgram& p_, Callback& c_) :
+		p(p_),
+		callback(c_)
+	{}
+
+	struct LoopLabels
+	{
+		Array<int> breakJumps;
+		Array<int> continueJumps;
+		Array<int> performs;
+	};
+
+	/** Returns the node if its dynamic type is exactly T (so that subclasses with custom behaviour are not lowered). */
+	template <typename T> static T* as(Statement* s)
+	{
+		return s != nullptr && typeid(*s) == typeid(T) ? static_cast<T*>(s) : nullptr;
+	}
+
+	int allocateRegister()
+	{
+		auto r = numUsedRegisters++;
+
+		if (numUsedRegisters > MaxRegisters)
+		{
+			failed = true;
+			return 0;
+		}
+
+		p.numRegisters = jmax(p.numRegisters, numUsedRegisters);
+		return r;
+	}
+
+	void releaseRegisters(int numToRelease = 1)
+	{
+		numUsedRegisters -= numToRelease;
+		jassert(numUsedRegisters >= 0);
+	}
+
+	int emit(OpCode op, int dst = 0, int a = 0, int b = 0, int index = 0)
+	{
+		p.instructions.add({ op, (int16)dst, (int16)a, (int16)b, index, -1, -1 });
+		return p.instructions.size() - 1;
+	}
+
+	int getCurrentPosition() const { return p.instructions.size(); }
+
+	void setJumpTarget(int instructionIndex, int target)
+	{
+		p.instructions.getReference(instructionIndex).index = target;
+	}
+
+	int addNode(Statement* s)
+	{
+		p.nodes.add(s);
+		return p.nodes.size() - 1;
+	}
+
+	int addConstant(const var& v)
+	{
+		p.constants.add(v);
+		return p.constants.size() - 1;
+	}
+
+	int addSlot(var* slot)
+	{
+		auto idx = p.slots.indexOf(slot);
+
+		if (idx == -1)
+		{
+			p.slots.add(slot);
+			idx = p.slots.size() - 1;
+		}
+
+		return idx;
+	}
+
+	/** Returns the storage location of expressions that always refer to the same variable. */
+	var* getSlot(Expression* e, bool forWriting) const
+	{
+		if (auto rn = as<RegisterName>(e))
+			return rn->data;
+
+		if (auto lr = as<CallbackLocalReference>(e))
+			return lr->parentCallback == &callback ? callback.localProperties.getVarPointer(lr->name) : nullptr;
+
+		if (!forWriting)
+		{
+			if (auto pr = as<CallbackParameterReference>(e))
+				return pr->data;
+		}
+
+		return nullptr;
+	}
+
+	void emitPerform(Statement* s)
+	{
+		auto idx = emit(OpCode::Perform, 0, 0, 0, addNode(s));
+
+		if (!loops.isEmpty())
+			loops.getReference(loops.size() - 1).performs.add(idx);
+
+		p.numFallbacks++;
+	}
+
+	void emitEvaluate(Expression* e, int dst)
+	{
+		emit(OpCode::Evaluate, dst, 0, 0, addNode(e));
+		p.numFallbacks++;
+	}
+
+	bool canLowerExpression(Expression* e) const
+	{
+		return as<LiteralValue>(e) != nullptr || as<ApiConstant>(e) != nullptr ||
+			   getSlot(e, false) != nullptr ||
+			   dynamic_cast<BinaryOperator*>(e) != nullptr ||
+			   as<LogicalAndOp>(e) != nullptr || as<LogicalOrOp>(e) != nullptr ||
+			   as<TypeEqualsOp>(e) != nullptr || as<TypeNotEqualsOp>(e) != nullptr ||
+			   as<ConditionalOp>(e) != nullptr || as<Assignment>(e) != nullptr ||
+			   as<SelfAssignment>(e) != nullptr || as<PostAssignment>(e) != nullptr ||
+			   as<ApiCall>(e) != nullptr;
+	}
+
+	static OpCode getOpCode(BinaryOperator* op)
+	{
+		auto& t = typeid(*op);
+
+		if (t == typeid(AdditionOp))			return OpCode::Add;
+		if (t == typeid(SubtractionOp))			return OpCode::Subtract;
+		if (t == typeid(MultiplyOp))			return OpCode::Multiply;
+		if (t == typeid(EqualsOp))				return OpCode::Equals;
+		if (t == typeid(NotEqualsOp))			return OpCode::NotEquals;
+		if (t == typeid(LessThanOp))			return OpCode::LessThan;
+		if (t == typeid(LessThanOrEqualOp))		return OpCode::LessThanOrEqual;
+		if (t == typeid(GreaterThanOp))			return OpCode::GreaterThan;
+		if (t == typeid(GreaterThanOrEqualOp))	return OpCode::GreaterThanOrEqual;
+
+		return OpCode::BinaryOp;
+	}
+
+	void lowerBinaryOperands(BinaryOperatorBase* op, int dst, OpCode opCode, int index)
+	{
+		lowerExpression(op->lhs.get(), dst);
+
+		auto rhs = allocateRegister();
+		lowerExpression(op->rhs.get(), rhs);
+		emit(opCode, dst, dst, rhs, index);
+		releaseRegisters();
+	}
+
+	void lowerApiCall(ApiCall* call, int dst)
+	{
+		if (call->apiClass == nullptr)
+			return emitEvaluate(call, dst);
+
+#if JUCE_ENABLE_AUDIO_GUARD
+		// The tree keeps the audio thread guard suspended while evaluating the arguments
+		if (call->apiClass->allowIllegalCallsOnAudioThread(call->functionIndex))
+			return emitEvaluate(call, dst);
+#endif
+
+		const int numArgs = call->expectedNumArguments;
+		const int firstArgument = numUsedRegisters;
+
+		for (int i = 0; i < numArgs; i++)
+			allocateRegister();
+
+		for (int i = 0; i < numArgs; i++)
+		{
+			lowerExpression(call->argumentList[i].get(), firstArgument + i);
+
+#if ENABLE_SCRIPTING_SAFE_CHECKS
+			emit(OpCode::CheckParameter, 0, firstArgument + i, i, addNode(call->argumentList[i].get()));
+#endif
+		}
+
+		emit(OpCode::ApiCall, dst, firstArgument, 0, addNode(call));
+		releaseRegisters(numArgs);
+	}
+
+	void lowerExpression(Expression* e, int dst)
+	{
+		if (failed)
+			return;
+
+		if (e == nullptr)
+		{
+			failed = true;
+			return;
+		}
+
+		if (auto lv = as<LiteralValue>(e))
+			emit(OpCode::LoadConstant, dst, 0, 0, addConstant(lv->value));
+		else if (auto ac = as<ApiConstant>(e))
+			emit(OpCode::LoadConstant, dst, 0, 0, addConstant(ac->value));
+		else if (auto slot = getSlot(e, false))
+			emit(OpCode::LoadSlot, dst, 0, 0, addSlot(slot));
+		else if (auto bo = dynamic_cast<BinaryOperator*>(e))
+			lowerBinaryOperands(bo, dst, getOpCode(bo), addNode(bo));
+		else if (auto te = as<TypeEqualsOp>(e))
+			lowerBinaryOperands(te, dst, OpCode::TypeEquals, 0);
+		else if (auto tne = as<TypeNotEqualsOp>(e))
+			lowerBinaryOperands(tne, dst, OpCode::TypeNotEquals, 0);
+		else if (as<LogicalAndOp>(e) != nullptr || as<LogicalOrOp>(e) != nullptr)
+		{
+			auto op = static_cast<BinaryOperatorBase*>(e);
+			auto jumpOp = as<LogicalAndOp>(e) != nullptr ? OpCode::JumpIfFalse : OpCode::JumpIfTrue;
+
+			lowerExpression(op->lhs.get(), dst);
+			emit(OpCode::ToBool, dst, dst);
+			auto shortCircuit = emit(jumpOp, 0, dst);
+			lowerExpression(op->rhs.get(), dst);
+			emit(OpCode::ToBool, dst, dst);
+			setJumpTarget(shortCircuit, getCurrentPosition());
+		}
+		else if (auto co = as<ConditionalOp>(e))
+		{
+			lowerExpression(co->condition.get(), dst);
+			auto jumpToFalse = emit(OpCode::JumpIfFalse, 0, dst);
+			lowerExpression(co->trueBranch.get(), dst);
+			auto jumpToEnd = emit(OpCode::Jump);
+			setJumpTarget(jumpToFalse, getCurrentPosition());
+			lowerExpression(co->falseBranch.get(), dst);
+			setJumpTarget(jumpToEnd, getCurrentPosition());
+		}
+		else if (auto pa = as<PostAssignment>(e))
+		{
+			if (auto slot = getSlot(pa->target, true))
+			{
+				emit(OpCode::LoadSlot, dst, 0, 0, addSlot(slot));
+
+				auto newValue = allocateRegister();
+				lowerExpression(pa->newValue.get(), newValue);
+				emit(OpCode::StoreSlot, 0, newValue, 0, addSlot(slot));
+				releaseRegisters();
+			}
+			else
+				emitEvaluate(e, dst);
+		}
+		else if (auto sa = as<SelfAssignment>(e))
+		{
+			if (auto slot = getSlot(sa->target, true))
+			{
+				lowerExpression(sa->newValue.get(), dst);
+				emit(OpCode::StoreSlot, 0, dst, 0, addSlot(slot));
+			}
+			else
+				emitEvaluate(e, dst);
+		}
+		else if (auto as_ = as<Assignment>(e))
+		{
+			if (auto slot = getSlot(as_->target.get(), true))
+			{
+				lowerExpression(as_->newValue.get(), dst);
+				emit(OpCode::StoreSlot, 0, dst, 0, addSlot(slot));
+			}
+			else
+				emitEvaluate(e, dst);
+		}
+		else if (auto call = as<ApiCall>(e))
+			lowerApiCall(call, dst);
+		else
+			emitEvaluate(e, dst);
+	}
+
+	void lowerLoop(LoopStatement* loop)
+	{
+		if (loop->isIterator || loop->isDoLoop || loop->initialiser == nullptr ||
+			loop->condition == nullptr || loop->iterator == nullptr || loop->body == nullptr)
+		{
+			return emitPerform(loop);
+		}
+
+		lowerStatement(loop->initialiser.get());
+
+		auto loopStart = getCurrentPosition();
+
+		auto condition = allocateRegister();
+		lowerExpression(loop->condition.get(), condition);
+		auto exitJump = emit(OpCode::JumpIfFalse, 0, condition);
+		releaseRegisters();
+
+#if USE_BACKEND
+		emit(OpCode::CheckTimeout, 0, 0, 0, addNode(loop));
+#endif
+
+		loops.add({});
+		lowerStatement(loop->body.get());
+		auto labels = loops.removeAndReturn(loops.size() - 1);
+
+		auto continueTarget = getCurrentPosition();
+		lowerStatement(loop->iterator.get());
+		emit(OpCode::Jump, 0, 0, 0, loopStart);
+
+		auto loopEnd = getCurrentPosition();
+
+		setJumpTarget(exitJump, loopEnd);
+
+		for (auto b : labels.breakJumps)
+			setJumpTarget(b, loopEnd);
+
+		for (auto c : labels.continueJumps)
+			setJumpTarget(c, continueTarget);
+
+		for (auto pIndex : labels.performs)
+		{
+			auto& i = p.instructions.getReference(pIndex);
+			i.breakTarget = loopEnd;
+			i.continueTarget = continueTarget;
+		}
+	}
+
+	void lowerStatement(Statement* st)
+	{
+		if (st == nullptr || failed)
+			return;
+
+		// An empty statement doesn't do anything
+		if (typeid(*st) == typeid(Statement))
+			return;
+
+		if (auto block = as<BlockStatement>(st))
+		{
+			if (!block->lockStatements.isEmpty())
+				return emitPerform(block);
+
+			for (auto s : block->statements)
+				lowerStatement(s);
+		}
+		else if (auto is = as<IfStatement>(st))
+		{
+			if (is->condition == nullptr)
+				return emitPerform(is);
+
+			auto condition = allocateRegister();
+			lowerExpression(is->condition.get(), condition);
+			auto jumpToFalse = emit(OpCode::JumpIfFalse, 0, condition);
+			releaseRegisters();
+
+			lowerStatement(is->trueBranch.get());
+			auto jumpToEnd = emit(OpCode::Jump);
+			setJumpTarget(jumpToFalse, getCurrentPosition());
+			lowerStatement(is->falseBranch.get());
+			setJumpTarget(jumpToEnd, getCurrentPosition());
+		}
+		else if (auto loop = as<LoopStatement>(st))
+			lowerLoop(loop);
+		else if (auto rs = as<ReturnStatement>(st))
+		{
+			if (rs->returnValue == nullptr)
+				return emitPerform(rs);
+
+			auto value = allocateRegister();
+			lowerExpression(rs->returnValue.get(), value);
+			emit(OpCode::Return, 0, value);
+			releaseRegisters();
+		}
+		else if (as<BreakStatement>(st) != nullptr)
+		{
+			if (loops.isEmpty())
+				emit(OpCode::ExitWithCode, 0, 0, 0, (int)Statement::breakWasHit);
+			else
+				loops.getReference(loops.size() - 1).breakJumps.add(emit(OpCode::Jump));
+		}
+		else if (as<ContinueStatement>(st) != nullptr)
+		{
+			if (loops.isEmpty())
+				emit(OpCode::ExitWithCode, 0, 0, 0, (int)Statement::continueWasHit);
+			else
+				loops.getReference(loops.size() - 1).continueJumps.add(emit(OpCode::Jump));
+		}
+		else if (auto cl = as<CallbackLocalStatement>(st))
+		{
+			auto slot = cl->parentCallback == &callback ? callback.localProperties.getVarPointer(cl->name) : nullptr;
+
+			if (slot == nullptr || cl->initialiser == nullptr)
+				return emitPerform(cl);
+
+			auto value = allocateRegister();
+			lowerExpression(cl->initialiser.get(), value);
+			emit(OpCode::StoreSlot, 0, value, 0, addSlot(slot));
+			releaseRegisters();
+		}
+		else
+		{
+			auto e = dynamic_cast<Expression*>(st);
+
+			if (e != nullptr && canLowerExpression(e))
+			{
+				auto unused = allocateRegister();
+				lowerExpression(e, unused);
+				releaseRegisters();
+			}
+			else
+				emitPerform(st);
+		}
+	}
+
+	BytecodeProgram& p;
+	Callback& callback;
+
+	Array<LoopLabels> loops;
+	int numUsedRegisters = 0;
+	bool failed = false;
+};
+
+HiseJavascriptEngine::RootObject::BytecodeProgram::Ptr HiseJavascriptEngine::RootObject::BytecodeProgram::compile(Callback& c)
+{
+#if ENABLE_SCRIPTING_BREAKPOINTS
+	// The breakpoints are checked by the block statements, so we need the tree
+	ignoreUnused(c);
+	return nullptr;
+#else
+	if (c.statements == nullptr || !c.isDefined())
+		return nullptr;
+
+	Ptr p = new BytecodeProgram();
+
+	Compiler compiler(*p, c);
+	compiler.lowerStatement(c.statements.get());
+
+	if (compiler.failed)
+		return nullptr;
+
+	// Nothing was lowered, so the program would just add overhead
+	if (p->numFallbacks == p->instructions.size())
+		return nullptr;
+
+	return p;
+#endif
+}
+
+HiseJavascriptEngine::RootObject::Callback::~Callback()
+{
+}
+
+bool HiseJavascriptEngine::RootObject::Callback::compileBytecode(bool shouldUseBytecode)
+{
+	program = shouldUseBytecode ? BytecodeProgram::compile(*this) : nullptr;
+	return program != nullptr;
+}
+
+String HiseJavascriptEngine::RootObject::Callback::getBytecodeDescription() const
+{
+	return program != nullptr ? program->getDescription() : String();
+}
+
+int HiseJavascriptEngine::RootObject::HiseSpecialData::compileCallbackBytecode()
+{
+	int numLowered = 0;
+
+	for (auto c : callbackNEW)
+	{
+		if (c->compileBytecode(useBytecode))
+			numLowered++;
+	}
+
+	return numLowered;
+}
+
+void HiseJavascriptEngine::setUseBytecodeForCallbacks(bool shouldUseBytecode)
+{
+	root->hiseSpecialData.useBytecode = shouldUseBytecode;
+	root->hiseSpecialData.compileCallbackBytecode();
+}
+
+bool HiseJavascriptEngine::isUsingBytecodeForCallbacks() const
+{
+	return root->hiseSpecialData.useBytecode;
+}
+
+} // namespace hise
@@ -1010,7 +1010,7 @@ void HiseJavascriptEngine::RootObject::HiseSpecialData::registerOptimisationPass
 		optimizations.add(new FunctionInliner());
 	}
 
-	
+	useBytecode = shouldOptimize || HISE_USE_SCRIPT_BYTECODE;
 }
 
 } // namespace hise
@@ -105,6 +105,62 @@ struct HiseJavascriptEngine::RootObject::ConstReference : public Expression
 
 
 
+/** A per-site inline cache for property lookups in DynamicObjects.
+
+	DynamicObjects don't have a hidden class, so the cache is keyed on the position of the property
+	in the object's property list: it remembers the slot index for the last NumEntries layouts that
+	were seen at this site (so it's monomorphic for a single layout and polymorphic for up to four).
+	A slot is validated by comparing the identifier, so every object that shares the layout (eg. because
+	it was created from the same literal) will hit the cache and any other object falls back to the search.
+
+	The same node can be evaluated on the audio and the message thread. The slots are relaxed atomics
+	and every slot is validated before it's used, so a concurrent update can only cause a cache miss.
+*/
+struct HiseJavascriptEngine::RootObject::PropertyCache
+{
+	static constexpr int NumEntries = 4;
+
+	var* getPropertyPointer(const Scope& s, DynamicObject* o, const Identifier& id) const
+	{
+		auto& properties = o->getProperties();
+		const int numProperties = properties.size();
+		const int numUsedEntries = numEntries.load(std::memory_order_relaxed);
+
+		for (int i = 0; i < numUsedEntries; i++)
+		{
+			const int slot = slots[i].load(std::memory_order_relaxed);
+
+			if (slot < numProperties && properties.getName(slot) == id)
+			{
+				if (auto r = s.root.get())
+					r->hiseSpecialData.propertyCacheStatistics.numHits.fetch_add(1, std::memory_order_relaxed);
+
+				return properties.getVarPointerAt(slot);
+			}
+		}
+
+		if (auto r = s.root.get())
+			r->hiseSpecialData.propertyCacheStatistics.numMisses.fetch_add(1, std::memory_order_relaxed);
+
+		const int slot = properties.indexOf(id);
+
+		if (slot == -1)
+			return nullptr;
+
+		// The most recent layout goes to the front, the oldest one is dropped
+		for (int i = jmin(numUsedEntries, NumEntries - 1); i > 0; i--)
+			slots[i].store(slots[i - 1].load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+		slots[0].store(slot, std::memory_order_relaxed);
+		numEntries.store(jmin(numUsedEntries + 1, NumEntries), std::memory_order_relaxed);
+
+		return properties.getVarPointerAt(slot);
+	}
+
+	mutable std::atomic<int> slots[NumEntries] = { { 0 }, { 0 }, { 0 }, { 0 } };
+	mutable std::atomic<int> numEntries = { 0 };
+};
+
 struct HiseJavascriptEngine::RootObject::ArraySubscript : public Expression
 {
 	ArraySubscript(const CodeLocation& l) noexcept : Expression(l) {}
@@ -133,16 +189,21 @@ struct HiseJavascriptEngine::RootObject::ArraySubscript : public Expression
 		else if (const Array<var>* array = result.getArray())
 			return (*array)[static_cast<int> (index->getResult(s))];
 
-        else if (const DynamicObject* obj = result.getDynamicObject())
+        else if (DynamicObject* obj = result.getDynamicObject())
         {
-            const String name = index->getResult(s).toString();
+            auto id = getKeyIdentifier(index->getResult(s));
             
-            if(name.isNotEmpty())
+            if(id.isValid())
             {
-                return obj->getProperty(Identifier(name));
+				// Subclasses might override getProperty(), so only plain objects use the cache
+				if (typeid(*obj) == typeid(DynamicObject))
+				{
+					if (auto v = propertyCache.getPropertyPointer(s, obj, id))
+						return *v;
+				}
+
+                return obj->getProperty(id);
             }
-            
-            
         }
         
 		return var::undefined();
@@ -187,8 +248,18 @@ struct HiseJavascriptEngine::RootObject::ArraySubscript : public Expression
         {
 			WARN_IF_AUDIO_THREAD(true, ScriptAudioThreadGuard::DynamicObjectAccess);
 
-            const String name = index->getResult(s).toString();
-            return obj->setProperty(Identifier(name), newValue);
+            auto id = getKeyIdentifier(index->getResult(s));
+
+			if (id.isValid() && typeid(*obj) == typeid(DynamicObject))
+			{
+				if (auto v = propertyCache.getPropertyPointer(s, obj, id))
+				{
+					*v = newValue;
+					return;
+				}
+			}
+
+            return obj->setProperty(id, newValue);
         }
 
 		Expression::assign(s, newValue);
@@ -208,9 +279,45 @@ struct HiseJavascriptEngine::RootObject::ArraySubscript : public Expression
 
 	void cacheIndex(AssignableObject *instance, const Scope &s) const;
 
+	/** Returns the identifier for a property key. 
+	
+		The last string key is cached so that a constant key doesn't need to go through the global string pool.
+	*/
+	Identifier getKeyIdentifier(const var& key) const
+	{
+		const String name = key.toString();
+
+		if (name.isEmpty())
+			return {};
+
+		if (key.isString())
+		{
+			SpinLock::ScopedTryLockType sl(keyLock);
+
+			if (sl.isLocked())
+			{
+				if (lastKeyId.isNull() || name != lastKey)
+				{
+					lastKey = name;
+					lastKeyId = Identifier(name);
+				}
+
+				return lastKeyId;
+			}
+		}
+
+		return Identifier(name);
+	}
+
 	ExpPtr object, index;
 
 	mutable int cachedIndex = -1;
+
+	PropertyCache propertyCache;
+
+	mutable SpinLock keyLock;
+	mutable String lastKey;
+	mutable Identifier lastKeyId;
 };
 
 #define DECLARE_ID(x) const juce::Identifier x(#x);
@@ -240,7 +347,7 @@ struct HiseJavascriptEngine::RootObject::DotOperator : public Expression
 
 		if (DynamicObject* o = p.getDynamicObject())
 		{
-			if (const var* v = getPropertyPointer(o, child))
+			if (const var* v = propertyCache.getPropertyPointer(s, o, child))
 				return *v;
 
 			return o->getProperty(child);
@@ -277,6 +384,16 @@ struct HiseJavascriptEngine::RootObject::DotOperator : public Expression
         
 		if (DynamicObject* o = v.getDynamicObject())
 		{
+			// Subclasses might override setProperty(), so only plain objects use the cache
+			if (typeid(*o) == typeid(DynamicObject))
+			{
+				if (auto ptr = propertyCache.getPropertyPointer(s, o, child))
+				{
+					*ptr = newValue;
+					return;
+				}
+			}
+
 			WARN_IF_AUDIO_THREAD(!o->hasProperty(child), ScriptAudioThreadGuard::ObjectResizing);
 
 			o->setProperty(child, newValue);
@@ -333,6 +450,8 @@ struct HiseJavascriptEngine::RootObject::DotOperator : public Expression
 	
 	ExpPtr parent;
 	Identifier child;
+
+	PropertyCache propertyCache;
 };
 
 
@@ -40,8 +40,12 @@ struct HiseJavascriptEngine::RootObject::BinaryOperator : public BinaryOperatorB
 
 	var getResult(const Scope& s) const override
 	{
-		var a(lhs->getResult(s)), b(rhs->getResult(s));
+		return evaluate(lhs->getResult(s), rhs->getResult(s));
+	}
 
+	/** Applies the operator to two already evaluated operands (used by the bytecode VM). */
+	var evaluate(const var& a, const var& b) const
+	{
 		if (isNumericOrUndefined(a) && isNumericOrUndefined(b))
 			return (a.isDouble() || b.isDouble()) ? getWithDoubles(a, b) : getWithInts(a, b);
 
@@ -2442,18 +2442,29 @@ void HiseJavascriptEngine::RootObject::execute(const String& code, bool allowCon
 		if(auto or_ = hiseSpecialData.runOptimisation(o))
 			results.add(or_);
 	}
+
+	// The bytecode is lowered from the optimised tree (and holds pointers to its nodes)
+	auto numLoweredCallbacks = hiseSpecialData.compileCallbackBytecode();
 	
 	auto after = Time::getMillisecondCounter();
 	
 	auto optimisationTimeMs = after - before;
 	
-	if (!results.isEmpty())
+	if (!results.isEmpty() || numLoweredCallbacks > 0)
 	{
 		String s;
 
 		for (auto r : results)
 			s << r.passName << ": " << String(r.numOptimizedStatements) << "\n";
 
+		for (auto c : hiseSpecialData.callbackNEW)
+		{
+			auto d = c->getBytecodeDescription();
+
+			if (d.isNotEmpty())
+				s << "Bytecode " << c->getName().toString() << "(): " << d << "\n";
+		}
+
 		s << "Optimization Duration: " << String(optimisationTimeMs) << "ms";
 
 		hiseSpecialData.processor->setOptimisationReport(s);
@@ -922,7 +922,7 @@ struct ScriptNodeTests : public juce::UnitTest
 		}
 	}
 
-	template <class T, int NumSamples> static T createAndConnect(float firstValue, float secondValue, float thirdValue)
+	template <class T, int NumSamples> static T createAndConnect(float firstValue, float secondValue, float thirdValue, PolyHandler* ph=nullptr)
 	{
 		T c;
 
@@ -934,6 +934,7 @@ struct ScriptNodeTests : public juce::UnitTest
 		ps.blockSize = NumSamples;
 		ps.numChannels = c.getNumChannels();
 		ps.sampleRate = 44100.0;
+		ps.voiceIndex = ph;
 
 		c.prepare(ps);
 		
@@ -991,6 +992,25 @@ struct ScriptNodeTests : public juce::UnitTest
 			expectContainerWorks<NumSamples>(c, "container::split", v);
 		}
 
+		RealtimeWorkerPool pool(2);
+		PolyHandler ph(false);
+		ph.setWorkerPool(&pool);
+
+		{
+			auto c = createAndConnect<container::parallel_split<PType, AddType, MulType, AddType>, NumSamples>(v1, v2, v3, &ph);
+			auto v = makeTestSpan<NumChannels, NumSamples>();
+			
+			for (auto& s : v)
+			{
+				auto copy = s;
+				s =  copy + v1;
+				s += copy * v2;
+				s += copy + v3;
+			}
+
+			expectContainerWorks<NumSamples>(c, "container::parallel_split", v);
+		}
+
 		{
 			auto c = createAndConnect<container::multi<PType, AddType, MulType, AddType>, NumSamples>(v1, v2, v3);
 			auto v = makeTestSpan<NumChannels * 3, NumSamples>();
@@ -1018,6 +1038,34 @@ struct ScriptNodeTests : public juce::UnitTest
 
 			expectContainerWorks<NumSamples>(c, "container::multi", v);
 		}
+
+		{
+			auto c = createAndConnect<container::parallel_multi<PType, AddType, MulType, AddType>, NumSamples>(v1, v2, v3, &ph);
+			auto v = makeTestSpan<NumChannels * 3, NumSamples>();
+			
+			constexpr int NumMultis = 3;
+
+			for(int s = 0; s < NumSamples; s++)
+			{
+				for (int c = 0; c < NumChannels; c++)
+				{
+					int cOffset = NumSamples * c;
+
+					for (int m = 0; m < NumMultis; m++)
+					{
+						int mOffset = NumSamples * NumChannels * m;
+						int posInData = s + mOffset + cOffset;
+						auto& value = v[posInData];
+
+						if (m == 0) value += v1;
+						if (m == 1) value *= v2;
+						if (m == 2) value += v3;
+					}
+				}
+			}
+
+			expectContainerWorks<NumSamples>(c, "container::parallel_multi", v);
+		}
 	}
 
 	struct PropertyDummy
@@ -44,6 +44,7 @@ struct DspNetwork::Wrapper
 	API_VOID_METHOD_WRAPPER_2(DspNetwork, clear);
 	API_METHOD_WRAPPER_1(DspNetwork, get);
 	API_METHOD_WRAPPER_1(DspNetwork, createTest);
+	API_METHOD_WRAPPER_1(DspNetwork, benchmarkFreezeModes);
 	API_VOID_METHOD_WRAPPER_1(DspNetwork, setForwardControlsToParameters);
 	API_METHOD_WRAPPER_1(DspNetwork, setParameterDataFromJSON);
 	API_METHOD_WRAPPER_3(DspNetwork, createAndAdd);
@@ -65,6 +66,9 @@ DspNetwork::DspNetwork(hise::ProcessorWithScriptingContent* p, ValueTree data_,
 #endif
 	parentHolder(dynamic_cast<Holder*>(p)),
 	projectNodeHolder(*this)
+#if HISE_INCLUDE_SNEX
+	, jitNodeHolder(*this)
+#endif
 {
 	jassert(data.getType() == PropertyIds::Network);
 
@@ -146,7 +150,15 @@ DspNetwork::DspNetwork(hise::ProcessorWithScriptingContent* p, ValueTree data_,
 
 	loader = new DspFactory::LibraryLoader(dynamic_cast<Processor*>(p));
 
-	setRootNode(createFromValueTree(true, data.getChild(0), true));
+	{
+#if HISE_INCLUDE_SNEX
+		// compile all SNEX nodes of the network in parallel once it's built
+		CodeManager::ScopedDeferredCompilation sdc(codeManager);
+#endif
+
+		setRootNode(createFromValueTree(true, data.getChild(0), true));
+	}
+
 	networkParameterHandler.root = getRootNode();
 
 	initialId = getId();
@@ -161,6 +173,7 @@ DspNetwork::DspNetwork(hise::ProcessorWithScriptingContent* p, ValueTree data_,
 	ADD_API_METHOD_1(setForwardControlsToParameters);
 	ADD_API_METHOD_1(setParameterDataFromJSON);
 	ADD_API_METHOD_1(createTest);
+	ADD_API_METHOD_1(benchmarkFreezeModes);
 	ADD_API_METHOD_2(clear);
 	ADD_API_METHOD_2(createFromJSON);
 	ADD_API_METHOD_0(undo);
@@ -463,6 +476,10 @@ void DspNetwork::reset()
 	
 	if (projectNodeHolder.isActive())
 		projectNodeHolder.n.reset();
+#if HISE_INCLUDE_SNEX
+	else if (jitNodeHolder.isActive())
+		jitNodeHolder.frozenNode->node->reset();
+#endif
 	else if (auto rn = getRootNode())
 		rn->reset();
 }
@@ -471,6 +488,16 @@ void DspNetwork::handleHiseEvent(HiseEvent& e)
 {
 	if (projectNodeHolder.isActive())
 		projectNodeHolder.n.handleHiseEvent(e);
+#if HISE_INCLUDE_SNEX
+	else if (jitNodeHolder.isActive())
+	{
+		if (auto s = SimpleReadWriteLock::ScopedTryReadLock(getConnectionLock()))
+		{
+			if (jitNodeHolder.isActive())
+				jitNodeHolder.frozenNode->node->handleHiseEvent(e);
+		}
+	}
+#endif
 	else
 		getRootNode()->handleHiseEvent(e);
 }
@@ -496,6 +523,15 @@ void DspNetwork::process(ProcessDataDyn& data)
 
 	if (auto s = SimpleReadWriteLock::ScopedTryReadLock(getConnectionLock()))
 	{
+#if HISE_INCLUDE_SNEX
+		// the frozen node is swapped with the write lock, so we need to check it here
+		if (jitNodeHolder.isActive())
+		{
+			jitNodeHolder.process(data);
+			return;
+		}
+#endif
+
 		if (exceptionHandler.isOk())
 			getRootNode()->process(data);
 	}
@@ -548,6 +584,11 @@ void DspNetwork::prepareToPlay(double sampleRate, double blockSize)
 
 				if (projectNodeHolder.isActive())
 					projectNodeHolder.prepare(currentSpecs);
+
+#if HISE_INCLUDE_SNEX
+				if (jitNodeHolder.isActive())
+					jitNodeHolder.prepare(currentSpecs);
+#endif
 			}
             
             initialised = true;
@@ -731,7 +772,81 @@ var DspNetwork::createTest(var testData)
 	return var();
 }
 
+var DspNetwork::benchmarkFreezeModes(int numBlocks)
+{
+	if (!currentSpecs)
+		reportScriptError("You need to call prepareToPlay() before running the benchmark");
+
+	auto numChannels = currentSpecs.numChannels;
+	auto blockSize = currentSpecs.blockSize;
+
+	AudioSampleBuffer input(numChannels, blockSize);
+	AudioSampleBuffer buffer(numChannels, blockSize);
+	HiseEventBuffer events;
+
+	Random r(0x1234);
+
+	for (int c = 0; c < numChannels; c++)
+	{
+		for (int i = 0; i < blockSize; i++)
+			input.setSample(c, i, r.nextFloat() * 2.0f - 1.0f);
+	}
+
+	DynamicObject::Ptr obj = new DynamicObject();
+
+	auto measure = [&](const Identifier& id, const std::function<void(ProcessDataDyn&)>& pf)
+	{
+		auto start = Time::getMillisecondCounterHiRes();
+
+		for (int i = 0; i < numBlocks; i++)
+		{
+			buffer.makeCopyOf(input, true);
+			ProcessDataDyn d(buffer.getArrayOfWritePointers(), blockSize, numChannels);
+			d.setEventBuffer(events);
+			pf(d);
+		}
+
+		obj->setProperty(id, (Time::getMillisecondCounterHiRes() - start) / (double)jmax(1, numBlocks));
+	};
+
+#if HISE_INCLUDE_SNEX
+	JitNodeHolder::FrozenNode jitNode;
+	auto jitResult = Result::fail("Polyphonic networks can't be frozen with the JIT compiler");
+
+	if (canBeJitFrozen())
+		jitResult = jitNode.compile(*this);
+
+	if (jitResult.failed())
+		obj->setProperty("JITError", jitResult.getErrorMessage());
+#endif
+
+	{
+		// the audio thread will skip the network while we're rendering the benchmark
+		SimpleReadWriteLock::ScopedWriteLock sl(getConnectionLock());
+
+		if (exceptionHandler.isOk())
+		{
+			measure("Interpreted", [&](ProcessDataDyn& d) { getRootNode()->process(d); });
+			getRootNode()->reset();
+		}
+
+#if HISE_INCLUDE_SNEX
+		if (jitResult.wasOk())
+			measure("JIT", [&](ProcessDataDyn& d) { jitNode.node->process(d); });
+#endif
 
+		if (projectNodeHolder.loaded)
+		{
+			if (!projectNodeHolder.isActive())
+				projectNodeHolder.prepare(currentSpecs);
+
+			measure("DLL", [&](ProcessDataDyn& d) { projectNodeHolder.n.process(d); });
+			projectNodeHolder.n.reset();
+		}
+	}
+
+	return var(obj.get());
+}
 
 bool DspNetwork::deleteIfUnused(String id)
 {
@@ -1144,6 +1259,11 @@ void DspNetwork::changeNodeId(ValueTree& c, const String& oldId, const String& n
 
 void DspNetwork::setUseFrozenNode(bool shouldBeEnabled)
 {
+#if HISE_INCLUDE_SNEX
+	if (isJitFrozen())
+		setUseJitFrozenNode(false);
+#endif
+
 	if (projectNodeHolder.isActive() == shouldBeEnabled)
 		return;
 
@@ -1154,13 +1274,41 @@ void DspNetwork::setUseFrozenNode(bool shouldBeEnabled)
 	reset();
 }
 
+#if HISE_INCLUDE_SNEX
+Result DspNetwork::setUseJitFrozenNode(bool shouldBeEnabled)
+{
+	if (shouldBeEnabled && !canBeJitFrozen())
+		return Result::fail("Polyphonic networks can't be frozen with the JIT compiler");
+
+	auto r = jitNodeHolder.setEnabled(shouldBeEnabled);
+
+	if (r.wasOk() && shouldBeEnabled)
+		projectNodeHolder.setEnabled(false);
+
+	reset();
+
+	return r;
+}
+#endif
+
 bool DspNetwork::hashMatches()
 {
+#if HISE_INCLUDE_SNEX
+	// the JIT node is created from the current network
+	if (isJitFrozen())
+		return true;
+#endif
+
 	return projectNodeHolder.hashMatches;
 }
 
 void DspNetwork::setExternalData(const snex::ExternalData& d, int index)
 {
+#if HISE_INCLUDE_SNEX
+	if (isJitFrozen())
+		jitNodeHolder.frozenNode->node->setExternalData(d, index);
+#endif
+
 	projectNodeHolder.n.setExternalData(d, index);
 }
 
@@ -1168,6 +1316,10 @@ hise::ScriptParameterHandler* DspNetwork::getCurrentParameterHandler()
 {
 	if (projectNodeHolder.isActive())
 		return &projectNodeHolder;
+#if HISE_INCLUDE_SNEX
+	else if (jitNodeHolder.isActive())
+		return &jitNodeHolder;
+#endif
 	else
 		return &networkParameterHandler;
 }
@@ -1483,10 +1635,108 @@ juce::File DspNetwork::CodeManager::getCodeFolder() const
 	return f;
 }
 
-DspNetwork::CodeManager::SnexSourceCompileHandler::SnexSourceCompileHandler(snex::ui::WorkbenchData* d, ProcessorWithScriptingContent* sp_) :
+snex::cppgen::ValueTreeBuilder::CodeProvider* DspNetwork::CodeManager::createCodeProvider()
+{
+	struct ManagerCodeProvider : public snex::cppgen::ValueTreeBuilder::CodeProvider
+	{
+		ManagerCodeProvider(CodeManager& m) :
+			manager(m)
+		{};
+
+		String getCode(const snex::NamespacedIdentifier& nodePath, const Identifier& classId) const override
+		{
+			auto typeId = nodePath.getIdentifier();
+
+			// use the code of the workbench so that unsaved changes are picked up
+			for (auto e : manager.entries)
+			{
+				if (e->type == typeId && e->wb->getInstanceId() == classId)
+					return e->wb->getCode();
+			}
+
+			auto f = manager.getCodeFolder().getChildFile(typeId.toString()).getChildFile(classId.toString());
+			return f.withFileExtension("h").loadFileAsString();
+		}
+
+		CodeManager& manager;
+	};
+
+	return new ManagerCodeProvider(*this);
+}
+
+void DspNetwork::CodeManager::compilePendingWorkbenches()
+{
+	auto numThreads = jmax(1, SystemStats::getNumCpus() - 1);
+
+	Array<SnexSourceCompileHandler*> running;
+	Array<SnexSourceCompileHandler*> compiled;
+
+	auto start = Time::getMillisecondCounterHiRes();
+
+	while (!pendingCompilations.isEmpty() || !running.isEmpty())
+	{
+		for (int i = 0; i < running.size(); i++)
+		{
+			if (!running[i]->isThreadRunning())
+				running.remove(i--);
+		}
+
+		while (running.size() < numThreads && !pendingCompilations.isEmpty())
+		{
+			auto h = pendingCompilations.removeAndReturn(0);
+
+			if (h->isThreadRunning())
+				h->stopThread(3000);
+
+			h->startThread();
+			running.add(h);
+			compiled.addIfNotAlreadyThere(h);
+		}
+
+		if (!running.isEmpty())
+			running.getFirst()->waitForThreadToExit(10);
+	}
+
+	if (compiled.isEmpty())
+		return;
+
+	// Compare the time the loader had to wait with the time a serial compilation would have taken
+	auto waitMs = Time::getMillisecondCounterHiRes() - start;
+	auto serialMs = 0.0;
+
+	for (auto h : compiled)
+	{
+		if (auto wb = h->getParent())
+			serialMs += wb->getLastResult().compileTimeMs;
+	}
+
+	String s;
+	s << "Compiled " << String(compiled.size()) << " SNEX workbenches in " << String(waitMs, 1) << "ms";
+	s << " (" << String(serialMs, 1) << "ms serial)";
+
+	debugToConsole(dynamic_cast<Processor*>(parent.getScriptProcessor()), s);
+}
+
+DspNetwork::CodeManager::ScopedDeferredCompilation::ScopedDeferredCompilation(CodeManager& cm) :
+	manager(cm),
+	wasDeferred(cm.deferCompilation)
+{
+	manager.deferCompilation = true;
+}
+
+DspNetwork::CodeManager::ScopedDeferredCompilation::~ScopedDeferredCompilation()
+{
+	manager.deferCompilation = wasDeferred;
+
+	if (!wasDeferred)
+		manager.compilePendingWorkbenches();
+}
+
+DspNetwork::CodeManager::SnexSourceCompileHandler::SnexSourceCompileHandler(CodeManager& manager_, snex::ui::WorkbenchData* d, ProcessorWithScriptingContent* sp_) :
 	Thread("SNEX Compile Thread", HISE_DEFAULT_STACK_SIZE),
 	CompileHandler(d),
 	ControlledObject(sp_->getMainController_()),
+	manager(manager_),
 	sp(sp_)
 {
 
@@ -1508,6 +1758,12 @@ bool DspNetwork::CodeManager::SnexSourceCompileHandler::triggerCompilation()
 {
 	getParent()->getGlobalScope().getBreakpointHandler().abort();
 
+	if (manager.deferCompilation)
+	{
+		manager.pendingCompilations.addIfNotAlreadyThere(this);
+		return false;
+	}
+
 	if (isThreadRunning())
 		stopThread(3000);
 
@@ -1692,6 +1948,121 @@ void DspNetwork::ProjectNodeHolder::init(dll::StaticLibraryHostFactory* staticLi
 	}
 }
 
+#if HISE_INCLUDE_SNEX
+Result DspNetwork::JitNodeHolder::FrozenNode::compile(DspNetwork& network)
+{
+	auto rootTree = network.getValueTree().getChild(0);
+
+	snex::cppgen::ValueTreeBuilder vb(rootTree, snex::cppgen::ValueTreeBuilder::Format::JitCompiledInstance);
+	vb.setCodeProvider(network.codeManager.createCodeProvider());
+
+	auto br = vb.createCppCode();
+
+	if (br.r.failed())
+		return br.r;
+
+	for (auto o : snex::jit::OptimizationIds::getDefaultIds())
+		memory.addOptimization(o);
+
+	memory.setPolyphonic(network.isPolyphonic());
+
+	auto numChannels = snex::cppgen::ValueTreeBuilder::getRootChannelAmount(rootTree);
+
+	snex::jit::Compiler c(memory);
+	node = new snex::jit::JitCompiledNode(c, br.code, rootTree[PropertyIds::ID].toString(), numChannels);
+
+	if (node->r.failed())
+		return node->r;
+
+	parameters = node->getParameterList();
+
+	auto numNetworkParameters = network.networkParameterHandler.getNumParameters();
+
+	if (parameters.size() != numNetworkParameters)
+	{
+		String e;
+		e << "The JIT compiled node has " << String(parameters.size()) << " parameters, but the network has " << String(numNetworkParameters);
+		return Result::fail(e);
+	}
+
+	if (auto dh = network.getExternalDataHolder())
+	{
+		ExternalData::forEachType([&](ExternalData::DataType dt)
+		{
+			for (int i = 0; i < node->getNumRequiredDataObjects(dt); i++)
+			{
+				if (auto cd = dh->getComplexBaseType(dt, i))
+				{
+					ExternalData ed(cd, i);
+					SimpleReadWriteLock::ScopedWriteLock sl(cd->getDataLock());
+					node->setExternalData(ed, i);
+				}
+			}
+		});
+	}
+
+	if (network.currentSpecs)
+	{
+		if (network.currentSpecs.numChannels < numChannels)
+			return Result::fail("The network processes less channels than the compile channel amount");
+
+		node->prepare(network.currentSpecs);
+	}
+
+	auto ph = network.getCurrentParameterHandler();
+
+	for (int i = 0; i < parameters.size(); i++)
+		parameters.getReference(i).callback.call(ph->getParameter(i));
+
+	return Result::ok();
+}
+
+Result DspNetwork::JitNodeHolder::setEnabled(bool shouldBeEnabled)
+{
+	ScopedPointer<FrozenNode> newNode;
+
+	if (shouldBeEnabled)
+	{
+		newNode = new FrozenNode();
+
+		auto r = newNode->compile(network);
+
+		if (r.failed())
+			return r;
+
+		auto ph = network.getCurrentParameterHandler();
+
+		for (int i = 0; i < newNode->parameters.size(); i++)
+			parameterValues[i] = ph->getParameter(i);
+	}
+	else if (isActive())
+	{
+		for (int i = 0; i < getNumParameters(); i++)
+			network.networkParameterHandler.setParameter(i, parameterValues[i]);
+	}
+
+	{
+		SimpleReadWriteLock::ScopedWriteLock sl(network.getConnectionLock());
+		frozenNode.swapWith(newNode);
+	}
+
+	// the previous node will be deleted here outside the lock
+	return Result::ok();
+}
+
+void DspNetwork::JitNodeHolder::prepare(PrepareSpecs ps)
+{
+	frozenNode->node->prepare(ps);
+}
+
+void DspNetwork::JitNodeHolder::process(ProcessDataDyn& data)
+{
+	NodeProfiler np(network.getRootNode(), data.getNumSamples());
+
+	frozenNode->node->process(data);
+}
+#endif
+
 int HostHelpers::getNumMaxDataObjects(const ValueTree& v, snex::ExternalData::DataType t)
 {
 	auto id = Identifier(snex::ExternalData::getDataTypeName(t, false));
@@ -333,11 +333,7 @@ public:
 			{
 				if (n->isForwardingControlsToParameters())
 				{
-					if(n->projectNodeHolder.isActive())
-						return const_cast<ScriptParameterHandler*>(static_cast<const ScriptParameterHandler*>(&n->projectNodeHolder));
-					else
-						return const_cast<ScriptParameterHandler*>(static_cast<const ScriptParameterHandler*>(&n->networkParameterHandler));
-					
+					return n->getCurrentParameterHandler();
 				}
 			}
 
@@ -501,6 +497,23 @@ public:
 			
 		}
 
+		/** Defers the compilation of all SNEX sources until this object goes out of scope.
+
+			The pending workbenches will then be compiled in parallel (each workbench only once,
+			no matter how many nodes are using it). The nodes stay bypassed until their compiled
+			code is swapped in on the message thread, just like with a regular background compilation.
+		*/
+		struct ScopedDeferredCompilation
+		{
+			ScopedDeferredCompilation(CodeManager& cm);
+			~ScopedDeferredCompilation();
+
+		private:
+
+			CodeManager& manager;
+			const bool wasDeferred;
+		};
+
 		struct SnexSourceCompileHandler : public snex::ui::WorkbenchData::CompileHandler,
 										  public ControlledObject,
 									      public Thread
@@ -518,7 +531,7 @@ public:
 				JUCE_DECLARE_WEAK_REFERENCEABLE(SnexCompileListener);
 			};
 
-			SnexSourceCompileHandler(snex::ui::WorkbenchData* d, ProcessorWithScriptingContent* sp_);;
+			SnexSourceCompileHandler(CodeManager& manager_, snex::ui::WorkbenchData* d, ProcessorWithScriptingContent* sp_);;
 
             ~SnexSourceCompileHandler()
             {
@@ -582,6 +595,8 @@ public:
 
 			std::atomic<bool> runTestNext = false;
 
+			CodeManager& manager;
+
 			ScopedPointer<TestBase> test;
 
 			ProcessorWithScriptingContent* sp;
@@ -602,7 +617,7 @@ public:
 			}
 
 			auto targetFile = getCodeFolder().getChildFile(typeId.toString()).getChildFile(classId.toString()).withFileExtension("h");
-			entries.add(new Entry(typeId, targetFile, parent.getScriptProcessor()));
+			entries.add(new Entry(*this, typeId, targetFile, parent.getScriptProcessor()));
 			return entries.getLast()->wb;
 		}
 
@@ -635,11 +650,14 @@ public:
 			return sa;
 		}
 
+		/** Creates a code provider for the ValueTreeBuilder that fetches the code of the SNEX nodes from this manager. */
+		snex::cppgen::ValueTreeBuilder::CodeProvider* createCodeProvider();
+
 	private:
 
 		struct Entry
 		{
-			Entry(const Identifier& t, const File& targetFile, ProcessorWithScriptingContent* sp):
+			Entry(CodeManager& cm, const Identifier& t, const File& targetFile, ProcessorWithScriptingContent* sp):
 				type(t),
 				parameterFile(targetFile.withFileExtension("xml"))
 			{
@@ -648,7 +666,7 @@ public:
 				cp = new snex::ui::WorkbenchData::DefaultCodeProvider(wb.get(), targetFile);
 				wb = new snex::ui::WorkbenchData();
 				wb->setCodeProvider(cp, dontSendNotification);
-				wb->setCompileHandler(new SnexSourceCompileHandler(wb.get(), sp));
+				wb->setCompileHandler(new SnexSourceCompileHandler(cm, wb.get(), sp));
 
 				if (auto xml = XmlDocument::parse(parameterFile))
 					parameterTree = ValueTree::fromXml(*xml);
@@ -696,6 +714,12 @@ public:
 
 		File getCodeFolder() const;
 
+		/** Compiles all deferred workbenches in parallel and waits until they are done. */
+		void compilePendingWorkbenches();
+
+		bool deferCompilation = false;
+		Array<SnexSourceCompileHandler*> pendingCompilations;
+
 		DspNetwork& parent;
 	} codeManager;
 #endif
@@ -786,8 +810,12 @@ public:
 
 	bool handleModulation(double& v)
 	{
-		if (isFrozen())
+		if (projectNodeHolder.isActive())
 			return projectNodeHolder.handleModulation(v);
+#if HISE_INCLUDE_SNEX
+		else if (jitNodeHolder.isActive())
+			return jitNodeHolder.handleModulation(v);
+#endif
 		else
 			return networkModValue.getChangedValue(v);
 	}
@@ -837,6 +865,9 @@ public:
 	/** Creates a test object for this network. */
 	var createTest(var testData);
 
+	/** Processes the given amount of blocks with the interpreted network, the JIT frozen network and the DLL node (if available) and returns the average milliseconds per block for each mode. */
+	var benchmarkFreezeModes(int numBlocks);
+
 	/** Deletes the node if it is not in a signal path. */
 	bool deleteIfUnused(String id);
 
@@ -999,7 +1030,37 @@ public:
 
 	bool canBeFrozen() const { return projectNodeHolder.loaded; }
 
-	bool isFrozen() const { return projectNodeHolder.isActive(); }
+	bool isFrozen() const 
+	{ 
+#if HISE_INCLUDE_SNEX
+		if (jitNodeHolder.isActive())
+			return true;
+#endif
+
+		return projectNodeHolder.isActive(); 
+	}
+
+#if HISE_INCLUDE_SNEX
+	/** Lowers the network into a single SNEX class and swaps in the JIT compiled object.
+
+		This uses the ValueTreeBuilder output of the network, so the parameters are dispatched
+		statically and the containers are inlined without the need of a C++ toolchain. The frozen
+		object is a snapshot of the network, so you need to freeze it again after you edit it.
+		If the network can't be lowered or compiled, the interpreted network stays active.
+	*/
+	Result setUseJitFrozenNode(bool shouldBeEnabled);
+
+	bool isJitFrozen() const { return jitNodeHolder.isActive(); }
+#endif
+
+	bool canBeJitFrozen() const 
+	{ 
+#if HISE_INCLUDE_SNEX
+		return !isPolyphonic(); 
+#else
+		return false;
+#endif
+	}
 
 	bool hashMatches();
 
@@ -1244,6 +1305,65 @@ private:
 		bool loaded = false;
 		bool forwardToNode = false;
 	} projectNodeHolder;
+
+#if HISE_INCLUDE_SNEX
+	struct JitNodeHolder : public hise::ScriptParameterHandler
+	{
+		/** The JIT compiled network with the global scope it was compiled with. */
+		struct FrozenNode
+		{
+			/** Creates the SNEX code of the network, compiles it and prepares it with the current specs. */
+			Result compile(DspNetwork& network);
+
+			snex::jit::GlobalScope memory;
+			snex::jit::JitCompiledNode::Ptr node;
+			ParameterDataList parameters;
+		};
+
+		JitNodeHolder(DspNetwork& parent) :
+			network(parent)
+		{}
+
+		Identifier getParameterId(int index) const override { return network.networkParameterHandler.getParameterId(index); }
+		int getNumParameters() const override { return isActive() ? frozenNode->parameters.size() : 0; }
+
+		void setParameter(int index, float newValue) override
+		{
+			if (isPositiveAndBelow(index, getNumParameters()))
+			{
+				parameterValues[index] = newValue;
+				frozenNode->parameters.getReference(index).callback.call(newValue);
+			}
+		}
+
+		float getParameter(int index) const override
+		{
+			if (isPositiveAndBelow(index, getNumParameters()))
+				return parameterValues[index];
+
+			return 0.0f;
+		}
+
+		bool isActive() const { return frozenNode != nullptr; }
+
+		/** The public_mod nodes of the compiled node write to the network mod value that
+		    they fetch from the tempo syncer of the poly handler in their prepare call. */
+		bool handleModulation(double& modValue)
+		{
+			return network.networkModValue.getChangedValue(modValue);
+		}
+
+		Result setEnabled(bool shouldBeEnabled);
+
+		void prepare(PrepareSpecs ps);
+
+		void process(ProcessDataDyn& data);
+
+		float parameterValues[OpaqueNode::NumMaxParameters];
+		DspNetwork& network;
+		ScopedPointer<FrozenNode> frozenNode;
+	} jitNodeHolder;
+#endif
     
 	JUCE_DECLARE_WEAK_REFERENCEABLE(DspNetwork);
 };
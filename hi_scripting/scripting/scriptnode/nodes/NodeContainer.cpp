@@ -519,9 +519,101 @@ void SerialNode::DynamicSerialProcessor::prepare(PrepareSpecs)
 
 
 ParallelNode::ParallelNode(DspNetwork* root, ValueTree data) :
-	NodeBase(root, data, 0)
+	NodeBase(root, data, 0),
+	parallel(PropertyIds::Parallel, false)
+{
+	parallel.initialise(this);
+
+	parallel.setAdditionalCallback([this](Identifier, var newValue)
+	{
+		RealtimeWorkerPool* pool = nullptr;
+
+		if ((bool)newValue)
+		{
+			pool = getRootNetwork()->getMainController()->getRealtimeWorkerPool();
+
+			// Compiled containers inside the network will fetch the pool from the poly handler
+			getRootNetwork()->getPolyHandler()->setWorkerPool(pool);
+		}
+
+		SimpleReadWriteLock::ScopedWriteLock sl(getRootNetwork()->getConnectionLock());
+
+		workerPool.store(pool);
+
+		// The branch buffers are only allocated if the property is enabled
+		if (lastSpecs)
+			prepare(lastSpecs);
+	}, true);
+}
+
+struct ParallelNode::BranchJob : public RealtimeWorkerPool::Job
+{
+	BranchJob(ParallelNode& p) :
+		parent(p),
+		profile(p.getRootNetwork()->getCpuProfileFlag())
+	{}
+
+	void processTask(int taskIndex, int) override
+	{
+		if (profile)
+		{
+			auto start = Time::getMillisecondCounterHiRes();
+			parent.processBranch(taskIndex);
+			auto delta = Time::getMillisecondCounterHiRes() - start;
+
+			auto& b = parent.branchCpuUsage.getReference(taskIndex);
+			b = b * 0.9 + 0.1 * delta;
+		}
+		else
+			parent.processBranch(taskIndex);
+	}
+
+	ParallelNode& parent;
+	const bool profile;
+};
+
+void ParallelNode::prepareBranches()
+{
+	branchCpuUsage.clearQuick();
+	branchCpuUsage.insertMultiple(0, 0.0, nodes.size());
+}
+
+bool ParallelNode::processBranchesInParallel()
+{
+	auto numBranches = nodes.size();
+	auto pool = workerPool.load();
+
+	if (pool == nullptr || numBranches != branchCpuUsage.size() || !canProcessInParallel())
+		return false;
+
+	BranchJob job(*this);
+	pool->processJob(job, numBranches);
+	return true;
+}
+
+String ParallelNode::getBranchCpuUsageInPercent() const
 {
+	String s;
+
+	if (workerPool.load() == nullptr || lastSpecs.sampleRate <= 0.0 || lastSpecs.blockSize <= 0)
+		return s;
+
+	auto bufferDuration = (double)lastSpecs.blockSize / lastSpecs.sampleRate;
+
+	s << " [";
+
+	for (int i = 0; i < branchCpuUsage.size(); i++)
+	{
+		auto bufferRatio = branchCpuUsage[i] * 0.001 / bufferDuration;
+		s << String(bufferRatio * 100.0, 1) << "%";
+
+		if (i != branchCpuUsage.size() - 1)
+			s << " | ";
+	}
+
+	s << "]";
 
+	return s;
 }
 
 NodeComponent* ParallelNode::createComponent()
@@ -249,6 +249,40 @@ public:
 	{
 		return forEachNode(f);
 	}
+
+	/** Returns the CPU usage of every branch if the branches are processed in parallel. */
+	String getBranchCpuUsageInPercent() const;
+
+	/** Returns true if the Parallel property is enabled and the buffers for parallel processing have been allocated. */
+	bool isParallelProcessingActive() const { return workerPool.load() != nullptr && canProcessInParallel(); }
+
+protected:
+
+	/** Call this in the prepare method to setup the branch timings. */
+	void prepareBranches();
+
+	/** Processes every branch on the RealtimeWorkerPool using processBranch().
+	
+		Returns false if the Parallel property is disabled, in this case the subclass has to process the 
+		branches serially.
+	*/
+	bool processBranchesInParallel();
+
+	/** Override this and process the branch with the given index. This will be called from 
+	    multiple threads at once so it must not write to any shared data. */
+	virtual void processBranch(int branchIndex) = 0;
+
+	/** Override this and return true if the buffers for parallel processing have been allocated. */
+	virtual bool canProcessInParallel() const = 0;
+
+	NodePropertyT<bool> parallel;
+
+private:
+
+	struct BranchJob;
+
+	std::atomic<RealtimeWorkerPool*> workerPool = { nullptr };
+	Array<double> branchCpuUsage;
 };
 
 class NodeContainerFactory : public NodeFactory
@@ -107,11 +107,19 @@ void SplitNode::prepare(PrepareSpecs ps)
 {
 	NodeBase::prepare(ps);
 	NodeContainer::prepareNodes(ps);
+	ParallelNode::prepareBranches();
+
+	activeBranches.clearQuick();
+	activeBranches.insertMultiple(0, false, nodes.size());
 
 	if (ps.blockSize > 1)
 	{
 		DspHelpers::increaseBuffer(original, ps);
 		DspHelpers::increaseBuffer(workBuffer, ps);
+
+		// Every branch gets its own buffer so that they can run at the same time
+		if (parallel.getValue())
+			DspHelpers::increaseBuffer(branchBuffer, ps.withNumChannels(ps.numChannels * nodes.size()));
 	}
 }
 
@@ -151,6 +159,42 @@ void SplitNode::process(ProcessDataDyn& data)
 			wptr += numSamples;
 		}
 	}
+
+	if (parallel.getValue())
+	{
+		firstActiveBranch = -1;
+
+		for (int i = 0; i < nodes.size(); i++)
+		{
+			auto active = !nodes.getUnchecked(i)->isBypassed();
+
+			if (active && firstActiveBranch == -1)
+				firstActiveBranch = i;
+
+			activeBranches.set(i, active);
+		}
+
+		currentData = &data;
+
+		if (processBranchesInParallel())
+		{
+			// Sum up the branches in the same order as the serial processing
+			for (int i = firstActiveBranch + 1; i < nodes.size(); i++)
+			{
+				if (!activeBranches[i])
+					continue;
+
+				int index = 0;
+				for (auto& c : data)
+					FloatVectorOperations::add(c.getRawWritePointer(), getBranchChannel(i, index++), numSamples);
+			}
+
+			currentData = nullptr;
+			return;
+		}
+
+		currentData = nullptr;
+	}
 	
 	int channelCounter = 0;
 
@@ -181,6 +225,52 @@ void SplitNode::process(ProcessDataDyn& data)
 	}
 }
 
+void SplitNode::processBranch(int branchIndex)
+{
+	if (!activeBranches[branchIndex])
+		return;
+
+	auto& data = *currentData;
+	auto n = nodes.getUnchecked(branchIndex);
+
+	if (branchIndex == firstActiveBranch)
+	{
+		n->process(data);
+		return;
+	}
+
+	float* ptrs[NUM_MAX_CHANNELS];
+	auto numSamples = data.getNumSamples();
+
+	for (int i = 0; i < data.getNumChannels(); i++)
+	{
+		ptrs[i] = getBranchChannel(branchIndex, i);
+		FloatVectorOperations::copy(ptrs[i], original.begin() + i * numSamples, numSamples);
+	}
+
+	ProcessDataDyn cp(ptrs, numSamples, data.getNumChannels());
+	cp.copyNonAudioDataFrom(data);
+
+	n->process(cp);
+}
+
+bool SplitNode::canProcessInParallel() const
+{
+	if (currentData == nullptr || activeBranches.size() != nodes.size())
+		return false;
+
+	auto numRequired = nodes.size() * currentData->getNumChannels() * currentData->getNumSamples();
+	return branchBuffer.size() >= numRequired;
+}
+
+float* SplitNode::getBranchChannel(int branchIndex, int channelIndex) const
+{
+	auto numSamples = currentData != nullptr ? currentData->getNumSamples() : 0;
+	auto numChannels = currentData != nullptr ? currentData->getNumChannels() : 0;
+
+	return const_cast<float*>(branchBuffer.begin()) + (branchIndex * numChannels + channelIndex) * numSamples;
+}
+
 void SplitNode::processMonoFrame(MonoFrameType& data)
 {
 	FrameDataPeakChecker fd(this, data.begin(), data.size());
@@ -504,6 +594,7 @@ void MultiChannelNode::prepare(PrepareSpecs ps)
 	
 	NodeBase::prepare(ps);
 	NodeContainer::prepareContainer(ps);
+	ParallelNode::prepareBranches();
 	int channelIndex = 0;
 
 	for (int i = 0; i < NUM_MAX_CHANNELS; i++)
@@ -565,6 +656,25 @@ void MultiChannelNode::process(ProcessDataDyn& d)
     
 	int channelIndex = 0;
 
+	if (parallel.getValue() && nodes.size() <= NUM_MAX_CHANNELS)
+	{
+		for (int i = 0; i < nodes.size(); i++)
+		{
+			auto numChannelsThisTime = nodes.getUnchecked(i)->getCurrentChannelAmount();
+			branchChannels[i] = { channelIndex, channelIndex + numChannelsThisTime };
+			channelIndex += numChannelsThisTime;
+		}
+
+		currentData = &d;
+		auto ok = processBranchesInParallel();
+		currentData = nullptr;
+
+		if (ok)
+			return;
+
+		channelIndex = 0;
+	}
+
 	for (auto n : nodes)
 	{
 		int numChannelsThisTime = n->getCurrentChannelAmount();
@@ -585,6 +695,31 @@ void MultiChannelNode::process(ProcessDataDyn& d)
 	}
 }
 
+void MultiChannelNode::processBranch(int branchIndex)
+{
+	auto& d = *currentData;
+	auto r = branchChannels[branchIndex];
+
+	// The branches write to different channels so there's no need for a copy
+	if (r.getEnd() <= d.getNumChannels())
+	{
+		float* ptrs[NUM_MAX_CHANNELS];
+
+		for (int i = 0; i < r.getLength(); i++)
+			ptrs[i] = d[r.getStart() + i].data;
+
+		ProcessDataDyn td(ptrs, d.getNumSamples(), r.getLength());
+		td.copyNonAudioDataFrom(d);
+		nodes.getUnchecked(branchIndex)->process(td);
+	}
+}
+
+bool MultiChannelNode::canProcessInParallel() const
+{
+	// The branches process the channels of the container directly, so there's nothing to allocate
+	return nodes.size() <= NUM_MAX_CHANNELS;
+}
+
 SingleSampleBlockX::SingleSampleBlockX(DspNetwork* n, ValueTree d) :
 	SerialNode(n, d)
 {
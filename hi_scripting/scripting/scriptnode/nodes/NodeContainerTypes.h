@@ -708,7 +708,18 @@ public:
 	void processStereoFrame(StereoFrameType& data) final override;
 
 	heap<float> original, workBuffer;
-	
+
+private:
+
+	void processBranch(int branchIndex) override;
+	bool canProcessInParallel() const override;
+
+	float* getBranchChannel(int branchIndex, int channelIndex) const;
+
+	heap<float> branchBuffer;
+	Array<bool> activeBranches;
+	int firstActiveBranch = -1;
+	ProcessDataDyn* currentData = nullptr;
 };
 
 
@@ -732,6 +743,14 @@ public:
 
 	float* currentChannelData[NUM_MAX_CHANNELS];
 	Range<int> channelRanges[NUM_MAX_CHANNELS];
+
+private:
+
+	void processBranch(int branchIndex) override;
+	bool canProcessInParallel() const override;
+
+	Range<int> branchChannels[NUM_MAX_CHANNELS];
+	ProcessDataDyn* currentData = nullptr;
 };
 
 class SingleSampleBlockX : public SerialNode
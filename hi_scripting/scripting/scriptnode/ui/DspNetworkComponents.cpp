@@ -1256,6 +1256,15 @@ bool DspNetworkGraph::Actions::toggleFreeze(DspNetworkGraph& g)
 	{
 		if (g.network->canBeFrozen())
 			g.network->setUseFrozenNode(!g.network->isFrozen());
+#if HISE_INCLUDE_SNEX
+		else if (g.network->canBeJitFrozen())
+		{
+			auto r = g.network->setUseJitFrozenNode(!g.network->isJitFrozen());
+
+			if (r.failed())
+				PresetHandler::showMessageWindow("Can't freeze network", r.getErrorMessage(), PresetHandler::IconType::Error);
+		}
+#endif
 
 		g.repaint();
 
@@ -2582,7 +2591,7 @@ void DspNetworkGraph::WrapperWithMenuBar::rebuildAfterContentChange()
 
     addButton("debug");
     
-	if(n->canBeFrozen())
+	if(n->canBeFrozen() || n->canBeJitFrozen())
 		addButton("export");
 
 	addButton("zoom");
@@ -2678,7 +2687,7 @@ void DspNetworkGraph::WrapperWithMenuBar::addButton(const String& name)
 			auto s = g.network->getSelection();
 
 			if (s.isEmpty())
-				return g.network->canBeFrozen();
+				return g.network->canBeFrozen() || g.network->canBeJitFrozen();
 			else
 			{
 				if (auto fn = s.getFirst()->getEmbeddedNetwork())
@@ -275,6 +275,9 @@ void NodeComponent::Header::paint(Graphics& g)
 	if (parent.node->getRootNetwork()->getCpuProfileFlag())
 	{
 		s << parent.node->getCpuUsageInPercent();
+
+		if (auto pn = dynamic_cast<ParallelNode*>(parent.node.get()))
+			s << pn->getBranchCpuUsageInPercent();
 	}
 
 	leftMargin += textArea.getHeight();
@@ -820,7 +820,7 @@ void SnexPlayground::recompiled(ui::WorkbenchData::Ptr p)
 	{
 		editor.editor.setError({});
 		resized();
-		resultLabel.setText("OK", dontSendNotification);
+		resultLabel.setText("OK (" + String(r.compileTimeMs, 1) + "ms)", dontSendNotification);
 	}
 	else
 	{
@@ -208,7 +208,12 @@ bool ui::WorkbenchData::handleCompilation()
 		if (getGlobalScope().getBreakpointHandler().shouldAbort())
 			return true;
 
+		auto start = Time::getMillisecondCounterHiRes();
+
 		lastCompileResult = compileHandler->compile(s);
+		lastCompileResult.compileTimeMs = Time::getMillisecondCounterHiRes() - start;
+
+		logMessage(BaseCompiler::ProcessMessage, "Compilation time: " + String(lastCompileResult.compileTimeMs, 1) + "ms");
 
 		callAsyncWithSafeCheck([](WorkbenchData* d) { d->postCompile(); });
 
@@ -224,7 +229,159 @@ bool ui::WorkbenchData::handleCompilation()
 	return true;
 }
 
+ui::WorkbenchData::CompilationCache::CompilationCache(WorkbenchData& parent_) :
+	parent(parent_)
+{
+	parent.getGlobalScope().addObjectDeleteListener(this);
+}
+
+ui::WorkbenchData::CompilationCache::~CompilationCache()
+{
+	parent.getGlobalScope().removeObjectDeleteListener(this);
+}
+
+bool ui::WorkbenchData::CompilationCache::getCachedResult(const String& code, const String& compilerConfiguration, CompileResult& r)
+{
+	if (!enabled)
+		return false;
+
+	auto key = createKey(code, compilerConfiguration);
+	auto hash = key.hashCode64();
+
+	ScopedLock sl(lock);
 
+	for (int i = 0; i < entries.size(); i++)
+	{
+		auto& e = entries.getReference(i);
+
+		if (e.hash == hash && e.key == key)
+		{
+			r.compileResult = e.result.compileResult;
+			r.assembly = e.result.assembly;
+			r.obj = e.result.obj;
+			r.mainClassPtr = e.result.mainClassPtr;
+
+			stats.numHits++;
+			stats.secondsSaved += e.compileSeconds;
+
+			// move it to the end so that the least recently used entry will be evicted first
+			entries.move(i, -1);
+
+			parent.logMessage(BaseCompiler::ProcessMessage, "Reusing cached compilation result (" + stats.toString() + ")");
+			return true;
+		}
+	}
+
+	stats.numMisses++;
+	return false;
+}
+
+void ui::WorkbenchData::CompilationCache::addResult(const String& code, const String& compilerConfiguration, const CompileResult& r, double compileSeconds)
+{
+	if (!enabled || !r.compiledOk())
+		return;
+
+	Entry e;
+	e.key = createKey(code, compilerConfiguration);
+	e.hash = e.key.hashCode64();
+	e.code = code;
+	e.result.compileResult = r.compileResult;
+	e.result.assembly = r.assembly;
+	e.result.obj = r.obj;
+	e.result.mainClassPtr = r.mainClassPtr;
+	e.compileSeconds = compileSeconds;
+
+	ScopedLock sl(lock);
+
+	while (entries.size() >= MaxNumEntries)
+	{
+		entries.remove(0);
+		stats.numEvictions++;
+	}
+
+	entries.add(std::move(e));
+}
+
+void ui::WorkbenchData::CompilationCache::invalidate(const String& code)
+{
+	ScopedLock sl(lock);
+
+	for (int i = 0; i < entries.size(); i++)
+	{
+		if (entries.getReference(i).code == code)
+			entries.remove(i--);
+	}
+}
+
+void ui::WorkbenchData::CompilationCache::clear()
+{
+	ScopedLock sl(lock);
+	entries.clear();
+}
+
+void ui::WorkbenchData::CompilationCache::setEnabled(bool shouldBeEnabled)
+{
+	enabled = shouldBeEnabled;
+
+	if (!enabled)
+		clear();
+}
+
+ui::WorkbenchData::CompilationCache::Statistics ui::WorkbenchData::CompilationCache::getStatistics() const
+{
+	ScopedLock sl(lock);
+	return stats;
+}
+
+String ui::WorkbenchData::CompilationCache::Statistics::toString() const
+{
+	String s;
+	s << "Hits: " << String(numHits) << ", Misses: " << String(numMisses);
+	s << ", Evictions: " << String(numEvictions);
+	s << ", Time saved: " << String(secondsSaved * 1000.0, 1) << "ms";
+	return s;
+}
+
+String ui::WorkbenchData::CompilationCache::createKey(const String& code, const String& compilerConfiguration) const
+{
+	auto& gs = parent.getGlobalScope();
+
+	String s;
+
+	s << "channels:" << String(parent.numChannels) << ";";
+	s << "instance:" << parent.getInstanceId().toString() << ";";
+	s << "optimisations:" << gs.getOptimizationPassList().joinIntoString(",") << ";";
+	s << "debug:" << String((int)gs.isDebugModeEnabled()) << ";";
+	s << "poly:" << String((int)gs.getPolyHandler()->isEnabled()) << ";";
+
+	for (const auto& d : gs.getPreprocessorDefinitions())
+		s << d.name << "=" << d.value << ";";
+
+	s << "cpu:" << getCpuFeatures() << "\n";
+	s << "compiler:\n" << compilerConfiguration << "\n";
+	s << code;
+
+	return s;
+}
+
+String ui::WorkbenchData::CompilationCache::getCpuFeatures()
+{
+	static const String features = []()
+	{
+		String f;
+
+		if (SystemStats::hasSSE41()) f << "sse41,";
+		if (SystemStats::hasSSE42()) f << "sse42,";
+		if (SystemStats::hasAVX()) f << "avx,";
+		if (SystemStats::hasAVX2()) f << "avx2,";
+		if (SystemStats::hasFMA3()) f << "fma3,";
+		if (SystemStats::hasNeon()) f << "neon,";
+
+		return f;
+	}();
+
+	return features;
+}
 
 snex::ui::WorkbenchData::Ptr ui::WorkbenchManager::getWorkbenchDataForCodeProvider(WorkbenchData::CodeProvider* p, bool ownCodeProvider)
 {
@@ -332,6 +332,9 @@ public:
 		JitObject obj;
 		ComplexType::Ptr mainClassPtr;
 
+		/** The time in milliseconds that the last compilation took. */
+		double compileTimeMs = 0.0;
+
 
 		scriptnode::ParameterDataList parameters;
 		JitCompiledNode::Ptr lastNode;
@@ -846,9 +849,85 @@ public:
 		JUCE_DECLARE_NON_COPYABLE(TestData);
 	};
 
-	
+	/** A cache for the compilation results of a workbench.
 
-	
+		If the workbench compiles code that it has compiled before with the same settings
+		(eg. because multiple nodes use the same class or the debug mode was toggled back),
+		it will reuse the last result instead of parsing, optimising and assembling the code again.
+
+		The key contains the code, the symbols that were registered by CompileHandler::createCompiler()
+		and every setting that affects the generated machine code (channel amount, optimisations, debug mode,
+		polyphony, preprocessor definitions and CPU features), so a compile handler that registers other
+		objects will not reuse the results of the default compiler.
+
+		This is an in-memory cache for a single session: the machine code contains absolute addresses
+		to the global scope of the workbench, so the results can't be shared between workbenches or 
+		stored to disk. The cache only lives as long as the workbench, so reloading the project will 
+		compile every node again.
+	*/
+	struct CompilationCache : public GlobalScope::ObjectDeleteListener
+	{
+		static constexpr int MaxNumEntries = 8;
+
+		struct Statistics
+		{
+			String toString() const;
+
+			int numHits = 0;
+			int numMisses = 0;
+			int numEvictions = 0;
+			double secondsSaved = 0.0;
+		};
+
+		CompilationCache(WorkbenchData& parent_);
+		~CompilationCache();
+
+		/** Writes the cached result into r and returns true if there is a result for the code. 
+		
+			The compilerConfiguration should describe the compiler that is used to compile the
+			code (Compiler::getRegisteredSymbols()).
+		*/
+		bool getCachedResult(const String& code, const String& compilerConfiguration, CompileResult& r);
+
+		/** Adds the result to the cache. Failed compilations will not be cached. */
+		void addResult(const String& code, const String& compilerConfiguration, const CompileResult& r, double compileSeconds);
+
+		/** Removes all results for the given code (with any settings). */
+		void invalidate(const String& code);
+
+		/** Removes all results. This will be called automatically if an object was removed from the global scope. */
+		void clear();
+
+		void setEnabled(bool shouldBeEnabled);
+
+		Statistics getStatistics() const;
+
+		void objectWasDeleted(const NamespacedIdentifier& ) override { clear(); }
+
+	private:
+
+		struct Entry
+		{
+			int64 hash;
+			String key;
+			String code;
+			CompileResult result;
+			double compileSeconds;
+		};
+
+		String createKey(const String& code, const String& compilerConfiguration) const;
+
+		static String getCpuFeatures();
+
+		WorkbenchData& parent;
+		bool enabled = true;
+
+		CriticalSection lock;
+		Array<Entry> entries;
+		Statistics stats;
+
+		JUCE_DECLARE_NON_COPYABLE(CompilationCache);
+	};
 
 	struct CompileHandler : public SubItemBase,
 						    public TestRunnerBase
@@ -880,9 +959,18 @@ public:
 		*/
 		virtual CompileResult compile(const String& codeToCompile)
 		{
-            Compiler::Ptr cc = createCompiler();
+			auto& cache = getParent()->getCompilationCache();
 
 			CompileResult r;
+
+			auto start = Time::getMillisecondCounterHiRes();
+
+			Compiler::Ptr cc = createCompiler();
+			auto compilerConfiguration = cc->getRegisteredSymbols();
+
+			if (cache.getCachedResult(codeToCompile, compilerConfiguration, r))
+				return r;
+
 			r.obj = cc->compileJitObject(codeToCompile);
 			r.assembly = cc->getAssemblyCode();
 			r.compileResult = cc->getCompileResult();
@@ -899,6 +987,8 @@ public:
 
 			r.mainClassPtr = cc->getComplexType(mainObjectId, {tp}, true);
 
+			cache.addResult(codeToCompile, compilerConfiguration, r, (Time::getMillisecondCounterHiRes() - start) * 0.001);
+
 			return r;
 		}
 
@@ -1050,6 +1140,7 @@ public:
 
 	WorkbenchData() :
 		memory(),
+		compilationCache(*this),
 		currentTestData(*this)
 	{
 		memory.addDebugHandler(this);
@@ -1168,6 +1259,8 @@ public:
 
 	CompileResult getLastResult() const { return lastCompileResult; }
 
+	CompilationCache& getCompilationCache() { return compilationCache; }
+
 	CompileResult& getLastResultReference() { return lastCompileResult; }
 
 	JitObject getLastJitObject() const { return lastCompileResult.obj; }
@@ -1255,6 +1348,7 @@ private:
 	hise::UnorderedStack<int> pendingBlinks;
 
 	GlobalScope memory;
+	CompilationCache compilationCache;
 	int numChannels = 2;
 
 	WeakReference<Holder> holder;
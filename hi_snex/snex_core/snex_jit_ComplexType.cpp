@@ -36,7 +36,7 @@ namespace jit {
 using namespace juce;
 using namespace asmjit;
 
-int ComplexType::numInstances = 0;
+std::atomic<int> ComplexType::numInstances { 0 };
 
 Result ComplexType::callConstructor(InitData& d)
 {
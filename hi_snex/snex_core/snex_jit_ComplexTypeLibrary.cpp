@@ -235,6 +235,93 @@ snex::jit::FunctionClass* SpanType::getFunctionClass()
 		};
 	}
 
+	{
+		// Returns the first N / 4 SIMD elements, the remaining elements 
+		// can be accessed with toSimdRemainder()
+		auto toSimdHeadFunction = new FunctionData();
+		toSimdHeadFunction->id = st->getClassName().getChildId("toSimdHead");
+		toSimdHeadFunction->returnType = TypeInfo(Types::ID::Dynamic, false, true);
+		toSimdHeadFunction->inliner = Inliner::createAsmInliner(toSimdHeadFunction->id, [](InlineData* b)
+		{
+			auto d = b->toAsmInlineData();
+
+			if (!d->gen.canVectorize())
+				return Result::fail("Vectorization is deactivated");
+
+			if (d->object->isMemoryLocation())
+				d->target->setCustomMemoryLocation(d->object->getAsMemoryLocation(), d->object->isGlobalMemory());
+			else
+				d->target->setCustomMemoryLocation(x86::qword_ptr(PTR_REG_R(d->object)), d->object->isGlobalMemory());
+
+			return Result::ok();
+		});
+
+		toSimdHeadFunction->inliner->returnTypeFunction = [this](InlineData* d)
+		{
+			auto rt = dynamic_cast<ReturnTypeInlineData*>(d);
+
+			auto& handler = rt->object->currentCompiler->namespaceHandler;
+
+			auto float4Type = handler.getAliasType(NamespacedIdentifier("float4"));
+
+			int numSimdElements = getNumElements() / 4;
+
+			if (numSimdElements == 0)
+				return Result::fail("Can't convert to SIMD");
+
+			ComplexType::Ptr simdArrayType = new SpanType(float4Type, numSimdElements);
+			simdArrayType = handler.registerComplexTypeOrReturnExisting(simdArrayType);
+			rt->f.returnType = TypeInfo(simdArrayType, false, true);
+
+			return Result::ok();
+		};
+
+		st->addFunction(toSimdHeadFunction);
+	}
+
+	{
+		// Returns the last N % 4 elements that are not covered by toSimdHead()
+		auto numElements = getNumElements();
+		auto elementSize = (int)getElementSize();
+
+		auto remainderFunction = new FunctionData();
+		remainderFunction->id = st->getClassName().getChildId("toSimdRemainder");
+		remainderFunction->returnType = TypeInfo(Types::ID::Dynamic, false, true);
+		remainderFunction->inliner = Inliner::createAsmInliner(remainderFunction->id, [numElements, elementSize](InlineData* b)
+		{
+			auto d = b->toAsmInlineData();
+
+			auto byteOffset = (numElements / 4) * 4 * elementSize;
+
+			if (d->object->isMemoryLocation())
+				d->target->setCustomMemoryLocation(d->object->getAsMemoryLocation().cloneAdjusted(byteOffset), d->object->isGlobalMemory());
+			else
+				d->target->setCustomMemoryLocation(x86::qword_ptr(PTR_REG_R(d->object), byteOffset), d->object->isGlobalMemory());
+
+			return Result::ok();
+		});
+
+		remainderFunction->inliner->returnTypeFunction = [this](InlineData* d)
+		{
+			auto rt = dynamic_cast<ReturnTypeInlineData*>(d);
+
+			auto& handler = rt->object->currentCompiler->namespaceHandler;
+
+			int numRemainingElements = getNumElements() % 4;
+
+			if (numRemainingElements == 0)
+				return Result::fail("No remaining elements");
+
+			ComplexType::Ptr remainderType = new SpanType(getElementType(), numRemainingElements);
+			remainderType = handler.registerComplexTypeOrReturnExisting(remainderType);
+			rt->f.returnType = TypeInfo(remainderType, false, true);
+
+			return Result::ok();
+		};
+
+		st->addFunction(remainderFunction);
+	}
+
 	return st;
 }
 
@@ -871,6 +958,77 @@ snex::jit::FunctionClass* DynType::getFunctionClass()
 		dynOperators->addFunction(isSimdableFunc);
 	}
 
+	{
+		auto alignedFunc = new FunctionData();
+		alignedFunc->id = dynOperators->getClassName().getChildId("isAlignedTo16Byte");
+		alignedFunc->returnType = TypeInfo(Types::ID::Integer);
+		alignedFunc->inliner = Inliner::createAsmInliner(alignedFunc->id, [](InlineData* b)
+		{
+			auto d = b->toAsmInlineData();
+
+			auto& cc = d->gen.cc;
+
+			d->target->createRegister(cc);
+
+			auto dataReg = cc.newGpq();
+			auto target = INT_REG_W(d->target);
+
+			if (d->object->isMemoryLocation())
+				cc.mov(dataReg, d->object->getAsMemoryLocation().cloneAdjustedAndResized(8, 8));
+			else
+				cc.mov(dataReg, x86::ptr(PTR_REG_R(d->object)).cloneAdjustedAndResized(8, 8));
+
+			cc.xor_(target, target);
+			cc.test(dataReg.r8(), 15);
+			cc.sete(target.r8());
+
+			return Result::ok();
+		});
+
+		dynOperators->addFunction(alignedFunc);
+	}
+
+	if (elementType.getType() == Types::ID::Float)
+	{
+		// Returns a dyn that refers to the last size % 4 elements
+		// that are skipped by toSimd()
+		auto remainderFunction = new FunctionData();
+		remainderFunction->id = dynOperators->getClassName().getChildId("toSimdRemainder");
+		remainderFunction->returnType = TypeInfo(this, false, true);
+		remainderFunction->inliner = Inliner::createAsmInliner(remainderFunction->id, [this](InlineData* b)
+		{
+			auto d = b->toAsmInlineData();
+
+			auto& cc = d->gen.cc;
+
+			auto mem = cc.newStack((uint32_t)getRequiredByteSize(), (uint32_t)getRequiredAlignment());
+
+			auto dataReg = cc.newGpq();
+			auto sizeReg = cc.newGpd();
+			auto offsetReg = cc.newGpd();
+
+			if (d->object->isMemoryLocation())
+				cc.lea(dataReg, d->object->getAsMemoryLocation());
+			else
+				cc.mov(dataReg, PTR_REG_R(d->object));
+
+			cc.mov(sizeReg, x86::ptr(dataReg).cloneAdjustedAndResized(4, 4));
+			cc.mov(dataReg, x86::ptr(dataReg).cloneAdjustedAndResized(8, 8));
+			cc.mov(offsetReg, sizeReg);
+			cc.and_(offsetReg, ~3);
+			cc.and_(sizeReg, 3);
+			cc.lea(dataReg, x86::ptr(dataReg, offsetReg.r64(), 2));
+			cc.mov(mem.cloneAdjustedAndResized(4, 4), sizeReg);
+			cc.mov(mem.cloneAdjustedAndResized(8, 8), dataReg);
+
+			d->target->setCustomMemoryLocation(mem, false);
+
+			return Result::ok();
+		});
+
+		dynOperators->addFunction(remainderFunction);
+	}
+
 	{
 		auto& subscriptFunction = dynOperators->createSpecialFunction(FunctionClass::Subscript);
 		subscriptFunction.returnType = elementType.withModifiers(false, true, false);
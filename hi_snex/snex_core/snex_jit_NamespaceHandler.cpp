@@ -50,11 +50,11 @@ bool NamespaceHandler::Namespace::contains(const NamespacedIdentifier& symbol) c
 	return false;
 }
 
-juce::String NamespaceHandler::Namespace::dump(int level) const
+juce::String NamespaceHandler::Namespace::dump(int level, bool includeInternalSymbols) const
 {
 	juce::String s;
 
-	if (internalSymbol)
+	if (internalSymbol && !includeInternalSymbols)
 		return s;
 
 	auto idName = id.isValid() ? id.toString() : "root";
@@ -70,7 +70,7 @@ juce::String NamespaceHandler::Namespace::dump(int level) const
 
 	for (auto a : aliases)
 	{
-		if (a.internalSymbol)
+		if (a.internalSymbol && !includeInternalSymbols)
 			continue;
 
 		s << getIntendLevel(level);
@@ -79,7 +79,7 @@ juce::String NamespaceHandler::Namespace::dump(int level) const
 
 	for (auto c : childNamespaces)
 	{
-		s << c->dump(level);
+		s << c->dump(level, includeInternalSymbols);
 	};
 
 	return s;
@@ -356,9 +356,9 @@ snex::NamespacedIdentifier NamespaceHandler::getCurrentNamespaceIdentifier() con
 	return currentNamespace->id;
 }
 
-juce::String NamespaceHandler::dump() const
+juce::String NamespaceHandler::dump(bool includeInternalSymbols) const
 {
-	return getRoot()->dump(0);
+	return getRoot()->dump(0, includeInternalSymbols);
 }
 
 juce::Result NamespaceHandler::addUsedNamespace(const NamespacedIdentifier& usedNamespace)
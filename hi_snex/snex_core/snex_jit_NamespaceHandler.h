@@ -124,7 +124,7 @@ private:
 
 		bool contains(const NamespacedIdentifier& symbol) const;
 
-		juce::String dump(int level) const;
+		juce::String dump(int level, bool includeInternalSymbols=false) const;
 
 		static juce::String getIntendLevel(int level);
 
@@ -300,7 +300,7 @@ public:
 	bool isNamespace(const NamespacedIdentifier& possibleNamespace) const;
 	
 	NamespacedIdentifier getCurrentNamespaceIdentifier() const;
-	juce::String dump() const;
+	juce::String dump(bool includeInternalSymbols=false) const;
 	Result addUsedNamespace(const NamespacedIdentifier& usedNamespace);
 	Result resolve(NamespacedIdentifier& id, bool allowZeroMatch = false) const;
 	void addSymbol(const NamespacedIdentifier& id, const TypeInfo& t, SymbolType symbolType, const SymbolDebugInfo& info);
@@ -58,7 +58,7 @@ namespace FactoryIds
 
 	static bool isMulti(const NamespacedIdentifier& id)
 	{
-		return id.toString() == "container::multi";
+		return id.toString() == "container::multi" || id.toString() == "container::parallel_multi";
 	}
 };
 
@@ -1387,10 +1387,15 @@ Node::Ptr ValueTreeBuilder::getTypeDefinition(const NamespacedIdentifier& id)
 	return nullptr;
 }
 
-NamespacedIdentifier ValueTreeBuilder::getNodePath(const ValueTree& n)
+NamespacedIdentifier ValueTreeBuilder::getNodePath(const ValueTree& n) const
 {
-	return ValueTreeIterator::getNodeFactoryPath(n);
-	
+	auto id = ValueTreeIterator::getNodeFactoryPath(n);
+
+	// The JIT compiler has no parallel containers, so we use the serial ones there
+	if (outputFormat == Format::JitCompiledInstance && id.id.toString().startsWith("parallel_"))
+		return id.getParent().getChildId(id.id.toString().fromFirstOccurrenceOf("parallel_", false, false));
+
+	return id;
 }
 
 
@@ -1828,6 +1833,15 @@ snex::NamespacedIdentifier ValueTreeIterator::getNodeFactoryPath(const ValueTree
 		{
 			return NamespacedIdentifier::fromString("container::chain");
 		}
+
+		if (isSplit || isMulti)
+		{
+			auto propTree = n.getChildWithName(PropertyIds::Properties);
+			auto pTree = propTree.getChildWithProperty(PropertyIds::ID, PropertyIds::Parallel.toString());
+
+			if ((bool)pTree[PropertyIds::Value])
+				return NamespacedIdentifier::fromString("container::parallel_" + fId.id.toString());
+		}
 	}
 
 	return NamespacedIdentifier::fromString(s);
@@ -2484,7 +2498,7 @@ Node::List ValueTreeBuilder::RootContainerBuilder::getSendNodes()
 
 	for (auto n : parent.pooledTypeDefinitions)
 	{
-		if (getNodePath(n->nodeTree).toString() == "routing::send")
+		if (parent.getNodePath(n->nodeTree).toString() == "routing::send")
 		{
 			l.add(n);
 		}
@@ -2989,7 +3003,7 @@ Array<float> ValueTreeBuilder::ComplexDataBuilder::getEmbeddedData(const ValueTr
 
 Node::Ptr ValueTreeBuilder::SnexNodeBuilder::parse()
 {
-	p = getNodePath(n->nodeTree);
+	p = parent.getNodePath(n->nodeTree);
 	classId = ValueTreeIterator::getSnexCode(n->nodeTree);
 
 	if (classId.isEmpty())
@@ -3004,7 +3018,7 @@ Node::Ptr ValueTreeBuilder::SnexNodeBuilder::parse()
 	{
 		// You have to set a code provider
 		jassert(parent.codeProvider != nullptr);
-		code = parent.codeProvider->getCode(getNodePath(n->nodeTree), classId);
+		code = parent.codeProvider->getCode(parent.getNodePath(n->nodeTree), classId);
 
 		parent << code;
 		parent.addEmptyLine();
@@ -618,7 +618,7 @@ struct ValueTreeBuilder: public Base
 	ValueTreeBuilder(const ValueTree& data, Format outputFormatToUse) :
 		Base(Base::OutputType::AddTabs),
 		v(data),
-		outputFormat(Format::CppDynamicLibrary),
+		outputFormat(outputFormatToUse),
 		r(Result::ok()),
 		rootChannelAmount(getRootChannelAmount(v)),
 		numChannelsToCompile(rootChannelAmount),
@@ -922,7 +922,7 @@ private:
 
 	Node::Ptr getTypeDefinition(const NamespacedIdentifier& id);
 
-	static NamespacedIdentifier getNodePath(const ValueTree& n);
+	NamespacedIdentifier getNodePath(const ValueTree& n) const;
 
 	PooledParameter::Ptr addParameterAndReturn(PooledParameter::Ptr p)
 	{
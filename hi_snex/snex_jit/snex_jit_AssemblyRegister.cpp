@@ -38,7 +38,7 @@ using namespace juce;
 using namespace asmjit;
 
 // Just for debugging purposes...
-static int reg_counter = 0;
+static std::atomic<int> reg_counter { 0 };
 
 AssemblyRegister::AssemblyRegister(BaseCompiler* compiler_, TypeInfo type_) :
 	type(type_),
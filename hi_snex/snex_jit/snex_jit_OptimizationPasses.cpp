@@ -1570,49 +1570,57 @@ bool LoopVectoriser::convertToSimd(BaseCompiler* c, Operations::Loop* l)
 		if (isUnSimdable)
 			return false;
 
-		if (auto asSpan = dynamic_cast<SpanType*>(at))
-		{
-			bool isNonSimdableSpan = (asSpan->getNumElements() % 4) != 0;
+		auto oldPath = l->getLoopBlock()->getPath();
+		auto oldId = oldPath.getIdentifier();
 
-			if (isNonSimdableSpan)
-				return false;
+		// Don't vectorise the loops that were created by this pass
+		if (oldId == Identifier("Fallback") || oldId == Identifier("Remainder"))
+			return false;
 
-			changeIteratorTargetToSimd(l);
-			
-			return true;
-		}
-		if (auto asDyn = dynamic_cast<DynType*>(at))
+		if (auto asSpan = dynamic_cast<SpanType*>(at))
 		{
-			auto oldPath = l->getLoopBlock()->getPath();
+			auto numElements = asSpan->getNumElements();
 
-			if (oldPath.getIdentifier() == Identifier("Fallback"))
+			if (numElements % 4 == 0)
 			{
-				return false;
+				changeIteratorTargetToSimd(l, "toSimd");
+				return true;
 			}
 
-			NamespacedIdentifier i("isSimdable");
-			auto cond = new Operations::FunctionCall(l->location, nullptr, { i, TypeInfo(Types::ID::Integer) }, {});
-			cond->setObjectExpression(t);
+			if (numElements < 4)
+				return false;
 
-			
+			// Peel off the last N % 4 elements into a scalar loop
+			auto loopParent = Operations::findParentStatementOfType<Operations::ScopeStatementBase>(l);
 
-			auto fallbackPath = oldPath.getChildId("Fallback");
-			auto simdPath = oldPath.getChildId("SimdPath");
+			jassert(loopParent != nullptr);
 
-			auto trueBranch = l->clone(l->location);
+			auto sb = new Operations::StatementBlock(l->location, loopParent->getPath());
+			sb->addStatement(cloneLoop(c, l, "SimdPath", "toSimdHead"));
+			sb->addStatement(cloneLoop(c, l, "Remainder", "toSimdRemainder"));
 
-			auto simdLoop = as<Operations::Loop>(trueBranch);
+			replaceExpression(l, sb);
+			l->parent = nullptr;
+
+			return true;
+		}
+		if (auto asDyn = dynamic_cast<DynType*>(at))
+		{
+			// The alignment can only be checked at runtime, the size
+			// doesn't matter because the remainder is processed by a scalar loop
+			NamespacedIdentifier i("isAlignedTo16Byte");
+			auto cond = new Operations::FunctionCall(l->location, nullptr, { i, TypeInfo(Types::ID::Integer) }, {});
+			cond->setObjectExpression(t);
 
-			simdLoop->iterator.id.relocateSelf(oldPath, simdPath);
-			simdLoop->getLoopBlock()->setNewPath(c, simdPath);
-			changeIteratorTargetToSimd(simdLoop);
+			auto loopParent = Operations::findParentStatementOfType<Operations::ScopeStatementBase>(l);
 
-			auto falseBranch = l->clone(l->location);
+			jassert(loopParent != nullptr);
 
-			auto fallbackLoop = as<Operations::Loop>(falseBranch);
+			auto trueBranch = new Operations::StatementBlock(l->location, loopParent->getPath());
+			trueBranch->addStatement(cloneLoop(c, l, "SimdPath", "toSimd"));
+			trueBranch->addStatement(cloneLoop(c, l, "Remainder", "toSimdRemainder"));
 
-			fallbackLoop->iterator.id.relocateSelf(oldPath, fallbackPath);
-			fallbackLoop->getLoopBlock()->setNewPath(c, fallbackPath);
+			auto falseBranch = cloneLoop(c, l, "Fallback", {});
 
 			auto ifs = new Operations::IfStatement(l->location, cond, trueBranch, falseBranch);
 
@@ -1626,11 +1634,28 @@ bool LoopVectoriser::convertToSimd(BaseCompiler* c, Operations::Loop* l)
 	return false;
 }
 
-juce::Result LoopVectoriser::changeIteratorTargetToSimd(Operations::Loop* l)
+snex::jit::Operations::Statement::Ptr LoopVectoriser::cloneLoop(BaseCompiler* c, Operations::Loop* l, const Identifier& pathId, const Identifier& targetFunction)
+{
+	auto oldPath = l->getLoopBlock()->getPath();
+	auto newPath = oldPath.getChildId(pathId);
+
+	auto newStatement = l->clone(l->location);
+	auto newLoop = as<Operations::Loop>(newStatement);
+
+	newLoop->iterator.id.relocateSelf(oldPath, newPath);
+	newLoop->getLoopBlock()->setNewPath(c, newPath);
+
+	if (targetFunction.isValid())
+		changeIteratorTargetToSimd(newLoop, targetFunction);
+
+	return newStatement;
+}
+
+juce::Result LoopVectoriser::changeIteratorTargetToSimd(Operations::Loop* l, const Identifier& targetFunction)
 {
 	auto t = l->getTarget();
 
-	auto newCall = new Operations::FunctionCall(t->location, nullptr, { NamespacedIdentifier("toSimd"), TypeInfo(Types::ID::Dynamic) }, {});
+	auto newCall = new Operations::FunctionCall(t->location, nullptr, { NamespacedIdentifier(targetFunction), TypeInfo(Types::ID::Dynamic) }, {});
 
 	newCall->setObjectExpression(t->clone(t->location));
 	replaceExpression(t, newCall);
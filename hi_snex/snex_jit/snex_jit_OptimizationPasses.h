@@ -292,6 +292,11 @@ private:
 	
 };
 
+/** Converts loops over float spans and dyn<float> containers into float4 loops.
+
+	Spans with a size that is not a multiple of 4 are split into a SIMD loop and
+	a scalar loop for the remainder, dyn<float> loops check the alignment at runtime.
+*/
 class LoopVectoriser : public OptimizationPass
 {
 	using Ptr = Operations::Statement::Ptr;
@@ -306,7 +311,11 @@ private:
 
 	bool convertToSimd(BaseCompiler* c, Operations::Loop* l);
 
-	Result changeIteratorTargetToSimd(Operations::Loop* l);
+	/** Creates a copy of the loop with a new scope path and replaces the
+	    iteration target with the given function call (if valid). */
+	Ptr cloneLoop(BaseCompiler* c, Operations::Loop* l, const Identifier& pathId, const Identifier& targetFunction);
+
+	Result changeIteratorTargetToSimd(Operations::Loop* l, const Identifier& targetFunction);
 
 	static bool isUnSimdableOperation(Ptr s);
 };
@@ -38,7 +38,7 @@ using namespace asmjit;
 
 
 
-int Compiler::compileCount = 0;
+std::atomic<int> Compiler::compileCount { 0 };
 
  void Compiler::reset()
  {
@@ -90,6 +90,11 @@ juce::String Compiler::dumpNamespaceTree() const
 	return compiler->namespaceHandler.dump();
 }
 
+juce::String Compiler::getRegisteredSymbols() const
+{
+	return compiler->namespaceHandler.dump(true);
+}
+
 ComplexType::Ptr Compiler::registerExternalComplexType(ComplexType::Ptr t)
 {
 	if (auto st = dynamic_cast<StructType*>(t.get()))
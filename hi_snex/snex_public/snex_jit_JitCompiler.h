@@ -119,6 +119,9 @@ public:
 	juce::String getAssemblyCode();
 	juce::String dumpSyntaxTree() const;
 	juce::String dumpNamespaceTree() const;
+
+	/** Returns a string that contains every symbol that was registered to this compiler (including the internal ones). */
+	juce::String getRegisteredSymbols() const;
 	juce::String getLastCompiledCode() { return lastCode; }
 
 	/** This registers an external object as complex type.
@@ -137,7 +140,7 @@ public:
 	FunctionClass::Ptr getInbuiltFunctionClass();
 	void initInbuildFunctions();
 
-	static int compileCount;
+	static std::atomic<int> compileCount;
 
 	void reset();
 
@@ -475,6 +475,67 @@ public:
 
 
 
+class ValueTreeBuilderFormatTest : public UnitTest
+{
+public:
+
+	ValueTreeBuilderFormatTest() : UnitTest("Testing the ValueTreeBuilder output formats", "snex") {}
+
+	using Format = cppgen::ValueTreeBuilder::Format;
+
+	static ValueTree createNetworkTree()
+	{
+		String xml;
+
+		xml << "<Network ID=\"format_test\">";
+		xml << "<Node FactoryPath=\"container.chain\" ID=\"format_test\" Bypassed=\"0\" NumChannels=\"2\">";
+		xml << "<Properties/><Nodes>";
+		xml << "<Node ID=\"mul\" FactoryPath=\"math.mul\" Bypassed=\"0\" NumChannels=\"2\"><Properties/><Parameters>";
+		xml << "<Parameter MinValue=\"0\" MaxValue=\"1\" StepSize=\"0.01\" SkewFactor=\"1\" ID=\"Value\" Value=\"0.5\"/>";
+		xml << "</Parameters></Node>";
+		xml << "</Nodes><Parameters/></Node></Network>";
+
+		return ValueTree::fromXml(xml);
+	}
+
+	String createCode(const ValueTree& network, Format f)
+	{
+		cppgen::ValueTreeBuilder vb(network.getChild(0), f);
+		auto br = vb.createCppCode();
+		expect(br.r.wasOk(), br.r.getErrorMessage());
+		return br.code;
+	}
+
+	void runTest() override
+	{
+		beginTest("Testing the ValueTreeBuilder output formats");
+
+		auto network = createNetworkTree();
+		expect(network.isValid(), "network parsed");
+
+		auto jitCode = createCode(network, Format::JitCompiledInstance);
+
+		expect(jitCode.contains("/* Autogenerated code */"), "JIT: header");
+		expect(jitCode.contains("namespace impl"), "JIT: namespace");
+		expect(!jitCode.contains("#pragma once"), "JIT: no DLL glue code");
+		expect(!jitCode.contains("JuceHeader.h"), "JIT: no include");
+
+		auto dllCode = createCode(network, Format::CppDynamicLibrary);
+
+		expect(dllCode.contains("#pragma once"), "DLL: glue code");
+		expect(dllCode.contains("JuceHeader.h"), "DLL: include");
+		expect(dllCode.contains("namespace project"), "DLL: public definition");
+
+		auto testCode = createCode(network, Format::TestCaseFile);
+
+		expect(testCode.contains("BEGIN_TEST_DATA"), "Test case: header");
+		expect(testCode.contains("processor") && testCode.contains("wrap::node"), "Test case: public definition");
+		expect(!testCode.contains("#pragma once"), "Test case: no DLL glue code");
+	}
+};
+
+static ValueTreeBuilderFormatTest valueTreeBuilderFormatTest;
+
 class HiseJITUnitTest : public UnitTest
 {
 public:
@@ -3508,6 +3569,256 @@ private:
 
 static HiseJITUnitTest njut;
 
+class SnexCompilationCacheTest : public UnitTest
+{
+public:
+
+	SnexCompilationCacheTest() : UnitTest("Testing SNEX compilation cache") {}
+
+	struct TestCompileHandler : public ui::WorkbenchData::CompileHandler
+	{
+		TestCompileHandler(ui::WorkbenchData* d) :
+			CompileHandler(d)
+		{}
+
+		void processTestParameterEvent(int, double) override {}
+		Result prepareTest(PrepareSpecs, const Array<ParameterEvent>&) override { return Result::ok(); }
+		void processTest(ProcessDataDyn&) override {}
+	};
+
+	struct CustomTypeCompileHandler : public TestCompileHandler
+	{
+		CustomTypeCompileHandler(ui::WorkbenchData* d) :
+			TestCompileHandler(d)
+		{}
+
+		Compiler::Ptr createCompiler() override
+		{
+			auto cc = TestCompileHandler::createCompiler();
+			cc->registerExternalComplexType(new StructType(NamespacedIdentifier("CustomType")));
+			return cc;
+		}
+	};
+
+	using Statistics = ui::WorkbenchData::CompilationCache::Statistics;
+
+	void runTest() override
+	{
+		ui::WorkbenchData::Ptr wb = new ui::WorkbenchData();
+
+		Value codeValue;
+		ui::WorkbenchData::ValueBasedCodeProvider provider(wb.get(), codeValue, "test");
+
+		wb->setCodeProvider(&provider);
+		wb->setCompileHandler(new TestCompileHandler(wb.get()));
+
+		auto& cache = wb->getCompilationCache();
+
+		beginTest("Reusing the result for the same code");
+
+		expectResult(wb, getCode(1), 1);
+		expectStatistics(cache.getStatistics(), 0, 1, 0);
+
+		expectResult(wb, getCode(1), 1);
+		expectStatistics(cache.getStatistics(), 1, 1, 0);
+
+		beginTest("Recompiling after the settings changed");
+
+		wb->setDebugMode(true, dontSendNotification);
+		expectResult(wb, getCode(1), 1);
+		expectStatistics(cache.getStatistics(), 1, 2, 0);
+
+		wb->setDebugMode(false, dontSendNotification);
+		expectResult(wb, getCode(1), 1);
+		expectStatistics(cache.getStatistics(), 2, 2, 0);
+
+		beginTest("Recompiling with another compiler configuration");
+
+		wb->setCompileHandler(new CustomTypeCompileHandler(wb.get()));
+		expectResult(wb, getCode(1), 1);
+		expectStatistics(cache.getStatistics(), 2, 3, 0);
+
+		expectResult(wb, getCode(1), 1);
+		expectStatistics(cache.getStatistics(), 3, 3, 0);
+
+		wb->setCompileHandler(new TestCompileHandler(wb.get()));
+		expectResult(wb, getCode(1), 1);
+		expectStatistics(cache.getStatistics(), 4, 3, 0);
+
+		beginTest("Invalidating the code");
+
+		cache.invalidate(getCode(1));
+		expectResult(wb, getCode(1), 1);
+		expectStatistics(cache.getStatistics(), 4, 4, 0);
+
+		beginTest("Failed compilations are not cached");
+
+		auto r1 = wb->getCompileHandler()->compile("int getValue() { return x; }");
+		auto r2 = wb->getCompileHandler()->compile("int getValue() { return x; }");
+		expect(!r1.compiledOk() && !r2.compiledOk(), "compiled invalid code");
+		expectStatistics(cache.getStatistics(), 4, 6, 0);
+
+		beginTest("Evicting the least recently used result");
+
+		cache.clear();
+
+		for (int i = 0; i < ui::WorkbenchData::CompilationCache::MaxNumEntries + 1; i++)
+			expectResult(wb, getCode(100 + i), 100 + i);
+
+		expectStatistics(cache.getStatistics(), 4, 7 + ui::WorkbenchData::CompilationCache::MaxNumEntries, 1);
+
+		// the most recent result is still there, the first one was evicted
+		expectResult(wb, getCode(100 + ui::WorkbenchData::CompilationCache::MaxNumEntries), 100 + ui::WorkbenchData::CompilationCache::MaxNumEntries);
+		expectResult(wb, getCode(100), 100);
+		expectStatistics(cache.getStatistics(), 5, 8 + ui::WorkbenchData::CompilationCache::MaxNumEntries, 2);
+
+		beginTest("Disabling the cache");
+
+		cache.setEnabled(false);
+		auto before = cache.getStatistics();
+		expectResult(wb, getCode(100), 100);
+		expectEquals(cache.getStatistics().numHits, before.numHits, "hit with disabled cache");
+
+		wb = nullptr;
+	}
+
+	static String getCode(int value)
+	{
+		return "int getValue() { return " + String(value) + "; }";
+	}
+
+	void expectResult(ui::WorkbenchData::Ptr wb, const String& code, int expectedValue)
+	{
+		auto r = wb->getCompileHandler()->compile(code);
+
+		expect(r.compiledOk(), r.compileResult.getErrorMessage());
+
+		if (r.compiledOk())
+			expectEquals(r.obj["getValue"].call<int>(), expectedValue, "wrong result");
+	}
+
+	void expectStatistics(const Statistics& s, int numHits, int numMisses, int numEvictions)
+	{
+		expectEquals(s.numHits, numHits, "hits");
+		expectEquals(s.numMisses, numMisses, "misses");
+		expectEquals(s.numEvictions, numEvictions, "evictions");
+	}
+};
+
+static SnexCompilationCacheTest snexCompilationCacheTest;
+
+/** Compiles multiple workbenches at the same time like the DspNetwork does when it loads its SNEX nodes. */
+class SnexParallelCompilationTest : public UnitTest
+{
+public:
+
+	SnexParallelCompilationTest() : UnitTest("Testing parallel SNEX compilation") {}
+
+	static constexpr int NumWorkbenches = 8;
+
+	struct CompileThread : public Thread
+	{
+		CompileThread(int index_) :
+			Thread("SNEX Test Compile Thread"),
+			index(index_)
+		{
+			wb = new ui::WorkbenchData();
+			provider = new ui::WorkbenchData::ValueBasedCodeProvider(wb.get(), codeValue, "test");
+
+			wb->setCodeProvider(provider);
+			wb->setCompileHandler(new SnexCompilationCacheTest::TestCompileHandler(wb.get()));
+		}
+
+		void run() override
+		{
+			auto start = Time::getMillisecondCounterHiRes();
+			result = wb->getCompileHandler()->compile(getCode(index));
+			milliSeconds = Time::getMillisecondCounterHiRes() - start;
+		}
+
+		const int index;
+		double milliSeconds = 0.0;
+
+		Value codeValue;
+		ScopedPointer<ui::WorkbenchData::CodeProvider> provider;
+		ui::WorkbenchData::Ptr wb;
+		ui::WorkbenchData::CompileResult result;
+	};
+
+	void runTest() override
+	{
+		auto numInstancesBefore = ComplexType::numInstances.load();
+		auto compileCountBefore = Compiler::compileCount.load();
+
+		beginTest("Compiling workbenches serially");
+
+		auto serialMs = 0.0;
+
+		{
+			OwnedArray<CompileThread> threads;
+
+			for (int i = 0; i < NumWorkbenches; i++)
+				threads.add(new CompileThread(i));
+
+			for (auto t : threads)
+			{
+				t->run();
+				serialMs += t->milliSeconds;
+			}
+
+			expectResults(threads);
+		}
+
+		beginTest("Compiling workbenches in parallel");
+
+		auto parallelMs = 0.0;
+
+		{
+			OwnedArray<CompileThread> threads;
+
+			for (int i = 0; i < NumWorkbenches; i++)
+				threads.add(new CompileThread(i));
+
+			auto start = Time::getMillisecondCounterHiRes();
+
+			for (auto t : threads)
+				t->startThread();
+
+			for (auto t : threads)
+				t->waitForThreadToExit(-1);
+
+			parallelMs = Time::getMillisecondCounterHiRes() - start;
+
+			expectResults(threads);
+		}
+
+		expectEquals(Compiler::compileCount.load() - compileCountBefore, 2 * NumWorkbenches, "compile count");
+		expectEquals(ComplexType::numInstances.load(), numInstancesBefore, "leaked complex types");
+
+		String s;
+		s << String(NumWorkbenches) << " workbenches: serial " << String(serialMs, 1) << "ms, parallel " << String(parallelMs, 1) << "ms";
+		logMessage(s);
+	}
+
+	static String getCode(int value)
+	{
+		return "struct X { int value = " + String(value) + "; int get() { return value; } }; X x; int getValue() { return x.get(); }";
+	}
+
+	void expectResults(OwnedArray<CompileThread>& threads)
+	{
+		for (auto t : threads)
+		{
+			expect(t->result.compiledOk(), t->result.compileResult.getErrorMessage());
+
+			if (t->result.compiledOk())
+				expectEquals(t->result.obj["getValue"].call<int>(), t->index, "wrong result");
+		}
+	}
+};
+
+static SnexParallelCompilationTest snexParallelCompilationTest;
+
 
 #undef CREATE_TEST
 #undef CREATE_TEST_SETUP
@@ -88,6 +88,16 @@ Set this to true if you add this module to your existing C++ project and don't e
 #endif
 
 
+/** Config: HISE_NUM_STREAMING_THREADS
+
+The number of threads that fill the streaming buffers of the sampler voices. The first thread is the sample loading
+thread which also performs the preloading, every additional thread will only execute streaming jobs.
+*/
+#ifndef HISE_NUM_STREAMING_THREADS
+#define HISE_NUM_STREAMING_THREADS 2
+#endif
+
+
 #include "hi_streaming/lockfree_fifo/readerwriterqueue.h"
 #include "hi_streaming/lockfree_fifo/concurrentqueue.h"
 
@@ -95,6 +105,7 @@ Set this to true if you add this module to your existing C++ project and don't e
 #include "hi_streaming/MonolithAudioFormat.h"
 #include "hi_streaming/StreamingSampler.h"
 #include "hi_streaming/StreamingSamplerSound.h"
+#include "hi_streaming/ResamplingKernels.h"
 #include "hi_streaming/StreamingSamplerVoice.h"
 
 
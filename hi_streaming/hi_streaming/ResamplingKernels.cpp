@@ -0,0 +1,418 @@
+/*  ===========================================================================
+*
+*   This file is part of HISE.
+*   Copyright 2016 Christoph Hart
+*
+*   HISE is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   HISE is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Commercial licenses for using HISE in an closed source project are
+*   available on request. Please visit the project's website to get more
+*   information about commercial licensing:
+*
+*   http://www.hise.audio/
+*
+*   HISE is based on the JUCE library,
+*   which must be separately licensed for closed source applications:
+*
+*   http://www.juce.com
+*
+*   ===========================================================================
+*/
+
+namespace hise { using namespace juce;
+
+namespace ResamplingHelpers
+{
+
+template <typename SignalType> constexpr float getGainFactor()
+{
+	return std::is_same<SignalType, float>::value ? 1.0f : (1.0f / (float)INT16_MAX);
+}
+
+template <typename T> static forcedinline T hermite(T xm1, T x0, T x1, T x2, T alpha)
+{
+	const T c1 = (x1 - xm1) * 0.5f;
+	const T c2 = xm1 - x0 * 2.5f + x1 * 2.0f - x2 * 0.5f;
+	const T c3 = (x2 - xm1) * 0.5f + (x0 - x1) * 1.5f;
+
+	return ((c3 * alpha + c2) * alpha + c1) * alpha + x0;
+}
+
+template <SampleInterpolationMode Mode, typename SignalType> static forcedinline float interpolate(const SignalType* in, int pos, float alpha, float previous)
+{
+	if (Mode == SampleInterpolationMode::Linear)
+	{
+		const float invAlpha = 1.0f - alpha;
+		return ((float)in[pos] * invAlpha + (float)in[pos + 1] * alpha);
+	}
+	else
+	{
+		const float xm1 = pos > 0 ? (float)in[pos - 1] : previous;
+		return hermite<float>(xm1, (float)in[pos], (float)in[pos + 1], (float)in[pos + 2], alpha);
+	}
+}
+
+/** The setup that is shared between the scalar and the SIMD kernel. */
+template <typename SignalType, int NumChannels, SampleInterpolationMode Mode> struct Setup
+{
+	Setup(const ResamplingKernels::Data& d_) :
+		d(d_)
+	{
+		for (int c = 0; c < NumChannels; c++)
+		{
+			in[c] = static_cast<const SignalType*>(d.input[c]);
+			previous[c] = d.hasPreviousFrame ? d.previousFrame[c] : (float)in[c][0];
+		}
+
+		// The Hermite interpolation reads one sample more than the linear interpolation
+		constexpr int extraLookahead = ResamplingKernels::getNumLookaheadSamples(Mode) - 1;
+
+		maxIndex = d.maxIndexInBuffer - extraLookahead;
+		numSamples = d.numSamples;
+
+		if (d.pitchData == nullptr && d.maxIndexInBuffer != std::numeric_limits<int>::max() && d.uptimeDelta > 0.0)
+		{
+			auto numTargetSamples = (double)maxIndex - d.indexInBuffer;
+
+			jassert(numTargetSamples > 0.0);
+
+			numSamples = jmin(numSamples, (int)(numTargetSamples / d.uptimeDelta));
+		}
+
+		index = (float)d.indexInBuffer;
+		delta = (float)d.uptimeDelta;
+	}
+
+	/** Calculates a single sample for each channel and returns false if the end of the buffer is reached. */
+	forcedinline bool processSingle(int i)
+	{
+		const int pos = (int)index;
+
+		if (d.pitchData != nullptr && pos >= maxIndex)
+			return false;
+
+		const float alpha = index - (float)pos;
+
+		for (int c = 0; c < NumChannels; c++)
+			d.output[c][i] = interpolate<Mode>(in[c], pos, alpha, previous[c]) * getGainFactor<SignalType>();
+
+		jassert(d.pitchData == nullptr || d.pitchData[i] <= (float)MAX_SAMPLER_PITCH);
+
+		index += d.pitchData != nullptr ? d.pitchData[i] : delta;
+		return true;
+	}
+
+	const ResamplingKernels::Data& d;
+	const SignalType* in[2];
+	float previous[2];
+
+	int maxIndex;
+	int numSamples;
+	float index;
+	float delta;
+};
+
+template <typename SignalType, int NumChannels, SampleInterpolationMode Mode> static int processScalar(const ResamplingKernels::Data& d)
+{
+	Setup<SignalType, NumChannels, Mode> s(d);
+
+	for (int i = 0; i < s.numSamples; i++)
+	{
+		if (!s.processSingle(i))
+			return i;
+	}
+
+	return s.numSamples;
+}
+
+/** Applies the interpolation to the gathered taps with vector operations.
+*
+*	The taps are written to the arrays for a whole chunk before they are loaded into the registers, so the
+*	loads don't stall on the store forwarding of the scalar gather loop.
+*/
+template <SampleInterpolationMode Mode, int ChunkSize> static forcedinline void interpolateChunk(float (&taps)[4][ChunkSize], const float* alphas, float* dst, int numSamples, float gainFactor)
+{
+	using SSEType = dsp::SIMDRegister<float>;
+	constexpr int NumElements = (int)SSEType::SIMDNumElements;
+
+	const auto gain = SSEType::expand(gainFactor);
+	const bool aligned = SSEType::isSIMDAligned(dst);
+
+	int j = 0;
+
+	for (; j + NumElements <= numSamples; j += NumElements)
+	{
+		const auto alpha = SSEType::fromRawArray(alphas + j);
+		SSEType y;
+
+		if (Mode == SampleInterpolationMode::Linear)
+		{
+			const auto x0 = SSEType::fromRawArray(taps[0] + j);
+			const auto x1 = SSEType::fromRawArray(taps[1] + j);
+
+			y = x0 + (x1 - x0) * alpha;
+		}
+		else
+		{
+			y = hermite<SSEType>(SSEType::fromRawArray(taps[0] + j),
+								 SSEType::fromRawArray(taps[1] + j),
+								 SSEType::fromRawArray(taps[2] + j),
+								 SSEType::fromRawArray(taps[3] + j),
+								 alpha);
+		}
+
+		y = y * gain;
+
+		if (aligned)
+			y.copyToRawArray(dst + j);
+		else
+		{
+			alignas(SSEType::SIMDRegisterSize) float result[NumElements];
+			y.copyToRawArray(result);
+			memcpy(dst + j, result, sizeof(float) * NumElements);
+		}
+	}
+
+	for (; j < numSamples; j++)
+	{
+		if (Mode == SampleInterpolationMode::Linear)
+			dst[j] = (taps[0][j] + (taps[1][j] - taps[0][j]) * alphas[j]) * gainFactor;
+		else
+			dst[j] = hermite<float>(taps[0][j], taps[1][j], taps[2][j], taps[3][j], alphas[j]) * gainFactor;
+	}
+}
+
+template <typename SignalType, int NumChannels, SampleInterpolationMode Mode> static int processSIMD(const ResamplingKernels::Data& d)
+{
+	using SSEType = dsp::SIMDRegister<float>;
+
+	constexpr int ChunkSize = 64;
+	constexpr size_t Alignment = SSEType::SIMDRegisterSize;
+
+	Setup<SignalType, NumChannels, Mode> s(d);
+
+	alignas(Alignment) float alphas[ChunkSize];
+	alignas(Alignment) float taps[NumChannels][4][ChunkSize];
+
+	int i = 0;
+
+	while (i < s.numSamples)
+	{
+		const int numThisTime = jmin(ChunkSize, s.numSamples - i);
+		int numValid = numThisTime;
+
+		// The positions are accumulated like in the scalar loop to get the same read positions.
+		for (int j = 0; j < numThisTime; j++)
+		{
+			const int pos = (int)s.index;
+
+			if (d.pitchData != nullptr && pos >= s.maxIndex)
+			{
+				numValid = j;
+				break;
+			}
+
+			alphas[j] = s.index - (float)pos;
+			s.index += d.pitchData != nullptr ? d.pitchData[i + j] : s.delta;
+
+			for (int c = 0; c < NumChannels; c++)
+			{
+				const SignalType* in = s.in[c];
+
+				if (Mode == SampleInterpolationMode::Linear)
+				{
+					taps[c][0][j] = (float)in[pos];
+					taps[c][1][j] = (float)in[pos + 1];
+				}
+				else
+				{
+					taps[c][0][j] = pos > 0 ? (float)in[pos - 1] : s.previous[c];
+					taps[c][1][j] = (float)in[pos];
+					taps[c][2][j] = (float)in[pos + 1];
+					taps[c][3][j] = (float)in[pos + 2];
+				}
+			}
+		}
+
+		for (int c = 0; c < NumChannels; c++)
+			interpolateChunk<Mode>(taps[c], alphas, d.output[c] + i, numValid, getGainFactor<SignalType>());
+
+		i += numValid;
+
+		if (numValid != numThisTime)
+			break;
+	}
+
+	return i;
+}
+
+} // namespace ResamplingHelpers
+
+template <typename SignalType, int NumChannels> int ResamplingKernels::process(SampleInterpolationMode mode, const Data& d)
+{
+	using namespace ResamplingHelpers;
+
+	if (mode == SampleInterpolationMode::Hermite)
+		return processSIMD<SignalType, NumChannels, SampleInterpolationMode::Hermite>(d);
+
+	// The linear interpolation of float data is bound by the gather loads, so the
+	// vector version can't beat the scalar loop here.
+	if (std::is_same<SignalType, float>::value)
+		return ResamplingHelpers::processScalar<SignalType, NumChannels, SampleInterpolationMode::Linear>(d);
+
+	return processSIMD<SignalType, NumChannels, SampleInterpolationMode::Linear>(d);
+}
+
+template <typename SignalType, int NumChannels> int ResamplingKernels::processScalar(SampleInterpolationMode mode, const Data& d)
+{
+	using namespace ResamplingHelpers;
+
+	if (mode == SampleInterpolationMode::Hermite)
+		return ResamplingHelpers::processScalar<SignalType, NumChannels, SampleInterpolationMode::Hermite>(d);
+	else
+		return ResamplingHelpers::processScalar<SignalType, NumChannels, SampleInterpolationMode::Linear>(d);
+}
+
+template int ResamplingKernels::process<float, 1>(SampleInterpolationMode, const Data&);
+template int ResamplingKernels::process<float, 2>(SampleInterpolationMode, const Data&);
+template int ResamplingKernels::process<int16, 1>(SampleInterpolationMode, const Data&);
+template int ResamplingKernels::process<int16, 2>(SampleInterpolationMode, const Data&);
+
+template int ResamplingKernels::processScalar<float, 1>(SampleInterpolationMode, const Data&);
+template int ResamplingKernels::processScalar<float, 2>(SampleInterpolationMode, const Data&);
+template int ResamplingKernels::processScalar<int16, 1>(SampleInterpolationMode, const Data&);
+template int ResamplingKernels::processScalar<int16, 2>(SampleInterpolationMode, const Data&);
+
+#if HI_RUN_UNIT_TESTS
+
+class ResamplingKernelBenchmark : public UnitTest
+{
+public:
+
+	ResamplingKernelBenchmark() :
+		UnitTest("Resampling kernel benchmark", "benchmark")
+	{}
+
+	void runTest() override
+	{
+		for (int m = 0; m < (int)SampleInterpolationMode::numInterpolationModes; m++)
+		{
+			auto mode = (SampleInterpolationMode)m;
+
+			testKernel<float>(mode, false);
+			testKernel<float>(mode, true);
+			testKernel<int16>(mode, false);
+			testKernel<int16>(mode, true);
+		}
+	}
+
+private:
+
+	static constexpr int NumVoices = 256;
+	static constexpr int BlockSize = 512;
+	static constexpr int NumRepetitions = 50;
+
+	template <typename SignalType> void testKernel(SampleInterpolationMode mode, bool usePitchData)
+	{
+		String name;
+		name << (mode == SampleInterpolationMode::Linear ? "Linear" : "Hermite");
+		name << (std::is_same<SignalType, float>::value ? ", float" : ", int16");
+		name << (usePitchData ? ", pitch modulation" : ", constant pitch");
+
+		beginTest(name);
+
+		Random r;
+
+		const int numInputSamples = BlockSize * MAX_SAMPLER_PITCH + 16;
+
+		HeapBlock<SignalType> input[2];
+		HeapBlock<float> pitch, outputScalar[2], outputSIMD[2];
+
+		pitch.calloc(BlockSize);
+
+		for (int c = 0; c < 2; c++)
+		{
+			input[c].calloc(numInputSamples);
+			outputScalar[c].calloc(BlockSize);
+			outputSIMD[c].calloc(BlockSize);
+
+			for (int i = 0; i < numInputSamples; i++)
+			{
+				const float v = r.nextFloat() * 2.0f - 1.0f;
+				input[c][i] = std::is_same<SignalType, float>::value ? (SignalType)v : (SignalType)(v * (float)INT16_MAX);
+			}
+		}
+
+		for (int i = 0; i < BlockSize; i++)
+			pitch[i] = 0.5f + 1.2f * (float)i / (float)BlockSize;
+
+		ResamplingKernels::Data d;
+		d.input[0] = input[0].get();
+		d.input[1] = input[1].get();
+		d.pitchData = usePitchData ? pitch.get() : nullptr;
+		d.indexInBuffer = 0.3;
+		d.uptimeDelta = 1.37;
+		d.numSamples = BlockSize;
+		d.maxIndexInBuffer = numInputSamples - 2;
+
+		d.output[0] = outputScalar[0].get();
+		d.output[1] = outputScalar[1].get();
+
+		auto numScalar = ResamplingKernels::processScalar<SignalType, 2>(mode, d);
+		const double scalarTime = measure([&]() { ResamplingKernels::processScalar<SignalType, 2>(mode, d); });
+
+		d.output[0] = outputSIMD[0].get();
+		d.output[1] = outputSIMD[1].get();
+
+		auto numSIMD = ResamplingKernels::process<SignalType, 2>(mode, d);
+		const double simdTime = measure([&]() { ResamplingKernels::process<SignalType, 2>(mode, d); });
+
+		expectEquals(numSIMD, numScalar, "Sample amount mismatch");
+
+		float maxError = 0.0f;
+
+		for (int c = 0; c < 2; c++)
+		{
+			for (int i = 0; i < numScalar; i++)
+				maxError = jmax(maxError, std::abs(outputScalar[c][i] - outputSIMD[c][i]));
+		}
+
+		expect(maxError < 1e-4f, "SIMD output deviates from scalar output: " + String(maxError));
+
+		String message;
+		message << name << ": scalar " << String(scalarTime, 3) << " ms, SIMD " << String(simdTime, 3) << " ms";
+		message << " (" << String(scalarTime / jmax(0.0001, simdTime), 2) << "x) for " << String(NumVoices) << " voices";
+		logMessage(message);
+	}
+
+	/** Returns the average time in milliseconds that it takes to render one block for all voices. */
+	template <typename F> static double measure(const F& f)
+	{
+		auto start = Time::getMillisecondCounterHiRes();
+
+		for (int i = 0; i < NumRepetitions; i++)
+		{
+			for (int v = 0; v < NumVoices; v++)
+				f();
+		}
+
+		return (Time::getMillisecondCounterHiRes() - start) / (double)NumRepetitions;
+	}
+};
+
+static ResamplingKernelBenchmark resamplingKernelBenchmark;
+
+#endif
+
+} // namespace hise
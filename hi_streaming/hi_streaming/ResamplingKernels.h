@@ -0,0 +1,96 @@
+/*  ===========================================================================
+*
+*   This file is part of HISE.
+*   Copyright 2016 Christoph Hart
+*
+*   HISE is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   HISE is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Commercial licenses for using HISE in an closed source project are
+*   available on request. Please visit the project's website to get more
+*   information about commercial licensing:
+*
+*   http://www.hise.audio/
+*
+*   HISE is based on the JUCE library,
+*   which must be separately licensed for closed source applications:
+*
+*   http://www.juce.com
+*
+*   ===========================================================================
+*/
+
+#ifndef RESAMPLINGKERNELS_H_INCLUDED
+#define RESAMPLINGKERNELS_H_INCLUDED
+
+namespace hise { using namespace juce;
+
+/** The interpolation algorithm that is used by the StreamingSamplerVoice to resample the sample data. */
+enum class SampleInterpolationMode
+{
+	Linear = 0, ///< linear interpolation between two samples (the default)
+	Hermite, ///< 4-point, 3rd order Hermite interpolation (less high frequency loss when pitched)
+	numInterpolationModes
+};
+
+/** The resampling kernels for the StreamingSamplerVoice.
+*
+*	The kernels calculate SIMDRegister<float>::size() output samples at once (4 with SSE / NEON, 8 when compiled with AVX2).
+*	The source frames are gathered (and converted from int16 if necessary) into aligned arrays in chunks of 64 samples, then
+*	the interpolation and the gain are applied with vector operations. The read positions are accumulated exactly like in
+*	the scalar loops, so the output only differs in the rounding of the interpolation.
+*
+*	The linear interpolation of float data uses the scalar loop because it's entirely bound by the gather loads.
+*/
+struct ResamplingKernels
+{
+	/** The data for a single resampling operation. */
+	struct Data
+	{
+		/** The source channels (either float or int16, the second one is ignored for mono). */
+		const void* input[2] = { nullptr, nullptr };
+
+		/** The output channels (already offset to the start sample). */
+		float* output[2] = { nullptr, nullptr };
+
+		/** If not nullptr, this contains the pitch ratio for each output sample (already offset to the start sample). */
+		const float* pitchData = nullptr;
+
+		double indexInBuffer = 0.0;
+		double uptimeDelta = 1.0;
+		int numSamples = 0;
+
+		/** The first index that must not be read by the interpolation. */
+		int maxIndexInBuffer = std::numeric_limits<int>::max();
+
+		/** The source frame before the index 0 (the Hermite interpolation needs one sample of history). */
+		float previousFrame[2] = { 0.0f, 0.0f };
+		bool hasPreviousFrame = false;
+	};
+
+	/** Resamples the data with the SIMD kernel and returns the number of samples that were written. */
+	template <typename SignalType, int NumChannels> static int process(SampleInterpolationMode mode, const Data& d);
+
+	/** Resamples the data one sample at a time (this is the reference implementation for the SIMD kernels). */
+	template <typename SignalType, int NumChannels> static int processScalar(SampleInterpolationMode mode, const Data& d);
+
+	/** Returns the number of source samples after the read position that the interpolation needs. */
+	static constexpr int getNumLookaheadSamples(SampleInterpolationMode mode)
+	{
+		return mode == SampleInterpolationMode::Hermite ? 2 : 1;
+	}
+};
+
+} // namespace hise
+
+#endif  // RESAMPLINGKERNELS_H_INCLUDED
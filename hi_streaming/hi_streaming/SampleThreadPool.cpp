@@ -35,60 +35,244 @@ namespace hise { using namespace juce;
 
 struct SampleThreadPool::Pimpl
 {
-	Pimpl() :
-		jobQueue(8192),
-		currentlyExecutedJob(nullptr),
-		diskUsage(0.0)
-	{};
+	struct Worker
+	{
+		std::atomic<Job*> currentlyExecutedJob = { nullptr };
+		std::atomic<double> diskUsage = { 0.0 };
+		std::atomic<int64> numJobsExecuted = { 0 };
+		std::atomic<int64> numMissedDeadlines = { 0 };
+		std::atomic<bool> sleeping = { false };
+		int64 endTime = 0;
+	};
+
+	/** A producer token of the job queue that belongs to the first thread that adds a job with it.
+	
+		The tokens are created with the pool, so adding a job doesn't allocate (the queue would create an
+		implicit producer the first time a thread enqueues something without a token).
+	*/
+	struct ProducerSlot
+	{
+		ProducerSlot(moodycamel::ConcurrentQueue<WeakReference<Job>>& q) :
+			token(q)
+		{}
+
+		std::atomic<void*> threadId = { nullptr };
+		moodycamel::ProducerToken token;
+	};
+
+	static constexpr int NumMaxProducers = 64;
+
+	/** A additional thread that only executes streaming jobs. */
+	struct StreamingWorker : public Thread
+	{
+		StreamingWorker(SampleThreadPool& parent_, int workerIndex_) :
+			Thread("Sample Streaming Thread " + String(workerIndex_), HISE_DEFAULT_STACK_SIZE),
+			parent(parent_),
+			workerIndex(workerIndex_)
+		{};
+
+		void run() override
+		{
+			// stopping the main thread will also stop the streaming workers
+			while (!threadShouldExit() && !parent.threadShouldExit())
+			{
+				if (!parent.runNextJob(workerIndex))
+					parent.pimpl->waitForJob(*this, workerIndex);
+			}
+		}
+
+		SampleThreadPool& parent;
+		const int workerIndex;
+	};
+
+	Pimpl(int numWorkers) :
+		incomingJobs(256, NumMaxProducers, 4)
+	{
+		pendingJobs.ensureStorageAllocated(8192);
+
+		for (int i = 0; i < jmax(1, numWorkers); i++)
+			workers.add(new Worker());
+
+		for (int i = 0; i < NumMaxProducers; i++)
+			producers.add(new ProducerSlot(incomingJobs));
+	};
 
 	~Pimpl()
 	{
-		if (auto currentJob = currentlyExecutedJob.load())
+		for (auto w : workers)
+		{
+			if (auto currentJob = w->currentlyExecutedJob.load())
+				currentJob->signalJobShouldExit();
+		}
+	}
+
+	/** Workers hold a read lock while executing a job, clearPendingTasks() needs the write lock. */
+	ReadWriteLock clearLock;
+
+	/** The job queue is filled from multiple threads (including the audio thread) without locking. */
+	moodycamel::ConcurrentQueue<WeakReference<Job>> incomingJobs;
+
+	/** The jobs that were taken out of the queue but not yet executed, sorted on demand by their deadline. */
+	SpinLock pendingLock;
+	Array<WeakReference<Job>> pendingJobs;
+
+	OwnedArray<Worker> workers;
+	OwnedArray<StreamingWorker> streamingWorkers;
+
+	/** Returns the producer token of the current thread or nullptr if all slots are taken. */
+	moodycamel::ProducerToken* getProducerToken()
+	{
+		auto threadId = Thread::getCurrentThreadId();
+
+		for (auto p : producers)
+		{
+			if (p->threadId.load() == threadId)
+				return &p->token;
+		}
+
+		for (auto p : producers)
+		{
+			void* expected = nullptr;
+
+			if (p->threadId.compare_exchange_strong(expected, threadId))
+				return &p->token;
+		}
+
+		// Increase NumMaxProducers
+		jassertfalse;
+		return nullptr;
+	}
+
+	void enqueue(const WeakReference<Job>& job)
+	{
+		if (auto token = getProducerToken())
+		{
+			if (incomingJobs.try_enqueue(*token, job))
+				return;
+		}
+
+		// The preallocated blocks are used up, so this has to allocate
+		incomingJobs.enqueue(job);
+	}
+
+	/** Puts the worker to sleep until a job is added. */
+	void waitForJob(Thread& workerThread, int workerIndex)
+	{
+		auto& w = *workers[workerIndex];
+
+		w.sleeping.store(true);
+
+		// addJob() only notifies sleeping workers, so we need to check the queue after setting the flag
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+
+		if (incomingJobs.size_approx() == 0)
+			workerThread.wait(500);
+
+		w.sleeping.store(false);
+	}
+
+	/** Wakes up one sleeping worker that can execute the job. Streaming workers are preferred 
+		so that the main loading thread stays available for the other jobs. 
+	*/
+	void wakeUpSleepingWorker(SampleThreadPool& pool, bool canRunOnStreamingWorker)
+	{
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+
+		if (canRunOnStreamingWorker)
 		{
-			currentJob->signalJobShouldExit();
+			for (int i = 1; i < workers.size(); i++)
+			{
+				// The exchange makes sure that a sleeping worker is only notified once
+				if (workers[i]->sleeping.exchange(false))
+				{
+					streamingWorkers[i - 1]->notify();
+					return;
+				}
+			}
 		}
+
+		if (workers[0]->sleeping.exchange(false))
+			pool.notify();
 	}
 
-	CriticalSection clearLock;
+	OwnedArray<ProducerSlot> producers;
 
-	std::atomic<double> diskUsage;
-	int64 startTime, endTime;
-	moodycamel::ReaderWriterQueue<WeakReference<Job>> jobQueue;
-	std::atomic<Job*> currentlyExecutedJob;
 	static const String errorMessage;
 };
 
-SampleThreadPool::SampleThreadPool() :
+SampleThreadPool::SampleThreadPool(int numWorkers) :
 	Thread("Sample Loading Thread", HISE_DEFAULT_STACK_SIZE),
-	pimpl(new Pimpl())
+	pimpl(new Pimpl(numWorkers))
 {
-
 	startThread(9);
-	
+
+	for (int i = 1; i < pimpl->workers.size(); i++)
+	{
+		pimpl->streamingWorkers.add(new Pimpl::StreamingWorker(*this, i));
+		pimpl->streamingWorkers.getLast()->startThread(9);
+	}
 }
 
 SampleThreadPool::~SampleThreadPool()
 {
+	for (auto w : pimpl->streamingWorkers)
+		w->signalThreadShouldExit();
+
 	stopThread(1000);
+
+	for (auto w : pimpl->streamingWorkers)
+		w->stopThread(1000);
+
 	pimpl = nullptr;
 }
 
-double SampleThreadPool::getDiskUsage() const noexcept
+int SampleThreadPool::getNumWorkers() const noexcept
 {
-	return pimpl->diskUsage.load();
+	return pimpl->workers.size();
+}
+
+double SampleThreadPool::getDiskUsage(int workerIndex) const noexcept
+{
+	if (auto w = pimpl->workers[workerIndex])
+		return w->diskUsage.load();
+
+	return 0.0;
+}
+
+SampleThreadPool::WorkerStatistics SampleThreadPool::getWorkerStatistics(int workerIndex) const noexcept
+{
+	WorkerStatistics s;
+
+	if (auto w = pimpl->workers[workerIndex])
+	{
+		s.diskUsage = w->diskUsage.load();
+		s.numJobsExecuted = w->numJobsExecuted.load();
+		s.numMissedDeadlines = w->numMissedDeadlines.load();
+	}
+
+	return s;
 }
 
 void SampleThreadPool::clearPendingTasks()
 {
-	ScopedLock sl(pimpl->clearLock);
-		
+	ScopedWriteLock sl(pimpl->clearLock);
+	SpinLock::ScopedLockType pl(pimpl->pendingLock);
+
 	WeakReference<Job> next;
 
-	while (pimpl->jobQueue.try_dequeue(next))
+	while (pimpl->incomingJobs.try_dequeue(next))
+		pimpl->pendingJobs.add(next);
+
+	for (auto& p : pimpl->pendingJobs)
 	{
-		next->queued.store(false);
-		next->signalJobShouldExit();
+		if (auto j = p.get())
+		{
+			j->queued.store(false);
+			j->signalJobShouldExit();
+		}
 	}
+
+	pimpl->pendingJobs.clearQuick();
 }
 
 void SampleThreadPool::addJob(Job* jobToAdd, bool unused)
@@ -104,78 +288,123 @@ void SampleThreadPool::addJob(Job* jobToAdd, bool unused)
 
 
 	jobToAdd->queued.store(true);
-	pimpl->jobQueue.enqueue(jobToAdd);
+	pimpl->enqueue(jobToAdd);
 
-	notify();
+	// Busy workers pick up the job by themselves, so this only wakes up one sleeping worker 
+	// instead of calling notify() on every thread for every job.
+	pimpl->wakeUpSleepingWorker(*this, jobToAdd->canRunOnStreamingWorker());
 }
 
 void SampleThreadPool::run()
 {
 	while (!threadShouldExit())
 	{
-		WeakReference<Job> next;
+#if 0 // Set this to true to enable defective threading (for debugging purposes)
+		runNextJob(0);
+		wait(2500);
+#else
+		if (!runNextJob(0))
+			pimpl->waitForJob(*this, 0);
+#endif
+	}
+}
 
-		if (pimpl->jobQueue.try_dequeue(next))
-		{
-			ScopedLock sl(pimpl->clearLock);
+bool SampleThreadPool::runNextJob(int workerIndex)
+{
+	auto& worker = *pimpl->workers[workerIndex];
 
-			Job* j = next.get();
+	WeakReference<Job> next;
+	double deadline = 0.0;
 
-#if ENABLE_CPU_MEASUREMENT
+	{
+		SpinLock::ScopedLockType sl(pimpl->pendingLock);
 
-			const int64 lastEndTime = pimpl->endTime;
-			pimpl->startTime = Time::getHighResolutionTicks();
-#endif
+		WeakReference<Job> incoming;
 
-			if (j != nullptr)
-			{
-				pimpl->currentlyExecutedJob.store(j);
+		while (pimpl->incomingJobs.try_dequeue(incoming))
+			pimpl->pendingJobs.add(incoming);
 
-				j->currentThread.store(this);
+		int bestIndex = -1;
 
-				j->running.store(true);
-				
-				Job::JobStatus status = j->runJob();
+		for (int i = 0; i < pimpl->pendingJobs.size(); i++)
+		{
+			auto j = pimpl->pendingJobs.getReference(i).get();
 
-				j->running.store(false);
+			if (j == nullptr)
+			{
+				pimpl->pendingJobs.remove(i--);
+				continue;
+			}
 
-				if (status == Job::jobHasFinished)
-				{
-					j->queued.store(false);
-				}
-				else if (status == Job::jobNeedsRunningAgain)
-				{
-					pimpl->jobQueue.enqueue(next);
-				}
+			// Another worker is still busy with this job
+			if (j->isRunning())
+				continue;
 
-				pimpl->currentlyExecutedJob.store(nullptr);
-			}
-			else
+			if (workerIndex != 0 && !j->canRunOnStreamingWorker())
+				continue;
+
+			// Use a strict comparison so that jobs with the same deadline are executed in FIFO order
+			auto thisDeadline = j->getDeadline();
+
+			if (bestIndex == -1 || thisDeadline < deadline)
 			{
-				pimpl->jobQueue.pop();
+				bestIndex = i;
+				deadline = thisDeadline;
 			}
+		}
 
-#if ENABLE_CPU_MEASUREMENT
-			pimpl->endTime = Time::getHighResolutionTicks();
+		if (bestIndex == -1)
+			return false;
 
-			const int64 idleTime = pimpl->startTime - lastEndTime;
-			const int64 busyTime = pimpl->endTime - pimpl->startTime;
+		next = pimpl->pendingJobs[bestIndex];
+		pimpl->pendingJobs.remove(bestIndex);
 
-			pimpl->diskUsage.store((double)busyTime / (double)(idleTime + busyTime));
-#endif
-		}
+		// Claim the job while holding the lock so that no other worker picks it up.
+		next->running.store(true);
+	}
 
-#if 0 // Set this to true to enable defective threading (for debugging purposes)
-		wait(2500);
-#else
-		else
-		{
-			wait(500);
-		}
-#endif
+	ScopedReadLock sl(pimpl->clearLock);
 
+	Job* j = next.get();
 
+	if (j == nullptr)
+		return true;
+
+	const int64 lastEndTime = worker.endTime;
+	const int64 startTime = Time::getHighResolutionTicks();
+
+	if (deadline <= 0.0)
+		worker.numMissedDeadlines++;
+
+	worker.currentlyExecutedJob.store(j);
+
+	j->currentThread.store(Thread::getCurrentThread());
+
+	Job::JobStatus status = j->runJob();
+
+	j->running.store(false);
+
+	if (status == Job::jobHasFinished)
+	{
+		j->queued.store(false);
 	}
+	else if (status == Job::jobNeedsRunningAgain)
+	{
+		pimpl->enqueue(next);
+	}
+
+	worker.currentlyExecutedJob.store(nullptr);
+	worker.numJobsExecuted++;
+
+	worker.endTime = Time::getHighResolutionTicks();
+
+	const int64 idleTime = lastEndTime != 0 ? startTime - lastEndTime : 0;
+	const int64 busyTime = worker.endTime - startTime;
+
+	if (idleTime + busyTime > 0)
+		worker.diskUsage.store((double)busyTime / (double)(idleTime + busyTime));
+
+	return true;
 }
 
 const String SampleThreadPool::Pimpl::errorMessage("HDD overflow");
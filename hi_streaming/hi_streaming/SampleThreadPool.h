@@ -35,11 +35,24 @@
 
 namespace hise { using namespace juce;
 
+/** The background thread pool that fills the streaming buffers and performs the sample loading.
+*
+*	The SampleThreadPool itself is the main loading thread which executes every job type. Additional
+*	streaming workers (see HISE_NUM_STREAMING_THREADS) only pick up jobs that return true in
+*	Job::canRunOnStreamingWorker() so that the sample map preloading and other tasks that need to
+*	run on the loading thread are not affected.
+*
+*	Instead of a FIFO, the pending jobs are executed in the order of their deadline (Job::getDeadline()) so
+*	that a voice which is about to run out of samples is served before voices with lots of headroom.
+*
+*	addJob() can be called from the audio thread: it uses a preallocated producer token of the calling thread
+*	and wakes up at most one sleeping worker.
+*/
 class SampleThreadPool : public Thread
 {
 public:
 
-	SampleThreadPool();
+	SampleThreadPool(int numWorkers=HISE_NUM_STREAMING_THREADS);
 
 	~SampleThreadPool();
 	
@@ -65,6 +78,19 @@ public:
 
 		virtual JobStatus runJob() = 0;
 
+		/** Returns the number of output samples until this job must be finished.
+		*
+		*	The pool will always execute the pending job with the smallest deadline first. The default
+		*	returns the maximum value so that jobs without a deadline are executed after all streaming jobs.
+		*/
+		virtual double getDeadline() const noexcept { return std::numeric_limits<double>::max(); }
+
+		/** Override this and return true if the job can be executed by any worker thread.
+		*
+		*	If this returns false (the default), the job will only be executed by the main loading thread. 
+		*/
+		virtual bool canRunOnStreamingWorker() const noexcept { return false; }
+
 		bool shouldExit() const noexcept{ return shouldStop.load(); }
 
 		void signalJobShouldExit() { shouldStop.store(true); }
@@ -93,7 +119,27 @@ public:
 		const String name;
 	};
 
-	double getDiskUsage() const noexcept;
+	/** The statistics of a single worker thread. */
+	struct WorkerStatistics
+	{
+		/** The ratio of busy time to the total time of the last job. */
+		double diskUsage = 0.0;
+
+		/** The number of jobs that were executed by this worker. */
+		int64 numJobsExecuted = 0;
+
+		/** The number of jobs that were picked up after their deadline has passed. */
+		int64 numMissedDeadlines = 0;
+	};
+
+	/** Returns the number of worker threads (including the main loading thread). */
+	int getNumWorkers() const noexcept;
+
+	/** Returns the disk usage of the given worker (0 is the main loading thread). */
+	double getDiskUsage(int workerIndex) const noexcept;
+
+	/** Returns the statistics of the given worker (0 is the main loading thread). */
+	WorkerStatistics getWorkerStatistics(int workerIndex) const noexcept;
 
 	void clearPendingTasks();
 
@@ -106,6 +152,11 @@ public:
 	
 	ScopedPointer<Pimpl> pimpl;
 
+private:
+
+	/** Picks the pending job with the smallest deadline and executes it. Returns false if there was nothing to do. */
+	bool runNextJob(int workerIndex);
+
 };
 
 typedef SampleThreadPool::Job SampleThreadPoolJob;
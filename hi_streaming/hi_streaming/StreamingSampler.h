@@ -91,11 +91,12 @@ public:
 
 	AudioFormatManager afm;
 
-	int getNumOpenFileHandles() const { return numOpenFileHandles; }
+	int getNumOpenFileHandles() const { return numOpenFileHandles.load(); }
 
 private:
 
-	int numOpenFileHandles = 0;
+	// The file handles might be opened by multiple preload threads
+	std::atomic<int> numOpenFileHandles = { 0 };
 
 	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(StreamingSamplerSoundPool);
 };
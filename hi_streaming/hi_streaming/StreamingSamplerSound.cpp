@@ -1108,11 +1108,13 @@ void StreamingSamplerSound::FileReader::openFileHandles(NotificationType notifyP
 	}
 	else
 	{
-		jassert(memoryReader == nullptr || normalReader == nullptr);
-
 		ScopedWriteLock sl(fileAccessLock);
 
-		fileHandlesOpen = true;
+		// Another streaming worker might have opened the handles while we were waiting for the lock
+		if (fileHandlesOpen)
+			return;
+
+		jassert(memoryReader == nullptr || normalReader == nullptr);
 
 		memoryReader = nullptr;
 		normalReader = nullptr;
@@ -1152,6 +1154,9 @@ void StreamingSamplerSound::FileReader::openFileHandles(NotificationType notifyP
 			stereo = (normalReader != nullptr) ? (normalReader->numChannels > 1) : false;
 		}
 
+		// Set this after the readers are created so that the unlocked check in readFromDisk() never sees a half opened file
+		fileHandlesOpen = true;
+
 #if USE_BACKEND
 		if (monolithicInfo == nullptr && notifyPool == sendNotification) pool->increaseNumOpenFileHandles();
 #else
@@ -1219,10 +1224,11 @@ void StreamingSamplerSound::FileReader::readFromDisk(hlac::HiseSampleBuffer &buf
 
 	if (!isMonolithic() && useMemoryMappedReader)
 	{
+		ScopedReadLock sl(fileAccessLock);
+
+		// The memory mapped reader has no stream position, so it can be used by multiple streaming workers at once
 		if (memoryReader != nullptr && memoryReader->getMappedSection().contains(Range<int64>(readerPosition, readerPosition + numSamples)))
 		{
-			ScopedReadLock sl(fileAccessLock);
-
 			if (buffer.isFloatingPoint())
 				memoryReader->read(buffer.getFloatBufferForFileReader(), startSample, numSamples, readerPosition, true, true);
 			else
@@ -1232,6 +1238,7 @@ void StreamingSamplerSound::FileReader::readFromDisk(hlac::HiseSampleBuffer &buf
 	else if (normalReader != nullptr)
 	{
 		ScopedReadLock sl(fileAccessLock);
+		ScopedLock rl(normalReaderLock);
 
 		if (buffer.isFloatingPoint())
 			normalReader->read(buffer.getFloatBufferForFileReader(), startSample, numSamples, readerPosition, true, true);
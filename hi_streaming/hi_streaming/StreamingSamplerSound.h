@@ -413,6 +413,9 @@ private:
 
 		ReadWriteLock fileAccessLock;
 
+		/** The normal reader seeks and reads through a single stream, so multiple streaming workers must not use it at the same time. */
+		CriticalSection normalReaderLock;
+
 		bool stereo = true;
 
 		bool isReading;
@@ -429,7 +432,7 @@ private:
 
 		ScopedPointer<MemoryMappedAudioFormatReader> memoryReader;
 		ScopedPointer<AudioFormatReader> normalReader;
-		bool fileHandlesOpen;
+		std::atomic<bool> fileHandlesOpen;
 
 		Atomic<int> voiceCount;
 
@@ -120,6 +120,8 @@ void SampleLoader::startNote(StreamingSamplerSound const *s, int startTime)
 
 	entireSampleIsLoaded = s->isEntireSampleLoaded();
 
+	updateDeadline();
+
 	if (!entireSampleIsLoaded)
 	{
 		// The other buffer will be filled on the next free thread pool slot
@@ -316,6 +318,21 @@ StereoChannelData SampleLoader::fillVoiceBuffer(hlac::HiseSampleBuffer &voiceBuf
 	}
 }
 
+void SampleLoader::setPlaybackRatio(double newRatio) noexcept
+{
+	playbackRatio = newRatio;
+	updateDeadline();
+}
+
+void SampleLoader::updateDeadline() noexcept
+{
+	if (auto rb = readBuffer.get())
+	{
+		auto numSamplesLeft = (double)rb->getNumSamples() - readIndexDouble;
+		samplesUntilDeadline.store((float)(numSamplesLeft / jmax(0.001, playbackRatio)));
+	}
+}
+
 bool SampleLoader::advanceReadIndex(double uptime)
 {
 	int numSamplesInBuffer = readBuffer.get()->getNumSamples();
@@ -342,12 +359,15 @@ bool SampleLoader::advanceReadIndex(double uptime)
 			readIndexDouble = uptime - lastSwapPosition;
 
 			swapBuffers();
+			updateDeadline();
 			const bool queueIsFree = requestNewData();
 
 			return queueIsFree;
 		}
 	}
 
+	updateDeadline();
+
 	return true;
 }
 
@@ -544,6 +564,8 @@ void StreamingSamplerVoice::startNote(int /*midiNoteNumber*/,
 		loader.startNote(sound, sampleStartModValue);
 
 		jassert(sound != nullptr);
+
+		hasPreviousFrame = false;
 		
 		voiceUptime = (double)sampleStartModValue;
 
@@ -558,6 +580,8 @@ void StreamingSamplerVoice::startNote(int /*midiNoteNumber*/,
 
 		constUptimeDelta = uptimeDelta;
 
+		loader.setPlaybackRatio(uptimeDelta);
+
 		isActive = true;
 
 	}
@@ -589,121 +613,6 @@ void StreamingSamplerVoice::setDebugLogger(DebugLogger* newLogger)
 	loader.setLogger(logger);
 }
 
-static int alignedCalls = 0;
-static int unalignedCalls = 0;
-
-template <typename SignalType, bool isFloat> void interpolateMonoSamples(const SignalType* inL, const SignalType* unusedIn, const float* pitchData, float* outL, float* unusedOut, int startSample, double indexInBuffer, double uptimeDelta, int numSamples)
-{
-	ignoreUnused(unusedIn, unusedOut);
-
-	constexpr float gainFactor = isFloat ? 1.0f : (1.0f / (float)INT16_MAX);
-
-	if (pitchData != nullptr)
-	{
-		pitchData += startSample;
-
-		float indexInBufferFloat = (float)indexInBuffer;
-
-		for (int i = 0; i < numSamples; i++)
-		{
-			const int pos = int(indexInBufferFloat);
-			const float alpha = indexInBufferFloat - (float)pos;
-			const float invAlpha = 1.0f - alpha;
-
-			float l = ((float)inL[pos] * invAlpha + (float)inL[pos + 1] * alpha);
-
-			outL[i] = l * gainFactor;
-
-			jassert(*pitchData <= (float)MAX_SAMPLER_PITCH);
-
-			indexInBufferFloat += pitchData[i];
-		}
-	}
-	else
-	{
-		float indexInBufferFloat = (float)indexInBuffer;
-		const float uptimeDeltaFloat = (float)uptimeDelta;
-
-		while (numSamples > 0)
-		{
-			const int pos = int(indexInBufferFloat);
-			const float alpha = indexInBufferFloat - (float)pos;
-			const float invAlpha = 1.0f - alpha;
-
-			float l = ((float)inL[pos] * invAlpha + (float)inL[pos + 1] * alpha);
-
-			*outL++ = l * gainFactor;
-
-			indexInBufferFloat += uptimeDeltaFloat;
-
-			numSamples--;
-		}
-	}
-}
-
-template <typename SignalType, bool isFloat> void interpolateStereoSamples(const SignalType* inL, const SignalType* inR, const float* pitchData, float* outL, float* outR, int startSample, double indexInBuffer, double uptimeDelta, int numSamples, int maxIndexInBuffer)
-{
-	constexpr float gainFactor = isFloat ? 1.0f : (1.0f / (float)INT16_MAX);
-
-	if (pitchData != nullptr)
-	{
-		pitchData += startSample;
-
-		float indexInBufferFloat = (float)indexInBuffer;
-
-		for (int i = 0; i < numSamples; i++)
-		{
-			const int pos = int(indexInBufferFloat);
-
-			if (pos >= maxIndexInBuffer)
-				return;
-
-			const float alpha = indexInBufferFloat - (float)pos;
-			const float invAlpha = 1.0f - alpha;
-
-			float l = ((float)inL[pos] * invAlpha + (float)inL[pos + 1] * alpha);
-			float r = ((float)inR[pos] * invAlpha + (float)inR[pos + 1] * alpha);
-
-			outL[i] = l * gainFactor;
-			outR[i] = r * gainFactor;
-
-			jassert(*pitchData <= (float)MAX_SAMPLER_PITCH);
-
-			indexInBufferFloat += pitchData[i];
-		}
-	}
-	else
-	{
-		float indexInBufferFloat = (float)indexInBuffer;
-		const float uptimeDeltaFloat = (float)uptimeDelta;
-
-		auto numTargetSamples = (double)(maxIndexInBuffer - indexInBuffer);
-
-		jassert(numTargetSamples > 0.0);
-
-		numSamples = jmin(numSamples, (int)(numTargetSamples / uptimeDelta));
-
-		while (numSamples > 0)
-		{
-			const int pos = int(indexInBufferFloat);
-			const float alpha = indexInBufferFloat - (float)pos;
-			const float invAlpha = 1.0f - alpha;
-
-			float l = ((float)inL[pos] * invAlpha + (float)inL[pos + 1] * alpha);
-			float r = ((float)inR[pos] * invAlpha + (float)inR[pos + 1] * alpha);
-
-			*outL++ = l * gainFactor;
-			*outR++ = r * gainFactor;
-
-			indexInBufferFloat += uptimeDeltaFloat;
-
-			numSamples--;
-		}
-	}
-}
-
-
-
 void StreamingSamplerVoice::renderNextBlock(AudioSampleBuffer &outputBuffer, int startSample, int numSamples)
 {
 	const StreamingSamplerSound *sound = loader.getLoadedSound();
@@ -728,8 +637,11 @@ void StreamingSamplerVoice::renderNextBlock(AudioSampleBuffer &outputBuffer, int
 			tempVoiceBuffer->setSize(tempVoiceBuffer->getNumChannels(), roundToInt((pitchCounter + startAlpha) * 1.5));
 		}
 
+		// The Hermite interpolation needs one more sample after the last read position
+		const int extraLookahead = ResamplingKernels::getNumLookaheadSamples(interpolationMode) - 1;
+
 		// Copy the not resampled values into the voice buffer.
-		StereoChannelData data = loader.fillVoiceBuffer(*tempVoiceBuffer, pitchCounter + startAlpha);
+		StereoChannelData data = loader.fillVoiceBuffer(*tempVoiceBuffer, pitchCounter + startAlpha + (double)extraLookahead);
 
 		float* outL = outputBuffer.getWritePointer(0, startSample);
 		float* outR = outputBuffer.getWritePointer(1, startSample);
@@ -745,12 +657,43 @@ void StreamingSamplerVoice::renderNextBlock(AudioSampleBuffer &outputBuffer, int
 
 		double indexInBuffer = startAlpha;
 
+		ResamplingKernels::Data kernelData;
+		kernelData.output[0] = outL;
+		kernelData.output[1] = outR;
+		kernelData.pitchData = pitchData != nullptr ? pitchData + startSample : nullptr;
+		kernelData.indexInBuffer = indexInBuffer;
+		kernelData.uptimeDelta = uptimeDelta;
+		kernelData.numSamples = numSamples;
+		kernelData.maxIndexInBuffer = (int)(indexInBuffer + samplesAvailable);
+		kernelData.previousFrame[0] = previousFrame[0];
+		kernelData.previousFrame[1] = previousFrame[1];
+		kernelData.hasPreviousFrame = hasPreviousFrame;
+
+		// This is the first source frame of the next block (relative to the current read position).
+		const int nextBlockIndex = (int)(startAlpha + pitchCounter);
+
+		// Stores the frame before the next read position in the source range (the gain is applied after the interpolation).
+		auto storePreviousFrame = [&](const auto* l, const auto* r)
+		{
+			if (isPositiveAndBelow(nextBlockIndex - 1, samplesAvailable))
+			{
+				previousFrame[0] = (float)l[nextBlockIndex - 1];
+				previousFrame[1] = (float)r[nextBlockIndex - 1];
+				hasPreviousFrame = true;
+			}
+		};
+
 		if (data.b->isFloatingPoint())
 		{
 			const float* const inL = static_cast<const float*>(data.b->getReadPointer(0, data.offsetInBuffer));
 			const float* const inR = static_cast<const float*>(data.b->getReadPointer(1, data.offsetInBuffer));
 
-			interpolateStereoSamples<float, true>(inL, inR, pitchData, outL, outR, startSample, indexInBuffer, uptimeDelta, numSamples, indexInBuffer + samplesAvailable);
+			kernelData.input[0] = inL;
+			kernelData.input[1] = inR;
+
+			ResamplingKernels::process<float, 2>(interpolationMode, kernelData);
+
+			storePreviousFrame(inL, inR);
 		}
 		else
 		{
@@ -761,33 +704,46 @@ void StreamingSamplerVoice::renderNextBlock(AudioSampleBuffer &outputBuffer, int
 
 			if (useNormalisation)
 			{
-				const int numSamplesThisTime = (int)(ceil)((pitchCounter + startAlpha)) + 1;
+				const int numSamplesThisTime = (int)(ceil)((pitchCounter + startAlpha)) + 1 + extraLookahead;
 
 				float* inL_f = (float*)alloca(sizeof(float) * numSamplesThisTime);
 				float* d[2] = { inL_f, nullptr };
 
+				kernelData.input[0] = inL_f;
+
 				if (data.b->getNumChannels() == 2 && !data.b->useOneMap)
 				{
 					float* inR_f = (float*)alloca(sizeof(float) * numSamplesThisTime);
 
 					d[1] = inR_f;
+					kernelData.input[1] = inR_f;
 
 					data.b->convertToFloatWithNormalisation(d, data.b->getNumChannels(), data.offsetInBuffer, numSamplesThisTime);
 
-					interpolateStereoSamples<float, true>(inL_f, inR_f, pitchData, outL, outR, startSample, indexInBuffer, uptimeDelta, numSamples, indexInBuffer + samplesAvailable);
+					ResamplingKernels::process<float, 2>(interpolationMode, kernelData);
+
+					storePreviousFrame(inL_f, inR_f);
 				}
 				else
 				{
 					data.b->convertToFloatWithNormalisation(d, 1, data.offsetInBuffer, numSamplesThisTime);
 
-					interpolateMonoSamples<float, true>(inL_f, nullptr, pitchData, outL, nullptr, startSample, indexInBuffer, uptimeDelta, numSamples);
+					kernelData.maxIndexInBuffer = std::numeric_limits<int>::max();
+					ResamplingKernels::process<float, 1>(interpolationMode, kernelData);
 
 					memcpy(outR, outL, sizeof(float) * numSamples);
+
+					storePreviousFrame(inL_f, inL_f);
 				}
 			}
 			else
 			{
-				interpolateStereoSamples<int16, false>(inL, inR, pitchData, outL, outR, startSample, indexInBuffer, uptimeDelta, numSamples, indexInBuffer + samplesAvailable);
+				kernelData.input[0] = inL;
+				kernelData.input[1] = inR;
+
+				ResamplingKernels::process<int16, 2>(interpolationMode, kernelData);
+
+				storePreviousFrame(inL, inR);
 			}
 		}
 
@@ -810,6 +766,10 @@ void StreamingSamplerVoice::renderNextBlock(AudioSampleBuffer &outputBuffer, int
 		voiceUptime += pitchCounter;
 #endif
 
+		// the average pitch ratio of this block is used to calculate the streaming deadline
+		if (numSamplesFixed > 0)
+			loader.setPlaybackRatio(pitchCounter / (double)numSamplesFixed);
+
 		if (!loader.advanceReadIndex(voiceUptime))
 		{
 #if LOG_SAMPLE_RENDERING
@@ -869,6 +829,7 @@ void StreamingSamplerVoice::resetVoice()
 	voiceUptime = 0.0;
 	uptimeDelta = 0.0;
 	isActive = false;
+	hasPreviousFrame = false;
 	loader.reset();
 	clearCurrentNote();
 }
@@ -897,7 +858,8 @@ void StreamingSamplerVoice::initTemporaryVoiceBuffer(hlac::HiseSampleBuffer* buf
 	// The channel amount must be set correctly in the constructor
 	jassert(bufferToUse->getNumChannels() > 0);
 
-    auto requiredSampleAmount = roundToInt((double)samplesPerBlock* maxPitchRatio);
+    // add a few samples for the lookahead of the interpolation
+    auto requiredSampleAmount = roundToInt((double)samplesPerBlock* maxPitchRatio) + 4;
     
 	if (bufferToUse->getNumSamples() < requiredSampleAmount)
 	{
@@ -69,6 +69,15 @@ public:
 	*/
 	JobStatus runJob() override;
 
+	/** Returns the number of output samples until the read buffer runs out of samples. */
+	double getDeadline() const noexcept override { return (double)samplesUntilDeadline.load(); }
+
+	/** The streaming buffers can be filled by any streaming worker. */
+	bool canRunOnStreamingWorker() const noexcept override { return true; }
+
+	/** Sets the ratio between the source samples and the output samples (the pitch factor) that is used to calculate the deadline. */
+	void setPlaybackRatio(double newRatio) noexcept;
+
 	size_t getActualStreamingBufferSize() const;
 
 	void setStreamingBufferDataType(bool shouldBeFloat);
@@ -103,6 +112,8 @@ public:
 
 		JobStatus runJob() override;
 
+		bool canRunOnStreamingWorker() const noexcept override { return true; }
+
 	private:
 
 		StreamingSamplerSound::Ptr sound;
@@ -152,6 +163,7 @@ private:
 
 	void fillInactiveBuffer();
 	void refreshBufferSizes();
+	void updateDeadline() noexcept;
 	// ============================================================================================ member variables
 
 	Unmapper unmapper;
@@ -171,6 +183,11 @@ private:
 
 	double lastSwapPosition = 0.0;
 
+	double playbackRatio = 1.0;
+
+	/** The deadline for the background thread in output samples (updated in the audio thread). */
+	std::atomic<float> samplesUntilDeadline = { 0.0f };
+
 	Atomic<StreamingSamplerSound const *> sound;
 
 	int readIndex;
@@ -297,8 +314,19 @@ public:
 	/** Set this to false if you're using HLAC compressed monoliths. */
 	void setStreamingBufferDataType(bool shouldBeFloat);
 
+	/** Sets the algorithm that is used to resample the sample data. */
+	void setInterpolationMode(SampleInterpolationMode newMode) noexcept { interpolationMode = newMode; }
+
+	SampleInterpolationMode getInterpolationMode() const noexcept { return interpolationMode; }
+
 private:
 
+	SampleInterpolationMode interpolationMode = SampleInterpolationMode::Linear;
+
+	// the last source frame of the previous block (used by the Hermite interpolation)
+	float previousFrame[2] = { 0.0f, 0.0f };
+	bool hasPreviousFrame = false;
+
 	double pitchCounter = 0.0;
 
 	hlac::HiseSampleBuffer* tvb = nullptr;
@@ -52,14 +52,14 @@
 
 #include "hi_binary_data/hi_binary_data.cpp"
 
-#if USE_IPP
+#include "hi_tools/SimdFFT.cpp"
 #include "hi_tools/IppFFT.cpp"
-#endif
 
 #include "hi_tools/CustomDataContainers.cpp"
 #include "hi_tools/HiseEventBuffer.cpp"
 
 #include "hi_tools/MiscToolClasses.cpp"
+#include "hi_tools/RealtimeWorkerPool.cpp"
 
 
 #include "hi_tools/PathFactory.cpp"
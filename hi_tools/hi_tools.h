@@ -107,6 +107,15 @@ will break compatibility with older projects / presets because the tempo indexes
 #define HISE_USE_EXTENDED_TEMPO_VALUES 0
 #endif
 
+/** Config: HISE_NUM_REALTIME_WORKER_THREADS
+
+The number of worker threads that can be used to render the audio callback in parallel (eg. the voices of a sound generator
+with parallel voice rendering enabled). It will never use more threads than the number of CPU cores - 1. Set this to 0 to disable parallel rendering.
+*/
+#ifndef HISE_NUM_REALTIME_WORKER_THREADS
+#define HISE_NUM_REALTIME_WORKER_THREADS 3
+#endif
+
 /** Reenables using the mouse wheel to control the table curve if set to 1. */
 #ifndef HISE_USE_MOUSE_WHEEL_FOR_TABLE_CURVE
 #define HISE_USE_MOUSE_WHEEL_FOR_TABLE_CURVE 0
@@ -189,6 +198,7 @@ will break compatibility with older projects / presets because the tempo indexes
 #include "hi_tools/UpdateMerger.h"
 
 #include "hi_tools/MiscToolClasses.h"
+#include "hi_tools/RealtimeWorkerPool.h"
 
 #include "hi_tools/PathFactory.h"
 #include "hi_tools/HI_LookAndFeels.h"
@@ -203,11 +213,12 @@ will break compatibility with older projects / presets because the tempo indexes
 #include "hi_tools/ValueTreeHelpers.h"
 
 #if USE_IPP
-
 #include "ipp.h"
-#include "hi_tools/IppFFT.h"
 #endif
 
+#include "hi_tools/SimdFFT.h"
+#include "hi_tools/IppFFT.h"
+
 #if !HISE_NO_GUI_TOOLS
 
 #include "gin_images/gin_imageeffects.h"
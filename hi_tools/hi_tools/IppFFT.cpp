@@ -32,6 +32,8 @@
 
 namespace hise { using namespace juce;
 
+#if USE_IPP
+
 
 IppFFT::IppFFT(DataType typeToUse, int maxPowerOfTwo /*= IPP_FFT_MAX_POWER_OF_TWO*/, const int flagToUse /*= IPP_FFT_NODIV_BY_ANY*/) :
 type(typeToUse),
@@ -356,4 +358,407 @@ void IppFFT::Buffer::releaseData()
 	}
 }
 
-} // namespace hise
\ No newline at end of file
+#else
+
+IppFFT::IppFFT(DataType typeToUse, int maxPowerOfTwo /*= IPP_FFT_MAX_POWER_OF_TWO*/, const int /*flagToUse*/) :
+type(typeToUse),
+maxOrder(jmin<int>(maxPowerOfTwo, IPP_FFT_MAX_POWER_OF_TWO))
+{
+	const bool isReal = type == DataType::RealFloat || type == DataType::RealDouble;
+
+	ffts.add(nullptr);
+
+	// The complex FFT of the order N needs a SimdFFT with the real size 2^(N+1)
+	for (int i = 1; i < maxOrder; i++)
+		ffts.add(new SimdFFT(isReal ? (1 << i) : (2 << i)));
+
+	const int maxSize = 1 << maxOrder;
+
+	splitR.calloc(maxSize + 1);
+	splitI.calloc(maxSize + 1);
+
+	if (type == DataType::RealDouble || type == DataType::ComplexDouble)
+		floatBuffer.calloc(2 * maxSize);
+}
+
+IppFFT::~IppFFT()
+{
+	ffts.clear();
+}
+
+template <typename F> void IppFFT::doubleTransform(double* data, int numValues, const F& f) const
+{
+	for (int i = 0; i < numValues; i++)
+		floatBuffer[i] = (float)data[i];
+
+	f(floatBuffer);
+
+	for (int i = 0; i < numValues; i++)
+		data[i] = (double)floatBuffer[i];
+}
+
+void IppFFT::realFFTInplace(float *data, int size) const
+{
+	realFFT(data, data, size);
+}
+
+void IppFFT::realFFTInplace(double *data, int size) const
+{
+	jassert(type == DataType::RealDouble);
+
+	const int N = getPowerOfTwo(size);
+
+	if (N > 0)
+	{
+		doubleTransform(data, size, [&](float* d)
+		{
+			ffts[N]->realFFT(d, splitR, splitI);
+			writePerm(d, size);
+		});
+	}
+}
+
+void IppFFT::realFFTInverseInplace(float *data, int size) const
+{
+	realFFTInverse(data, data, size);
+}
+
+void IppFFT::realFFTInverseInplace(double *data, int size) const
+{
+	jassert(type == DataType::RealDouble);
+
+	const int N = getPowerOfTwo(size);
+
+	if (N > 0)
+	{
+		doubleTransform(data, size, [&](float* d)
+		{
+			readPerm(d, size);
+			ffts[N]->realInverseFFT(splitR, splitI, d);
+		});
+	}
+}
+
+void IppFFT::complexFFTInplace(float *data, int size) const
+{
+	complexFFT(data, data, size);
+}
+
+void IppFFT::complexFFTInplace(double *data, int size) const
+{
+	jassert(type == DataType::ComplexDouble);
+
+	doubleTransform(data, 2 * size, [&](float* d)
+	{
+		complexTransform(d, d, size, false);
+	});
+}
+
+void IppFFT::complexFFTInverseInplace(float *data, int size) const
+{
+	complexFFTInverse(data, data, size);
+}
+
+void IppFFT::complexFFTInverseInplace(double *data, int size) const
+{
+	jassert(type == DataType::ComplexDouble);
+
+	doubleTransform(data, 2 * size, [&](float* d)
+	{
+		complexTransform(d, d, size, true);
+	});
+}
+
+void IppFFT::realFFT(const float *in, float* out, int size) const
+{
+	jassert(type == DataType::RealFloat);
+
+	const int N = getPowerOfTwo(size);
+
+	if (N > 0)
+	{
+		ffts[N]->realFFT(in, splitR, splitI);
+		writePerm(out, size);
+	}
+}
+
+void IppFFT::realFFTInverse(const float *in, float* out, int size) const
+{
+	jassert(type == DataType::RealFloat);
+
+	const int N = getPowerOfTwo(size);
+
+	if (N > 0)
+	{
+		readPerm(in, size);
+		ffts[N]->realInverseFFT(splitR, splitI, out);
+	}
+}
+
+void IppFFT::complexFFT(const float *in, float* out, int size) const
+{
+	jassert(type == DataType::ComplexFloat);
+	complexTransform(in, out, size, false);
+}
+
+void IppFFT::complexFFTInverse(const float* in, float *out, int size) const
+{
+	jassert(type == DataType::ComplexFloat);
+	complexTransform(in, out, size, true);
+}
+
+int IppFFT::getPowerOfTwo(int size) const
+{
+	if (!isPowerOfTwo(size)) return -1;
+
+	const int N = (int)(log(size) / log(2));
+
+	if (isPositiveAndBelow(N, maxOrder))
+	{
+		return N;
+	}
+	else
+	{
+		jassertfalse;
+	}
+
+	return -1;
+}
+
+void IppFFT::writePerm(float* out, int size) const
+{
+	const int n = size / 2;
+
+	out[0] = splitR[0];
+	out[1] = splitR[n];
+
+	for (int i = 1; i < n; i++)
+	{
+		out[2 * i] = splitR[i];
+		out[2 * i + 1] = splitI[i];
+	}
+}
+
+void IppFFT::readPerm(const float* in, int size) const
+{
+	const int n = size / 2;
+
+	splitR[0] = in[0];
+	splitI[0] = 0.0f;
+	splitR[n] = in[1];
+	splitI[n] = 0.0f;
+
+	for (int i = 1; i < n; i++)
+	{
+		splitR[i] = in[2 * i];
+		splitI[i] = in[2 * i + 1];
+	}
+}
+
+void IppFFT::complexTransform(const float* in, float* out, int size, bool inverse) const
+{
+	const int N = getPowerOfTwo(size);
+
+	if (N > 0)
+	{
+		for (int i = 0; i < size; i++)
+		{
+			splitR[i] = in[2 * i];
+			splitI[i] = in[2 * i + 1];
+		}
+
+		ffts[N]->complexFFT(splitR, splitI, inverse);
+
+		for (int i = 0; i < size; i++)
+		{
+			out[2 * i] = splitR[i];
+			out[2 * i + 1] = splitI[i];
+		}
+	}
+}
+
+#endif
+
+#if HI_RUN_UNIT_TESTS
+
+/** Checks the Perm format and the (unscaled) round trip of the IppFFT interface.
+
+	This runs against IPP or the SimdFFT fallback, depending on USE_IPP.
+*/
+struct IppFFTUnitTest : public UnitTest
+{
+	IppFFTUnitTest() :
+		UnitTest("Testing IppFFT")
+	{}
+
+	void runTest() override
+	{
+		for (int size = 8; size <= 4096; size *= 4)
+		{
+			testRealSpectrum(size);
+			testRealRoundtrip(size);
+			testComplexSpectrum(size);
+			testComplexRoundtrip(size);
+			testDoubleRoundtrip(size);
+		}
+	}
+
+	void expectNear(float actual, float expected, float tolerance, const String& message)
+	{
+		expect(std::abs(actual - expected) <= tolerance, message + ": expected " + String(expected) + ", got " + String(actual));
+	}
+
+	void testRealSpectrum(int size)
+	{
+		beginTest("Test real FFT spectrum with size " + String(size));
+
+		IppFFT fft(IppFFT::DataType::RealFloat);
+
+		HeapBlock<float> data;
+		data.calloc(size);
+
+		// DC = 0.5, bin 1 = cosine with amplitude 1, Nyquist = 0.25
+		const int bin = 1;
+
+		for (int i = 0; i < size; i++)
+		{
+			auto phase = MathConstants<double>::twoPi * (double)(bin * i) / (double)size;
+			data[i] = 0.5f + (float)std::cos(phase) + ((i % 2 == 0) ? 0.25f : -0.25f);
+		}
+
+		fft.realFFTInplace(data, size);
+
+		const float n = (float)size;
+		const float tolerance = n * 1e-5f;
+
+		expectNear(data[0], n * 0.5f, tolerance, "DC");
+		expectNear(data[1], n * 0.25f, tolerance, "Nyquist");
+		expectNear(data[2 * bin], n * 0.5f, tolerance, "cosine real part");
+		expectNear(data[2 * bin + 1], 0.0f, tolerance, "cosine imaginary part");
+
+		float maxOther = 0.0f;
+
+		for (int i = 2; i < size / 2; i++)
+			maxOther = jmax(maxOther, std::abs(data[2 * i]), std::abs(data[2 * i + 1]));
+
+		expectNear(maxOther, 0.0f, tolerance, "leakage into other bins");
+	}
+
+	void testRealRoundtrip(int size)
+	{
+		beginTest("Test real FFT roundtrip with size " + String(size));
+
+		IppFFT fft(IppFFT::DataType::RealFloat);
+
+		Random r;
+		HeapBlock<float> input, spectrum, output;
+		input.calloc(size); spectrum.calloc(size); output.calloc(size);
+
+		for (int i = 0; i < size; i++)
+			input[i] = r.nextFloat() * 2.0f - 1.0f;
+
+		fft.realFFT(input, spectrum, size);
+		fft.realFFTInverse(spectrum, output, size);
+
+		// The transforms are unscaled, so the roundtrip multiplies by size
+		float maxError = 0.0f;
+
+		for (int i = 0; i < size; i++)
+			maxError = jmax(maxError, std::abs(output[i] / (float)size - input[i]));
+
+		expectNear(maxError, 0.0f, 1e-5f, "roundtrip error");
+	}
+
+	void testComplexSpectrum(int size)
+	{
+		beginTest("Test complex FFT spectrum with size " + String(size));
+
+		IppFFT fft(IppFFT::DataType::ComplexFloat);
+
+		HeapBlock<float> data;
+		data.calloc(2 * size);
+
+		// e^(j * 2pi * 3 * i / size) ends up in bin 3 only
+		const int bin = 3;
+
+		for (int i = 0; i < size; i++)
+		{
+			auto phase = MathConstants<double>::twoPi * (double)(bin * i) / (double)size;
+			data[2 * i] = (float)std::cos(phase);
+			data[2 * i + 1] = (float)std::sin(phase);
+		}
+
+		fft.complexFFTInplace(data, size);
+
+		const float n = (float)size;
+		const float tolerance = n * 1e-5f;
+
+		expectNear(data[2 * bin], n, tolerance, "real part");
+		expectNear(data[2 * bin + 1], 0.0f, tolerance, "imaginary part");
+
+		float maxOther = 0.0f;
+
+		for (int i = 0; i < size; i++)
+		{
+			if (i != bin)
+				maxOther = jmax(maxOther, std::abs(data[2 * i]), std::abs(data[2 * i + 1]));
+		}
+
+		expectNear(maxOther, 0.0f, tolerance, "leakage into other bins");
+	}
+
+	void testComplexRoundtrip(int size)
+	{
+		beginTest("Test complex FFT roundtrip with size " + String(size));
+
+		IppFFT fft(IppFFT::DataType::ComplexFloat);
+
+		Random r;
+		HeapBlock<float> input, data;
+		input.calloc(2 * size); data.calloc(2 * size);
+
+		for (int i = 0; i < 2 * size; i++)
+			input[i] = data[i] = r.nextFloat() * 2.0f - 1.0f;
+
+		fft.complexFFTInplace(data, size);
+		fft.complexFFTInverseInplace(data, size);
+
+		float maxError = 0.0f;
+
+		for (int i = 0; i < 2 * size; i++)
+			maxError = jmax(maxError, std::abs(data[i] / (float)size - input[i]));
+
+		expectNear(maxError, 0.0f, 1e-5f, "roundtrip error");
+	}
+
+	void testDoubleRoundtrip(int size)
+	{
+		beginTest("Test double FFT roundtrip with size " + String(size));
+
+		IppFFT fft(IppFFT::DataType::RealDouble);
+
+		Random r;
+		HeapBlock<double> input, data;
+		input.calloc(size); data.calloc(size);
+
+		for (int i = 0; i < size; i++)
+			input[i] = data[i] = r.nextDouble() * 2.0 - 1.0;
+
+		fft.realFFTInplace(data, size);
+		fft.realFFTInverseInplace(data, size);
+
+		double maxError = 0.0;
+
+		for (int i = 0; i < size; i++)
+			maxError = jmax(maxError, std::abs(data[i] / (double)size - input[i]));
+
+		// the fallback computes the double FFT with float precision
+		expect(maxError < 1e-5, "roundtrip error: " + String(maxError));
+	}
+};
+
+static IppFFTUnitTest ippFFTUnitTest;
+
+#endif
+
+} // namespace hise
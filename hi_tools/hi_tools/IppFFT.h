@@ -46,6 +46,9 @@ namespace hise { using namespace juce;
 *	fft.realFFT(data, 512);
 *
 *	It is not templated for speed, but it throws assertions if you call it on the wrong type.
+*
+*	If USE_IPP is disabled, the same interface is implemented with the bundled SimdFFT. In this case
+*	the flag is ignored (the transforms are never scaled) and the double FFTs are calculated with float precision.
 */
 class IppFFT
 {
@@ -125,13 +128,17 @@ public:
 	/** Complex inverse inplace FFT (input is aligned Complex<double> array, size is power of two.) */
 	void complexFFTInverseInplace(double *data, int size) const;
 
+#if USE_IPP
 	float *getAdditionalWorkBuffer()
 	{
 		return (float*)additionalWorkingBuffer->getData();
 	}
+#endif
 
 private:
 
+#if USE_IPP
+
 	// =============================================================================================================================
 
 	class Buffer
@@ -181,6 +188,29 @@ private:
 
 	ScopedPointer<Buffer> additionalWorkingBuffer;
 
+#else
+
+	/** @internal */
+	int getPowerOfTwo(int size) const;
+	/** @internal */
+	void writePerm(float* out, int size) const;
+	/** @internal */
+	void readPerm(const float* in, int size) const;
+	/** @internal */
+	void complexTransform(const float* in, float* out, int size, bool inverse) const;
+	/** @internal */
+	template <typename F> void doubleTransform(double* data, int numValues, const F& f) const;
+
+	const DataType type;
+	const int maxOrder;
+
+	OwnedArray<SimdFFT> ffts;
+
+	mutable HeapBlock<float> splitR, splitI;
+	mutable HeapBlock<float> floatBuffer;
+
+#endif
+
 	// =============================================================================================================================
 
 	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(IppFFT)
@@ -531,38 +531,266 @@ SimpleReadWriteLock::ScopedTryReadLock::~ScopedTryReadLock()
 }
 #endif
 
+AsyncUpdateDispatcher::Item::Item(Priority p) :
+	priority(p)
+{
+	dispatcher->numItems++;
+}
+
+AsyncUpdateDispatcher::Item::~Item()
+{
+	dirty.store(false);
+	dispatcher->removeItem(this);
+}
+
+void AsyncUpdateDispatcher::Item::markDirty()
+{
+	dirty.store(true);
+
+	bool expected = false;
+
+	if (queued.compare_exchange_strong(expected, true))
+		dispatcher->push(this);
+}
+
+void AsyncUpdateDispatcher::Item::setSuspended(bool shouldBeSuspended)
+{
+	suspended.store(shouldBeSuspended);
+
+	// A suspended item is removed from the queue but keeps its dirty flag, so we need to requeue it
+	if (!shouldBeSuspended && dirty.load())
+		markDirty();
+}
+
+AsyncUpdateDispatcher::FrameClient::FrameClient()
+{
+	dispatcher->addFrameClient(this);
+}
+
+AsyncUpdateDispatcher::FrameClient::~FrameClient()
+{
+	dispatcher->removeFrameClient(this);
+}
+
+AsyncUpdateDispatcher::AsyncUpdateDispatcher()
+{
+	for (auto& l : pendingItems)
+		l.ensureStorageAllocated(1024);
+
+#if !HISE_HEADLESS
+	startTimer(FrameIntervalMilliseconds);
+#endif
+}
+
+AsyncUpdateDispatcher::~AsyncUpdateDispatcher()
+{
+	stopTimer();
+
+	// All items and frame clients hold a reference to the dispatcher
+	jassert(numItems.load() == 0);
+	jassert(frameClients.isEmpty());
+}
+
+AsyncUpdateDispatcher::Statistics AsyncUpdateDispatcher::getStatistics() const
+{
+	ScopedLock sl(drainLock);
+
+	auto s = statistics;
+	s.numItems = numItems.load();
+	s.numFrameClients = frameClients.size();
+	return s;
+}
+
+void AsyncUpdateDispatcher::push(Item* item)
+{
+	auto head = dirtyHead.load(std::memory_order_relaxed);
+
+	do
+	{
+		item->nextDirtyItem = head;
+	} 
+	while (!dirtyHead.compare_exchange_weak(head, item, std::memory_order_release, std::memory_order_relaxed));
+}
+
+void AsyncUpdateDispatcher::removeItem(Item* item)
+{
+	ScopedLock sl(drainLock);
+
+	numItems--;
+
+	// The item might be deleted in a callback of the current frame
+	for (auto& l : pendingItems)
+	{
+		for (auto& p : l)
+		{
+			if (p == item)
+				p = nullptr;
+		}
+	}
+
+	if (item->queued.load())
+	{
+		// Take the list and push back the other items. The producers
+		// only push onto the head, so this doesn't interfere with them.
+		auto i = dirtyHead.exchange(nullptr, std::memory_order_acquire);
+
+		while (i != nullptr)
+		{
+			auto next = i->nextDirtyItem;
+
+			if (i != item)
+				push(i);
+
+			i = next;
+		}
+	}
+}
+
+void AsyncUpdateDispatcher::addFrameClient(FrameClient* c)
+{
+	ScopedLock sl(drainLock);
+	frameClients.addIfNotAlreadyThere(c);
+}
+
+void AsyncUpdateDispatcher::removeFrameClient(FrameClient* c)
+{
+	ScopedLock sl(drainLock);
+
+	auto index = frameClients.indexOf(c);
+
+	if (index == -1)
+		return;
+
+	if (draining)
+		frameClients.set(index, nullptr);
+	else
+		frameClients.remove(index);
+}
+
+void AsyncUpdateDispatcher::timerCallback()
+{
+	handleUpdatesNow();
+}
+
+void AsyncUpdateDispatcher::handleUpdatesNow()
+{
+	int numDirtyItems = 0;
+
+	{
+		ScopedLock sl(drainLock);
+
+		// A callback might run a modal loop that calls the timer again
+		if (draining)
+			return;
+
+		draining = true;
+
+		auto item = dirtyHead.exchange(nullptr, std::memory_order_acquire);
+
+		while (item != nullptr)
+		{
+			auto next = item->nextDirtyItem;
+			pendingItems[(int)item->priority].add(item);
+			numDirtyItems++;
+			item = next;
+		}
+	}
+
+	// The callbacks are called without holding the lock, so they can trigger, create or
+	// delete other items. A deleted item sets its slot in the pending lists to nullptr,
+	// so every slot is checked under the lock right before its callback.
+
+	int numCallbacks = 0;
+
+	for (auto& l : pendingItems)
+	{
+		for (int i = 0;; i++)
+		{
+			Item* p = nullptr;
+
+			{
+				ScopedLock sl(drainLock);
+
+				if (i >= l.size())
+					break;
+
+				p = l[i];
+
+				if (p == nullptr)
+					continue;
+
+				// Clear the queued flag before the callback so that the item can be 
+				// marked dirty again during the callback (or from another thread).
+				p->queued.store(false);
+
+				if (p->suspended.load())
+					continue;
+
+				bool expected = true;
+
+				if (!p->dirty.compare_exchange_strong(expected, false))
+					continue;
+			}
+
+			p->handleDirtyItem();
+			numCallbacks++;
+		}
+	}
+
+	for (int i = 0;; i++)
+	{
+		FrameClient* c = nullptr;
+
+		{
+			ScopedLock sl(drainLock);
+
+			if (i >= frameClients.size())
+				break;
+
+			c = frameClients[i];
+		}
+
+		if (c != nullptr)
+			c->handleFrame();
+	}
+
+	ScopedLock sl(drainLock);
+
+	for (auto& l : pendingItems)
+		l.clearQuick();
+
+	frameClients.removeAllInstancesOf(nullptr);
+	draining = false;
+
+	statistics.numDirtyItems = numDirtyItems;
+	statistics.numCallbacks = numCallbacks;
+	statistics.maxCallbacksPerFrame = jmax(statistics.maxCallbacksPerFrame, numCallbacks);
+	statistics.numTotalCallbacks += numCallbacks;
+	statistics.numFrames++;
+}
+
 LockfreeAsyncUpdater::~LockfreeAsyncUpdater()
 {
 	cancelPendingUpdate();
-
-	instanceCount--;
 }
 
 void LockfreeAsyncUpdater::triggerAsyncUpdate()
 {
-	pimpl.triggerAsyncUpdate();
+	pimpl.markDirty();
 }
 
 void LockfreeAsyncUpdater::cancelPendingUpdate()
 {
-	pimpl.cancelPendingUpdate();
+	pimpl.clearDirty();
 }
 
 LockfreeAsyncUpdater::LockfreeAsyncUpdater() :
 	pimpl(this)
 {
-	// If you're hitting this assertion, it means
-	// that you are creating a lot of these objects
-	// which clog the timer thread.
-	// Consider using the standard AsyncUpdater instead
-	jassert(instanceCount++ < 200);
 }
 
 
 
-int LockfreeAsyncUpdater::instanceCount = 0;
-
-
 void FloatSanitizers::sanitizeArray(float* data, int size)
 {
 	uint32* dataAsInt = reinterpret_cast<uint32*>(data);
@@ -1337,4 +1565,198 @@ void Spectrum2D::Parameters::Editor::resized()
 	}	
 }
 
+#if HI_RUN_UNIT_TESTS
+
+struct AsyncUpdateDispatcherTests : public UnitTest
+{
+	AsyncUpdateDispatcherTests() :
+		UnitTest("Testing AsyncUpdateDispatcher")
+	{}
+
+	struct TestItem : public AsyncUpdateDispatcher::Item
+	{
+		TestItem(const String& name_, StringArray& log_, AsyncUpdateDispatcher::Priority p = AsyncUpdateDispatcher::Priority::Normal) :
+			Item(p),
+			name(name_),
+			log(log_)
+		{}
+
+		void handleDirtyItem() override
+		{
+			log.add(name);
+
+			if (f)
+				f();
+		}
+
+		String name;
+		StringArray& log;
+		std::function<void()> f;
+	};
+
+	void runTest() override
+	{
+		testPriorityOrder();
+		testRedirtyInCallback();
+		testSuspend();
+		testDeleteInCallback();
+	}
+
+	void handleFrame()
+	{
+		dispatcher->handleUpdatesNow();
+	}
+
+	void testPriorityOrder()
+	{
+		beginTest("Testing priority order");
+
+		StringArray log;
+
+		TestItem low("low", log, AsyncUpdateDispatcher::Priority::Low);
+		TestItem normal("normal", log);
+		TestItem high("high", log, AsyncUpdateDispatcher::Priority::High);
+		TestItem idle("idle", log, AsyncUpdateDispatcher::Priority::High);
+
+		low.markDirty();
+		normal.markDirty();
+		high.markDirty();
+
+		handleFrame();
+
+		expectEquals(log.joinIntoString(" "), String("high normal low"), "callback order");
+		expectEquals(dispatcher->getStatistics().numCallbacks, 3, "callback amount");
+
+		log.clear();
+
+		low.setPriority(AsyncUpdateDispatcher::Priority::High);
+		high.setPriority(AsyncUpdateDispatcher::Priority::Low);
+
+		low.markDirty();
+		high.markDirty();
+		high.markDirty();
+
+		handleFrame();
+
+		expectEquals(log.joinIntoString(" "), String("low high"), "changed priority");
+	}
+
+	void testRedirtyInCallback()
+	{
+		beginTest("Testing marking items dirty during a callback");
+
+		StringArray log;
+
+		TestItem high("high", log, AsyncUpdateDispatcher::Priority::High);
+		TestItem normal("normal", log);
+
+		int numCalls = 0;
+
+		// marks itself and an item that was already called in this frame
+		normal.f = [&]()
+		{
+			if (++numCalls == 1)
+			{
+				normal.markDirty();
+				high.markDirty();
+			}
+		};
+
+		high.markDirty();
+		normal.markDirty();
+
+		handleFrame();
+
+		expectEquals(log.joinIntoString(" "), String("high normal"), "first frame");
+		expect(normal.isDirty() && high.isDirty(), "items are dirty again");
+
+		log.clear();
+		handleFrame();
+
+		expectEquals(log.joinIntoString(" "), String("high normal"), "second frame");
+
+		log.clear();
+		handleFrame();
+
+		expect(log.isEmpty(), "no callback without a trigger");
+	}
+
+	void testSuspend()
+	{
+		beginTest("Testing suspend / resume");
+
+		StringArray log;
+
+		TestItem item("item", log);
+
+		item.markDirty();
+		item.setSuspended(true);
+
+		handleFrame();
+
+		expect(log.isEmpty(), "no callback while suspended");
+		expect(item.isDirty(), "suspended item stays dirty");
+
+		item.markDirty();
+		handleFrame();
+
+		expect(log.isEmpty(), "no callback when triggered while suspended");
+
+		item.setSuspended(false);
+		handleFrame();
+
+		expectEquals(log.size(), 1, "one callback after resuming");
+
+		item.markDirty();
+		item.clearDirty();
+		handleFrame();
+
+		expectEquals(log.size(), 1, "cleared item is skipped");
+	}
+
+	void testDeleteInCallback()
+	{
+		beginTest("Testing deleting items in a callback");
+
+		StringArray log;
+
+		TestItem killer("killer", log, AsyncUpdateDispatcher::Priority::High);
+		ScopedPointer<TestItem> normalVictim = new TestItem("normalVictim", log);
+		ScopedPointer<TestItem> lowVictim = new TestItem("lowVictim", log, AsyncUpdateDispatcher::Priority::Low);
+		ScopedPointer<TestItem> suicide = new TestItem("suicide", log);
+
+		// This item is already in the pending list of the frame when it's deleted
+		killer.f = [&]()
+		{
+			normalVictim = nullptr;
+			lowVictim = nullptr;
+		};
+
+		suicide->f = [&]()
+		{
+			suicide = nullptr;
+		};
+
+		auto numItems = dispatcher->getStatistics().numItems;
+
+		lowVictim->markDirty();
+		suicide->markDirty();
+		normalVictim->markDirty();
+		killer.markDirty();
+
+		handleFrame();
+
+		expect(!log.contains("normalVictim") && !log.contains("lowVictim"), "deleted items are skipped");
+		expect(log.contains("suicide") && suicide == nullptr, "item deleted itself");
+		expectEquals(dispatcher->getStatistics().numItems, numItems - 3, "items are unregistered");
+		expectEquals(dispatcher->getStatistics().numDirtyItems, 4, "all items were drained");
+	}
+
+	SharedResourcePointer<AsyncUpdateDispatcher> dispatcher;
+};
+
+static AsyncUpdateDispatcherTests asyncUpdateDispatcherTests;
+
+#endif
+
 }
@@ -740,6 +740,149 @@ public:
 #endif
 
 
+/** A single timer on the message thread that delivers the updates of all LockfreeAsyncUpdater and PooledUIUpdater objects.
+	@ingroup event_handling
+
+	Instead of polling a dirty flag in a timer per object, a dirty item pushes itself onto a lock-free 
+	intrusive list and the dispatcher only drains the items that were marked dirty since the last frame.
+	The items are delivered in the order of their priority. 
+
+	Objects that need a callback every frame (like the PooledUIUpdater) can subclass FrameClient.
+
+	There is only one dispatcher per process which is shared using a SharedResourcePointer.
+*/
+class AsyncUpdateDispatcher : private Timer
+{
+public:
+
+	static constexpr int FrameIntervalMilliseconds = 30;
+
+	enum class Priority
+	{
+		High = 0,
+		Normal,
+		Low,
+		numPriorities
+	};
+
+	/** An object that can be marked dirty from any thread. 
+	
+		It's safe to delete an item in its own callback or in the callback of another item. 
+		Like with a Timer, it must not be deleted on another thread while its callback is running.
+	*/
+	class Item
+	{
+	public:
+
+		Item(Priority p = Priority::Normal);
+
+		virtual ~Item();
+
+		/** Marks the item as dirty. This is lock-free and can be called from any thread. */
+		void markDirty();
+
+		/** Clears the dirty state so that the pending callback will be skipped. */
+		void clearDirty() { dirty.store(false); }
+
+		bool isDirty() const { return dirty.load(); }
+
+		/** A suspended item stays dirty, but it won't get a callback until it's resumed. */
+		void setSuspended(bool shouldBeSuspended);
+
+		bool isSuspended() const { return suspended.load(); }
+
+		void setPriority(Priority newPriority) { priority = newPriority; }
+
+		Priority getPriority() const { return priority; }
+
+	protected:
+
+		/** This will be called on the message thread once per frame if the item was marked dirty. */
+		virtual void handleDirtyItem() = 0;
+
+	private:
+
+		friend class AsyncUpdateDispatcher;
+
+		SharedResourcePointer<AsyncUpdateDispatcher> dispatcher;
+
+		std::atomic<bool> dirty = { false };
+		std::atomic<bool> queued = { false };
+		std::atomic<bool> suspended = { false };
+
+		Item* nextDirtyItem = nullptr;
+		Priority priority;
+
+		JUCE_DECLARE_NON_COPYABLE(Item);
+	};
+
+	/** An object that gets a callback on the message thread every frame. */
+	class FrameClient
+	{
+	public:
+
+		FrameClient();
+
+		virtual ~FrameClient();
+
+		virtual void handleFrame() = 0;
+
+	private:
+
+		SharedResourcePointer<AsyncUpdateDispatcher> dispatcher;
+
+		JUCE_DECLARE_NON_COPYABLE(FrameClient);
+	};
+
+	/** The counters of the dispatcher. */
+	struct Statistics
+	{
+		int numItems = 0;			  ///< the number of registered items
+		int numFrameClients = 0;	  ///< the number of registered frame clients
+		int numDirtyItems = 0;		  ///< the number of items that were drained in the last frame
+		int numCallbacks = 0;		  ///< the number of item callbacks delivered in the last frame
+		int maxCallbacksPerFrame = 0; ///< the highest number of item callbacks in a single frame
+		int64 numFrames = 0;
+		int64 numTotalCallbacks = 0;
+	};
+
+	AsyncUpdateDispatcher();
+	~AsyncUpdateDispatcher();
+
+	/** Returns the current counters. Call this from the message thread. */
+	Statistics getStatistics() const;
+
+	/** Delivers the pending updates and the frame callbacks right away. 
+	
+		The timer calls this once per frame. Call this from the message thread. 
+	*/
+	void handleUpdatesNow();
+
+private:
+
+	void timerCallback() override;
+
+	void push(Item* item);
+	void removeItem(Item* item);
+
+	void addFrameClient(FrameClient* c);
+	void removeFrameClient(FrameClient* c);
+
+	std::atomic<Item*> dirtyHead = { nullptr };
+	std::atomic<int> numItems = { 0 };
+
+	CriticalSection drainLock;
+	bool draining = false;
+
+	Array<Item*> pendingItems[(int)Priority::numPriorities];
+	Array<FrameClient*> frameClients;
+
+	Statistics statistics;
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AsyncUpdateDispatcher);
+};
+
+
 class SuspendableTimer
 {
 public:
@@ -827,8 +970,11 @@ private:
 /** Coallescates timer updates.
 	@ingroup event_handling
 	
+	The updater doesn't own a timer but is called every frame by the AsyncUpdateDispatcher. 
+	The suspension state of the SuspendableTimer base class is still respected.
 */
-class PooledUIUpdater : public SuspendableTimer
+class PooledUIUpdater : public SuspendableTimer,
+						private AsyncUpdateDispatcher::FrameClient
 {
 public:
 
@@ -836,7 +982,6 @@ public:
 		pendingHandlers(8192)
 	{
         suspendTimer(false);
-		startTimer(30);
 	}
 
 	class Broadcaster;
@@ -984,6 +1129,12 @@ public:
 
 private:
 
+	void handleFrame() override
+	{
+		if (!isSuspended())
+			timerCallback();
+	}
+
 	Array<WeakReference<SimpleTimer>, CriticalSection> simpleTimers;
 	LockfreeQueue<WeakReference<Broadcaster>> pendingHandlers;
 
@@ -1707,54 +1858,30 @@ struct SimpleReadWriteLock
 /** This is a non allocating alternative to the AsyncUpdater.
 *	@ingroup event_handling
 *
-*	If you're creating a lot of these object's, it will clog the Timer thread,
-*	but for single objects that need an update once in a while, it's better,
-*	because it won't post a update message that needs to be allocated.
+*	It won't post an update message that needs to be allocated, but marks itself as dirty in 
+*	the AsyncUpdateDispatcher which calls handleAsyncUpdate() on the next frame. Idle instances
+*	don't cost anything, so it's fine to create a lot of them.
 */
 class LockfreeAsyncUpdater
 {
 private:
 
-	struct TimerPimpl : public SuspendableTimer
+	struct UpdaterPimpl : public AsyncUpdateDispatcher::Item
 	{
-		explicit TimerPimpl(LockfreeAsyncUpdater* p_) :
+		explicit UpdaterPimpl(LockfreeAsyncUpdater* p_) :
 			parent(*p_)
-		{
-			dirty = false;
-			startTimer(30);
-		}
-
-		~TimerPimpl()
-		{
-			dirty = false;
-			stopTimer();
-		}
+		{}
 
-		void timerCallback() override
+		void handleDirtyItem() override
 		{
-			bool v = true;
-			if (dirty.compare_exchange_strong(v, false))
-			{
-				parent.handleAsyncUpdate();
-			}
+			parent.handleAsyncUpdate();
 		}
 
-		void triggerAsyncUpdate()
-		{
-			dirty.store(true);
-		};
-
-		void cancelPendingUpdate()
-		{
-			dirty.store(false);
-		};
-
 	private:
 
 		LockfreeAsyncUpdater & parent;
-		std::atomic<bool> dirty;
 
-		JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(TimerPimpl);
+		JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(UpdaterPimpl);
 	};
 
 public:
@@ -1768,16 +1895,20 @@ public:
 
 	void suspend(bool shouldBeSuspended)
 	{
-		pimpl.suspendTimer(shouldBeSuspended);
+		pimpl.setSuspended(shouldBeSuspended);
+	}
+
+	/** Changes the order in which the dirty updaters are called within a frame. */
+	void setUpdatePriority(AsyncUpdateDispatcher::Priority p)
+	{
+		pimpl.setPriority(p);
 	}
 
 protected:
 
 	LockfreeAsyncUpdater();
 
-	TimerPimpl pimpl;
-
-	static int instanceCount;
+	UpdaterPimpl pimpl;
 };
 
 template <typename ReturnType, typename... Ps> struct SafeLambdaBase
@@ -0,0 +1,199 @@
+/*  ===========================================================================
+*
+*   This file is part of HISE.
+*   Copyright 2016 Christoph Hart
+*
+*   HISE is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   HISE is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Commercial licenses for using HISE in an closed source project are
+*   available on request. Please visit the project's website to get more
+*   information about commercial licensing:
+*
+*   http://www.hise.audio/
+*
+*   HISE is based on the JUCE library,
+*   which must be separately licensed for closed source applications:
+*
+*   http://www.juce.com
+*
+*   ===========================================================================
+*/
+
+
+namespace hise { using namespace juce;
+
+struct RealtimeWorkerPool::Worker : public Thread
+{
+	Worker(RealtimeWorkerPool& parent_, int threadIndex_, const ThreadCallback& threadCallback_) :
+		Thread("Realtime Worker " + String(threadIndex_)),
+		parent(parent_),
+		threadIndex(threadIndex_),
+		threadCallback(threadCallback_)
+	{}
+
+	void run() override
+	{
+		if (threadCallback)
+			threadCallback(true);
+
+		// The time in ticks that the worker waits for the next job before it goes to sleep
+		const auto spinTime = Time::secondsToHighResolutionTicks(0.00005);
+		auto lastJob = Time::getHighResolutionTicks();
+
+		while (!threadShouldExit())
+		{
+			if (parent.joinJob(threadIndex))
+			{
+				lastJob = Time::getHighResolutionTicks();
+				continue;
+			}
+
+			if (Time::getHighResolutionTicks() - lastJob < spinTime)
+			{
+				std::this_thread::yield();
+				continue;
+			}
+
+			sleeping.store(true);
+
+			if (!parent.jobOpen.load())
+				wait(100);
+
+			sleeping.store(false);
+			lastJob = Time::getHighResolutionTicks();
+		}
+
+		if (threadCallback)
+			threadCallback(false);
+	}
+
+	RealtimeWorkerPool& parent;
+	const int threadIndex;
+	ThreadCallback threadCallback;
+	std::atomic<bool> sleeping = { false };
+};
+
+RealtimeWorkerPool::RealtimeWorkerPool(int numWorkers, const ThreadCallback& threadCallback)
+{
+	numWorkers = jmin(numWorkers, SystemStats::getNumCpus() - 1);
+
+	for (int i = 0; i < numWorkers; i++)
+	{
+		workers.add(new Worker(*this, i + 1, threadCallback));
+		workers.getLast()->startThread(Thread::realtimeAudioPriority);
+	}
+}
+
+RealtimeWorkerPool::~RealtimeWorkerPool()
+{
+	for (auto w : workers)
+		w->signalThreadShouldExit();
+
+	for (auto w : workers)
+	{
+		w->notify();
+		w->stopThread(1000);
+	}
+}
+
+void RealtimeWorkerPool::processJob(Job& job, int numTasks)
+{
+	if (workers.isEmpty() || numTasks < 2 || busy.exchange(true))
+	{
+		for (int i = 0; i < numTasks; i++)
+			job.processTask(i, 0);
+
+		return;
+	}
+
+	// Wait until every worker has left the last job
+	while (numActiveWorkers.load() != 0)
+		std::this_thread::yield();
+
+	currentJob = &job;
+	currentNumTasks = numTasks;
+	nextTaskIndex.store(0);
+	numFinishedTasks.store(0);
+
+	jobOpen.store(true);
+
+	// Spinning workers pick up the job by themselves, so this only wakes up one sleeping
+	// worker (which then wakes up the next one if there are tasks left).
+	wakeUpSleepingWorker();
+
+	processTasks(0);
+
+	while (numFinishedTasks.load() != numTasks)
+		std::this_thread::yield();
+
+	jobOpen.store(false);
+
+	while (numActiveWorkers.load() != 0)
+		std::this_thread::yield();
+
+	currentJob = nullptr;
+	busy.store(false);
+}
+
+bool RealtimeWorkerPool::joinJob(int threadIndex)
+{
+	if (!jobOpen.load())
+		return false;
+
+	++numActiveWorkers;
+
+	// Check again because the job might have been finished in the meantime
+	const bool ok = jobOpen.load();
+
+	if (ok)
+	{
+		if (nextTaskIndex.load() < currentNumTasks - 1)
+			wakeUpSleepingWorker();
+
+		processTasks(threadIndex);
+	}
+
+	--numActiveWorkers;
+
+	return ok;
+}
+
+void RealtimeWorkerPool::wakeUpSleepingWorker()
+{
+	for (auto w : workers)
+	{
+		// The exchange makes sure that a sleeping worker is only notified once
+		if (w->sleeping.exchange(false))
+		{
+			w->notify();
+			return;
+		}
+	}
+}
+
+void RealtimeWorkerPool::processTasks(int threadIndex)
+{
+	for (;;)
+	{
+		const int taskIndex = nextTaskIndex.fetch_add(1);
+
+		if (taskIndex >= currentNumTasks)
+			break;
+
+		currentJob->processTask(taskIndex, threadIndex);
+		++numFinishedTasks;
+	}
+}
+
+} // namespace hise
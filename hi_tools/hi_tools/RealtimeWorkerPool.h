@@ -0,0 +1,109 @@
+/*  ===========================================================================
+*
+*   This file is part of HISE.
+*   Copyright 2016 Christoph Hart
+*
+*   HISE is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   HISE is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Commercial licenses for using HISE in an closed source project are
+*   available on request. Please visit the project's website to get more
+*   information about commercial licensing:
+*
+*   http://www.hise.audio/
+*
+*   HISE is based on the JUCE library,
+*   which must be separately licensed for closed source applications:
+*
+*   http://www.juce.com
+*
+*   ===========================================================================
+*/
+
+
+#pragma once
+
+namespace hise { using namespace juce;
+
+/** A small pool of real-time worker threads that processes independent tasks of the audio callback in parallel.
+*
+*	The audio thread submits a Job with a fixed number of tasks using processJob(). The tasks are distributed
+*	with an atomic counter and the calling thread works on the tasks too until the job is finished, so the handoff
+*	doesn't need any lock or allocation. After a job, the workers spin for a short time waiting for the next one
+*	before they go to sleep. If they are sleeping, the audio thread wakes up only one of them and every worker that
+*	joins a job wakes up the next one, so there's at most one system call on the audio thread per job.
+*
+*	Only one job can be processed at the same time. If the pool is busy (eg. if a task submits another job),
+*	the job will be processed on the calling thread.
+*/
+class RealtimeWorkerPool
+{
+public:
+
+	/** A job with a fixed number of independent tasks. */
+	struct Job
+	{
+		virtual ~Job() {};
+
+		/** Processes the task with the given index.
+		*
+		*	The thread index is 0 for the thread that submitted the job and 1...getNumWorkers() for the worker threads,
+		*	so you can use it to access preallocated scratch memory (see getNumThreads()).
+		*/
+		virtual void processTask(int taskIndex, int threadIndex) = 0;
+	};
+
+	/** This is called by every worker thread when it starts or stops. Use this to register the worker threads as audio threads. */
+	using ThreadCallback = std::function<void(bool threadStarted)>;
+
+	/** Creates a pool with the given amount of worker threads. It will never use more workers than the number of CPU cores - 1. */
+	RealtimeWorkerPool(int numWorkers=HISE_NUM_REALTIME_WORKER_THREADS, const ThreadCallback& threadCallback={});
+
+	~RealtimeWorkerPool();
+
+	/** Processes all tasks of the job and returns when they are finished. */
+	void processJob(Job& job, int numTasks);
+
+	/** Returns the number of worker threads. */
+	int getNumWorkers() const noexcept { return workers.size(); }
+
+	/** Returns the number of threads that can work on a job (the workers and the calling thread). */
+	int getNumThreads() const noexcept { return workers.size() + 1; }
+
+private:
+
+	struct Worker;
+
+	/** Called by the workers. Returns true if they have processed tasks of a job. */
+	bool joinJob(int threadIndex);
+
+	void processTasks(int threadIndex);
+
+	/** Wakes up the first sleeping worker. */
+	void wakeUpSleepingWorker();
+
+	std::atomic<bool> busy = { false };
+	std::atomic<bool> jobOpen = { false };
+	std::atomic<int> numActiveWorkers = { 0 };
+	std::atomic<int> nextTaskIndex = { 0 };
+	std::atomic<int> numFinishedTasks = { 0 };
+
+	Job* currentJob = nullptr;
+	int currentNumTasks = 0;
+
+	OwnedArray<Worker> workers;
+
+	JUCE_DECLARE_NON_COPYABLE(RealtimeWorkerPool);
+};
+
+} // namespace hise
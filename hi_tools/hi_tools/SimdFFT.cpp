@@ -0,0 +1,443 @@
+/*  ===========================================================================
+*
+*   This file is part of HISE.
+*   Copyright 2016 Christoph Hart
+*
+*   HISE is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   HISE is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Commercial licenses for using HISE in an closed source project are
+*   available on request. Please visit the project's website to get more
+*   information about commercial licensing:
+*
+*   http://www.hise.audio/
+*
+*   HISE is based on the JUCE library,
+*   which must be separately licensed for closed source applications:
+*
+*   http://www.juce.com
+*
+*   ===========================================================================
+*/
+
+#if JUCE_ARM
+#include "sse2neon.h"
+#else
+#include <emmintrin.h>
+#endif
+
+namespace hise { using namespace juce;
+
+namespace SimdFFTHelpers
+{
+static forcedinline float add(float a, float b) noexcept { return a + b; }
+static forcedinline float sub(float a, float b) noexcept { return a - b; }
+static forcedinline float mul(float a, float b) noexcept { return a * b; }
+
+static forcedinline __m128 add(__m128 a, __m128 b) noexcept { return _mm_add_ps(a, b); }
+static forcedinline __m128 sub(__m128 a, __m128 b) noexcept { return _mm_sub_ps(a, b); }
+static forcedinline __m128 mul(__m128 a, __m128 b) noexcept { return _mm_mul_ps(a, b); }
+
+static forcedinline __m128 reverse(__m128 a) noexcept { return _mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 1, 2, 3)); }
+
+/** y = x * w. */
+template <typename T> static forcedinline void complexMul(T xr, T xi, T wr, T wi, T& yr, T& yi) noexcept
+{
+	yr = sub(mul(xr, wr), mul(xi, wi));
+	yi = add(mul(xr, wi), mul(xi, wr));
+}
+
+/** The forward radix-4 butterfly with the twiddles applied to the outputs (decimation in frequency). */
+template <typename T> static forcedinline void butterfly4(T ar, T ai, T br, T bi, T cr, T ci, T dr, T di,
+														  T w1r, T w1i, T w2r, T w2i, T w3r, T w3i,
+														  T* yr, T* yi) noexcept
+{
+	const T apcr = add(ar, cr), apci = add(ai, ci);
+	const T amcr = sub(ar, cr), amci = sub(ai, ci);
+	const T bpdr = add(br, dr), bpdi = add(bi, di);
+	const T bmdr = sub(br, dr), bmdi = sub(bi, di);
+
+	yr[0] = add(apcr, bpdr);
+	yi[0] = add(apci, bpdi);
+
+	// (a - c) - i * (b - d)
+	complexMul(add(amcr, bmdi), sub(amci, bmdr), w1r, w1i, yr[1], yi[1]);
+	complexMul(sub(apcr, bpdr), sub(apci, bpdi), w2r, w2i, yr[2], yi[2]);
+	// (a - c) + i * (b - d)
+	complexMul(sub(amcr, bmdi), add(amci, bmdr), w3r, w3i, yr[3], yi[3]);
+}
+
+/** Calculates X[k] from the packed complex FFT values Z[k] = (a, b) and Z[n - k] = (c, d) and the twiddle factor. */
+template <typename T> static forcedinline void realForwardPostProcess(T a, T b, T c, T d, T wr, T wi, T half, T& xr, T& xi) noexcept
+{
+	const T er = mul(half, add(a, c));
+	const T ei = mul(half, sub(b, d));
+	const T or_ = mul(half, add(b, d));
+	const T oi = mul(half, sub(c, a));
+
+	xr = add(er, sub(mul(wr, or_), mul(wi, oi)));
+	xi = add(ei, add(mul(wr, oi), mul(wi, or_)));
+}
+
+/** Calculates the packed complex value 2 * Z[k] from the bins X[k] = (a, b) and X[n - k] = (c, d). */
+template <typename T> static forcedinline void realInversePreProcess(T a, T b, T c, T d, T wr, T wi, T& zr, T& zi) noexcept
+{
+	const T er = add(a, c);
+	const T ei = sub(b, d);
+	const T dr = sub(a, c);
+	const T di = add(b, d);
+
+	// O = D * conj(w)
+	const T or_ = add(mul(dr, wr), mul(di, wi));
+	const T oi = sub(mul(di, wr), mul(dr, wi));
+
+	zr = sub(er, oi);
+	zi = add(ei, or_);
+}
+}
+
+SimdFFT::Pass::Pass(int length_, int stride_) :
+	length(length_),
+	stride(stride_)
+{
+	const int m = length / 4;
+
+	w1r.malloc(m); w1i.malloc(m);
+	w2r.malloc(m); w2i.malloc(m);
+	w3r.malloc(m); w3i.malloc(m);
+
+	const double delta = -2.0 * double_Pi / (double)length;
+
+	for (int i = 0; i < m; i++)
+	{
+		w1r[i] = (float)std::cos(delta * i);
+		w1i[i] = (float)std::sin(delta * i);
+		w2r[i] = (float)std::cos(delta * 2 * i);
+		w2i[i] = (float)std::sin(delta * 2 * i);
+		w3r[i] = (float)std::cos(delta * 3 * i);
+		w3i[i] = (float)std::sin(delta * 3 * i);
+	}
+}
+
+SimdFFT::SimdFFT(int realSize)
+{
+	init(realSize);
+}
+
+SimdFFT::~SimdFFT()
+{
+	init(0);
+}
+
+void SimdFFT::init(int newRealSize)
+{
+	jassert(newRealSize == 0 || isPowerOfTwo(newRealSize));
+
+	passes.clear();
+	tempR.free(); tempI.free();
+	workR.free(); workI.free();
+	realTwiddleR.free(); realTwiddleI.free();
+
+	complexSize = newRealSize / 2;
+	needsRadix2Pass = false;
+
+	if (complexSize == 0)
+		return;
+
+	tempR.calloc(complexSize); tempI.calloc(complexSize);
+	workR.calloc(complexSize); workI.calloc(complexSize);
+	realTwiddleR.malloc(complexSize); realTwiddleI.malloc(complexSize);
+
+	int length = complexSize;
+	int stride = 1;
+
+	while (length >= 4)
+	{
+		passes.add(new Pass(length, stride));
+		length /= 4;
+		stride *= 4;
+	}
+
+	needsRadix2Pass = length == 2;
+
+	const double delta = -2.0 * double_Pi / (double)newRealSize;
+
+	for (int i = 0; i < complexSize; i++)
+	{
+		realTwiddleR[i] = (float)std::cos(delta * i);
+		realTwiddleI[i] = (float)std::sin(delta * i);
+	}
+}
+
+void SimdFFT::radix4Pass(const Pass& p, const float* xr, const float* xi, float* yr, float* yi) const
+{
+	using namespace SimdFFTHelpers;
+
+	const int s = p.stride;
+	const int m = p.length / 4;
+	const int sm = s * m;
+
+	if (s >= 4)
+	{
+		// vectorise over the stride with broadcasted twiddles
+		for (int j = 0; j < m; j++)
+		{
+			const __m128 w1r = _mm_set1_ps(p.w1r[j]), w1i = _mm_set1_ps(p.w1i[j]);
+			const __m128 w2r = _mm_set1_ps(p.w2r[j]), w2i = _mm_set1_ps(p.w2i[j]);
+			const __m128 w3r = _mm_set1_ps(p.w3r[j]), w3i = _mm_set1_ps(p.w3i[j]);
+
+			const float* ar = xr + s * j;
+			const float* ai = xi + s * j;
+			float* outR = yr + 4 * s * j;
+			float* outI = yi + 4 * s * j;
+
+			for (int q = 0; q < s; q += 4)
+			{
+				__m128 r[4], i[4];
+
+				butterfly4(_mm_loadu_ps(ar + q), _mm_loadu_ps(ai + q),
+						   _mm_loadu_ps(ar + sm + q), _mm_loadu_ps(ai + sm + q),
+						   _mm_loadu_ps(ar + 2 * sm + q), _mm_loadu_ps(ai + 2 * sm + q),
+						   _mm_loadu_ps(ar + 3 * sm + q), _mm_loadu_ps(ai + 3 * sm + q),
+						   w1r, w1i, w2r, w2i, w3r, w3i, r, i);
+
+				for (int k = 0; k < 4; k++)
+				{
+					_mm_storeu_ps(outR + k * s + q, r[k]);
+					_mm_storeu_ps(outI + k * s + q, i[k]);
+				}
+			}
+		}
+	}
+	else if (s == 1 && m >= 4)
+	{
+		// the first pass has a stride of one, so we vectorise over the 
+		// butterflies and transpose the results before writing them.
+		for (int j = 0; j < m; j += 4)
+		{
+			__m128 r[4], i[4];
+
+			butterfly4(_mm_loadu_ps(xr + j), _mm_loadu_ps(xi + j),
+					   _mm_loadu_ps(xr + m + j), _mm_loadu_ps(xi + m + j),
+					   _mm_loadu_ps(xr + 2 * m + j), _mm_loadu_ps(xi + 2 * m + j),
+					   _mm_loadu_ps(xr + 3 * m + j), _mm_loadu_ps(xi + 3 * m + j),
+					   _mm_loadu_ps(p.w1r + j), _mm_loadu_ps(p.w1i + j),
+					   _mm_loadu_ps(p.w2r + j), _mm_loadu_ps(p.w2i + j),
+					   _mm_loadu_ps(p.w3r + j), _mm_loadu_ps(p.w3i + j), r, i);
+
+			_MM_TRANSPOSE4_PS(r[0], r[1], r[2], r[3]);
+			_MM_TRANSPOSE4_PS(i[0], i[1], i[2], i[3]);
+
+			for (int k = 0; k < 4; k++)
+			{
+				_mm_storeu_ps(yr + 4 * (j + k), r[k]);
+				_mm_storeu_ps(yi + 4 * (j + k), i[k]);
+			}
+		}
+	}
+	else
+	{
+		for (int j = 0; j < m; j++)
+		{
+			for (int q = 0; q < s; q++)
+			{
+				const int x = q + s * j;
+				float r[4], i[4];
+
+				butterfly4(xr[x], xi[x], xr[x + sm], xi[x + sm], 
+						   xr[x + 2 * sm], xi[x + 2 * sm], xr[x + 3 * sm], xi[x + 3 * sm],
+						   p.w1r[j], p.w1i[j], p.w2r[j], p.w2i[j], p.w3r[j], p.w3i[j], r, i);
+
+				for (int k = 0; k < 4; k++)
+				{
+					yr[q + s * (4 * j + k)] = r[k];
+					yi[q + s * (4 * j + k)] = i[k];
+				}
+			}
+		}
+	}
+}
+
+void SimdFFT::radix2Pass(const float* xr, const float* xi, float* yr, float* yi) const
+{
+	// The last pass of an odd power of two has a length of two, so there are no twiddles
+	const int s = complexSize / 2;
+	int q = 0;
+
+	for (; q + 4 <= s; q += 4)
+	{
+		const __m128 ar = _mm_loadu_ps(xr + q), ai = _mm_loadu_ps(xi + q);
+		const __m128 br = _mm_loadu_ps(xr + s + q), bi = _mm_loadu_ps(xi + s + q);
+
+		_mm_storeu_ps(yr + q, _mm_add_ps(ar, br));
+		_mm_storeu_ps(yi + q, _mm_add_ps(ai, bi));
+		_mm_storeu_ps(yr + s + q, _mm_sub_ps(ar, br));
+		_mm_storeu_ps(yi + s + q, _mm_sub_ps(ai, bi));
+	}
+
+	for (; q < s; q++)
+	{
+		const float ar = xr[q], ai = xi[q];
+		const float br = xr[q + s], bi = xi[q + s];
+
+		yr[q] = ar + br;
+		yi[q] = ai + bi;
+		yr[q + s] = ar - br;
+		yi[q + s] = ai - bi;
+	}
+}
+
+void SimdFFT::forward(float* re, float* im)
+{
+	float* srcR = re;
+	float* srcI = im;
+	float* dstR = tempR.get();
+	float* dstI = tempI.get();
+
+	for (auto p : passes)
+	{
+		radix4Pass(*p, srcR, srcI, dstR, dstI);
+		std::swap(srcR, dstR);
+		std::swap(srcI, dstI);
+	}
+
+	if (needsRadix2Pass)
+	{
+		radix2Pass(srcR, srcI, dstR, dstI);
+		std::swap(srcR, dstR);
+		std::swap(srcI, dstI);
+	}
+
+	if (srcR != re)
+	{
+		FloatVectorOperations::copy(re, srcR, complexSize);
+		FloatVectorOperations::copy(im, srcI, complexSize);
+	}
+}
+
+void SimdFFT::complexFFT(float* re, float* im, bool inverse)
+{
+	jassert(complexSize > 0);
+
+	// The inverse FFT is the forward FFT with swapped real and imaginary parts
+	if (inverse)
+		forward(im, re);
+	else
+		forward(re, im);
+}
+
+void SimdFFT::realFFT(const float* input, float* re, float* im)
+{
+	using namespace SimdFFTHelpers;
+
+	jassert(complexSize > 0);
+
+	const int n = complexSize;
+	int i = 0;
+
+	// pack the even samples into the real and the odd samples into the imaginary part
+	for (; i + 4 <= n; i += 4)
+	{
+		const __m128 v0 = _mm_loadu_ps(input + 2 * i);
+		const __m128 v1 = _mm_loadu_ps(input + 2 * i + 4);
+
+		_mm_storeu_ps(workR + i, _mm_shuffle_ps(v0, v1, _MM_SHUFFLE(2, 0, 2, 0)));
+		_mm_storeu_ps(workI + i, _mm_shuffle_ps(v0, v1, _MM_SHUFFLE(3, 1, 3, 1)));
+	}
+
+	for (; i < n; i++)
+	{
+		workR[i] = input[2 * i];
+		workI[i] = input[2 * i + 1];
+	}
+
+	forward(workR, workI);
+
+	re[0] = workR[0] + workI[0];
+	im[0] = 0.0f;
+	re[n] = workR[0] - workI[0];
+	im[n] = 0.0f;
+
+	int k = 1;
+	const __m128 halfV = _mm_set1_ps(0.5f);
+
+	for (; k + 4 <= n; k += 4)
+	{
+		__m128 xr, xi;
+
+		realForwardPostProcess(_mm_loadu_ps(workR + k), _mm_loadu_ps(workI + k),
+							   reverse(_mm_loadu_ps(workR + n - k - 3)), reverse(_mm_loadu_ps(workI + n - k - 3)),
+							   _mm_loadu_ps(realTwiddleR + k), _mm_loadu_ps(realTwiddleI + k), halfV, xr, xi);
+
+		_mm_storeu_ps(re + k, xr);
+		_mm_storeu_ps(im + k, xi);
+	}
+
+	for (; k < n; k++)
+	{
+		realForwardPostProcess(workR[k], workI[k], workR[n - k], workI[n - k],
+							   realTwiddleR[k], realTwiddleI[k], 0.5f, re[k], im[k]);
+	}
+}
+
+void SimdFFT::realInverseFFT(const float* re, const float* im, float* output, float gain)
+{
+	using namespace SimdFFTHelpers;
+
+	jassert(complexSize > 0);
+
+	const int n = complexSize;
+	int k = 0;
+
+	for (; k + 4 <= n; k += 4)
+	{
+		__m128 zr, zi;
+
+		realInversePreProcess(_mm_loadu_ps(re + k), _mm_loadu_ps(im + k),
+							  reverse(_mm_loadu_ps(re + n - k - 3)), reverse(_mm_loadu_ps(im + n - k - 3)),
+							  _mm_loadu_ps(realTwiddleR + k), _mm_loadu_ps(realTwiddleI + k), zr, zi);
+
+		_mm_storeu_ps(workR + k, zr);
+		_mm_storeu_ps(workI + k, zi);
+	}
+
+	for (; k < n; k++)
+	{
+		realInversePreProcess(re[k], im[k], re[n - k], im[n - k],
+							  realTwiddleR[k], realTwiddleI[k], workR[k], workI[k]);
+	}
+
+	// The pre-processing doubles the values, so the unscaled inverse FFT of 
+	// the half size yields the same scaling as an unscaled real inverse FFT.
+	forward(workI, workR);
+
+	const __m128 g = _mm_set1_ps(gain);
+	int i = 0;
+
+	for (; i + 4 <= n; i += 4)
+	{
+		const __m128 r = _mm_mul_ps(_mm_loadu_ps(workR + i), g);
+		const __m128 im_ = _mm_mul_ps(_mm_loadu_ps(workI + i), g);
+
+		_mm_storeu_ps(output + 2 * i, _mm_unpacklo_ps(r, im_));
+		_mm_storeu_ps(output + 2 * i + 4, _mm_unpackhi_ps(r, im_));
+	}
+
+	for (; i < n; i++)
+	{
+		output[2 * i] = workR[i] * gain;
+		output[2 * i + 1] = workI[i] * gain;
+	}
+}
+
+} // namespace hise
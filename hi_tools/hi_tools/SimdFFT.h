@@ -0,0 +1,101 @@
+/*  ===========================================================================
+*
+*   This file is part of HISE.
+*   Copyright 2016 Christoph Hart
+*
+*   HISE is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   HISE is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Commercial licenses for using HISE in an closed source project are
+*   available on request. Please visit the project's website to get more
+*   information about commercial licensing:
+*
+*   http://www.hise.audio/
+*
+*   HISE is based on the JUCE library,
+*   which must be separately licensed for closed source applications:
+*
+*   http://www.juce.com
+*
+*   ===========================================================================
+*/
+
+#ifndef SIMDFFT_H_INCLUDED
+#define SIMDFFT_H_INCLUDED
+
+namespace hise { using namespace juce;
+
+/** A bundled FFT implementation that uses SSE instructions (or NEON through sse2neon.h on ARM).
+*
+*	This is used as fallback if IPP is not available. The complex core is a Stockham autosort FFT
+*	with radix-4 passes (and a single radix-2 pass for odd powers of two), so it doesn't need a 
+*	bit-reversal permutation and every pass can run four butterflies at once. The real FFT is computed 
+*	with a complex FFT of half the size and a post-processing step.
+*
+*	All buffers are allocated in init(), so the transforms can be called from the audio thread.
+*	The transforms are not scaled (just like the IPP FFT with IPP_FFT_NODIV_BY_ANY), so if you need a
+*	normalised inverse FFT, pass 1 / size as gain.
+*/
+class SimdFFT
+{
+public:
+
+	SimdFFT(int realSize = 0);
+	~SimdFFT();
+
+	/** Prepares the FFT for the given real size (must be a power of two). Pass zero to release the buffers. */
+	void init(int newRealSize);
+
+	/** Returns the size of the real FFT. The complex FFT has half the size. */
+	int getRealSize() const noexcept { return 2 * complexSize; }
+
+	/** Real forward FFT. re and im must have getRealSize() / 2 + 1 elements. */
+	void realFFT(const float* input, float* re, float* im);
+
+	/** Real inverse FFT from the getRealSize() / 2 + 1 bins. The output will be multiplied with the gain. */
+	void realInverseFFT(const float* re, const float* im, float* output, float gain = 1.0f);
+
+	/** Inplace complex FFT of getRealSize() / 2 elements in split format. */
+	void complexFFT(float* re, float* im, bool inverse);
+
+private:
+
+	struct Pass
+	{
+		Pass(int length_, int stride_);
+
+		const int length;
+		const int stride;
+		HeapBlock<float> w1r, w1i, w2r, w2i, w3r, w3i;
+	};
+
+	void forward(float* re, float* im);
+
+	void radix4Pass(const Pass& p, const float* xr, const float* xi, float* yr, float* yi) const;
+	void radix2Pass(const float* xr, const float* xi, float* yr, float* yi) const;
+
+	int complexSize = 0;
+	bool needsRadix2Pass = false;
+
+	OwnedArray<Pass> passes;
+
+	HeapBlock<float> tempR, tempI;
+	HeapBlock<float> workR, workI;
+	HeapBlock<float> realTwiddleR, realTwiddleI;
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SimdFFT);
+};
+
+} // namespace hise
+
+#endif  // SIMDFFT_H_INCLUDED
@@ -35,7 +35,7 @@
 
 using IntBuffer = CompressionHelpers::AudioBufferInt16;
 
-//static BitCompressors::UnitTests bitTests;
+static BitCompressors::UnitTests bitTests;
 
 void BitCompressors::UnitTests::runTest()
 {
@@ -66,7 +66,14 @@ void BitCompressors::UnitTests::runTest()
 	testAutomaticCompression(14);
 	testAutomaticCompression(15);
 
-
+	testDecodeSpeed(compressor = new OneBit());
+	testDecodeSpeed(compressor = new TwoBit());
+	testDecodeSpeed(compressor = new FourBit());
+	testDecodeSpeed(compressor = new SixBit());
+	testDecodeSpeed(compressor = new EightBit());
+	testDecodeSpeed(compressor = new TenBit());
+	testDecodeSpeed(compressor = new TwelveBit());
+	testDecodeSpeed(compressor = new FourteenBit());
 }
 
 void BitCompressors::UnitTests::testAutomaticCompression(uint8 maxBitSize)
@@ -259,6 +266,67 @@ void BitCompressors::UnitTests::testCompressor(Base* compressor)
 	free(decompressedData);
 }
 
+void BitCompressors::UnitTests::testDecodeSpeed(Base* compressor)
+{
+	const int bitRate = compressor->getAllowedBitRange();
+
+	beginTest("Testing SIMD decoding with bit rate " + String(bitRate));
+
+	Random r;
+
+	// Random bytes contain every possible bit pattern, so this checks the SIMD decoder
+	// with all odd sizes against the scalar implementation
+	HeapBlock<uint8> randomBytes(COMPRESSION_BLOCK_SIZE * 2);
+
+	for (int i = 0; i < COMPRESSION_BLOCK_SIZE * 2; i++)
+		randomBytes[i] = (uint8)r.nextInt(256);
+
+	HeapBlock<int16> scalarData(COMPRESSION_BLOCK_SIZE);
+	HeapBlock<int16> simdData(COMPRESSION_BLOCK_SIZE);
+
+	for (int numValues = 0; numValues < 300; numValues++)
+	{
+		compressor->decompressScalar(scalarData, randomBytes, numValues);
+		compressor->decompress(simdData, randomBytes, numValues);
+
+		expect(memcmp(scalarData, simdData, sizeof(int16) * numValues) == 0, "SIMD mismatch with " + String(numValues) + " values");
+	}
+
+	const int numValues = COMPRESSION_BLOCK_SIZE;
+
+	HeapBlock<int16> uncompressedData(numValues);
+	fillDataWithAllowedBitRange(uncompressedData, numValues, bitRate);
+
+	HeapBlock<uint8> compressedData(compressor->getByteAmount(numValues));
+	compressor->compress(compressedData, uncompressedData, numValues);
+
+	const int numIterations = 2000;
+
+	double start = Time::getMillisecondCounterHiRes();
+
+	for (int i = 0; i < numIterations; i++)
+		compressor->decompressScalar(scalarData, compressedData, numValues);
+
+	const double scalarTime = Time::getMillisecondCounterHiRes() - start;
+
+	start = Time::getMillisecondCounterHiRes();
+
+	for (int i = 0; i < numIterations; i++)
+		compressor->decompress(simdData, compressedData, numValues);
+
+	const double simdTime = Time::getMillisecondCounterHiRes() - start;
+
+	for (int i = 0; i < numValues; i++)
+		expectEquals<int16>(simdData[i], uncompressedData[i], "Sample mismatch at position " + String(i));
+
+	auto getSamplesPerSecond = [&](double ms)
+	{
+		return String((double)numValues * (double)numIterations / (ms * 1000.0), 1) + " MSamples/s";
+	};
+
+	logMessage(String(bitRate) + " bit: scalar " + getSamplesPerSecond(scalarTime) + ", SIMD " + getSamplesPerSecond(simdTime) + " (x" + String(scalarTime / simdTime, 2) + ")");
+}
+
 #endif
 
 CodecTest::CodecTest() :
@@ -923,6 +991,9 @@ public:
 
 		testPadding(1);
         testPadding(2);
+
+		testMultithreadedEncoding(1);
+		testMultithreadedEncoding(2);
 	
 		for (int i = 0; i < 5; i++)
 		{
@@ -1033,7 +1104,7 @@ public:
 		return CodecTest::createTestSignal(size, numChannels, CodecTest::SignalType::DecayingSineWithHarmonic, 0.9f);
 	}
 
-	MemoryBlock writeIntoMemory(Array<AudioSampleBuffer>& buffers)
+	MemoryBlock writeIntoMemory(Array<AudioSampleBuffer>& buffers, ThreadPool* encoderPool=nullptr)
 	{
 		Random r;
 
@@ -1048,6 +1119,7 @@ public:
 		currentOption.normalisationMode = 2;
 
 		writer->setOptions(currentOption);
+		writer->setThreadPool(encoderPool);
 		
 		expect(writer != nullptr);
 
@@ -1095,18 +1167,171 @@ public:
 		return b2;
 	}
 
+	/** Runs the archiver on a background thread because it needs a Thread to check for an abort. */
+	struct ArchiverThread : public Thread,
+							public HlacArchiver::Listener
+	{
+		ArchiverThread(const std::function<void(HlacArchiver&)>& f_) :
+			Thread("Archiver Test"),
+			f(f_)
+		{}
+
+		void run() override
+		{
+			HlacArchiver archiver(this);
+			archiver.setListener(this);
+			f(archiver);
+		}
+
+		void logStatusMessage(const String& /*message*/) override {}
+		void logVerboseMessage(const String& /*verboseMessage*/) override {}
+		void criticalErrorOccured(const String& message) override { errorMessage = message; }
+
+		std::function<void(HlacArchiver&)> f;
+		String errorMessage;
+	};
+
+	void runArchiver(const std::function<void(HlacArchiver&)>& f)
+	{
+		ArchiverThread t(f);
+
+		t.startThread();
+		t.waitForThreadToExit(-1);
+
+		expect(t.errorMessage.isEmpty(), t.errorMessage);
+	}
+
+	void writeMonolith(const File& f, AudioSampleBuffer& b)
+	{
+		HiseLosslessAudioFormat hlac;
+		StringPairArray empty;
+
+		ScopedPointer<AudioFormatWriter> writer = hlac.createWriterFor(new FileOutputStream(f), 44100.0, b.getNumChannels(), 16, empty, 5);
+
+		auto options = HlacEncoder::CompressorOptions::getPreset(HlacEncoder::CompressorOptions::Presets::Diff);
+		options.normalisationMode = 0;
+
+		dynamic_cast<HiseLosslessAudioFormatWriter*>(writer.get())->setOptions(options);
+
+		writer->writeFromAudioSampleBuffer(b, 0, b.getNumSamples());
+		writer->flush();
+	}
+
+	AudioSampleBuffer readMonolith(const File& f)
+	{
+		HiseLosslessAudioFormat hlac;
+
+		ScopedPointer<HiseLosslessAudioFormatReader> reader = dynamic_cast<HiseLosslessAudioFormatReader*>(hlac.createReaderFor(new FileInputStream(f), true));
+
+		if (reader == nullptr)
+			return {};
+
+		reader->setTargetAudioDataType(AudioDataConverters::DataFormat::float32BE);
+
+		AudioSampleBuffer b((int)reader->numChannels, (int)reader->lengthInSamples);
+		reader->read(&b, 0, b.getNumSamples(), 0, true, true);
+
+		return b;
+	}
+
+	/** Compresses a few monoliths into an archive with small parts so that the FLAC data of most
+		monoliths is split across part files, then extracts it (in parallel) and compares the result.
+	*/
 	void testArchiver()
 	{
 		beginTest("Testing Archiver");
 
-		int numChannels = 1;
+#if USE_BACKEND || HI_ENABLE_EXPANSION_EDITING
+		auto root = File::getSpecialLocation(File::tempDirectory).getNonexistentChildFile("HlacArchiverTest", "", false);
+		auto sourceDirectory = root.getChildFile("Source");
+		auto targetDirectory = root.getChildFile("Extracted");
 
-		Array<AudioSampleBuffer> buffers;
+		sourceDirectory.createDirectory();
+
+		Array<File> monoliths;
 
-		for (int i = 0; i < 12; i++)
+		for (int i = 0; i < 6; i++)
 		{
-			buffers.add(createTestBuffer(numChannels));
+			auto b = createTestBuffer(i % 2 + 1, 44100 + i * 10000);
+			auto f = sourceDirectory.getChildFile("Samples.ch" + String(i + 1));
+
+			writeMonolith(f, b);
+			monoliths.add(f);
 		}
+
+		auto archiveFile = root.getChildFile("Samples.hr1");
+
+		double progress = 0.0;
+		double partProgress = 0.0;
+		double totalProgress = 0.0;
+
+		runArchiver([&](HlacArchiver& a)
+		{
+			HlacArchiver::CompressData data;
+
+			data.fileList = monoliths;
+			data.targetFile = archiveFile;
+			data.metadataJSON = "{\"BitDepth\": 16}";
+			data.partSize = 40000;
+			data.progress = &progress;
+			data.totalProgress = &totalProgress;
+
+			a.compressSampleData(data);
+		});
+
+		expect(root.getChildFile("Samples.hr3").existsAsFile(), "Archive is split into multiple parts");
+
+		// The target directory doesn't exist yet so this also checks that it's created
+		bool ok = false;
+
+		progress = partProgress = totalProgress = 0.0;
+
+		runArchiver([&](HlacArchiver& a)
+		{
+			HlacArchiver::DecompressData data;
+
+			data.option = HlacArchiver::OverwriteOption::ForceOverwrite;
+			data.sourceFile = archiveFile;
+			data.targetDirectory = targetDirectory;
+			data.progress = &progress;
+			data.partProgress = &partProgress;
+			data.totalProgress = &totalProgress;
+
+			ok = a.extractSampleData(data);
+		});
+
+		expect(ok, "Extraction succeeded");
+		expectEquals(progress, 1.0, "Monolith progress");
+		expectEquals(partProgress, 1.0, "Part progress");
+		expectEquals(totalProgress, 1.0, "Total progress");
+
+		for (auto& f : monoliths)
+		{
+			auto original = readMonolith(f);
+			auto extracted = readMonolith(targetDirectory.getChildFile(f.getFileName()));
+
+			expectEquals(extracted.getNumChannels(), original.getNumChannels(), f.getFileName() + ": channel amount");
+			expectEquals(extracted.getNumSamples(), original.getNumSamples(), f.getFileName() + ": length");
+
+			if (extracted.getNumSamples() != original.getNumSamples() || extracted.getNumChannels() != original.getNumChannels())
+				continue;
+
+			// The FLAC writer truncates the float samples, so a difference of one LSB is expected.
+			float maxError = 0.0f;
+
+			for (int c = 0; c < original.getNumChannels(); c++)
+			{
+				FloatVectorOperations::subtract(extracted.getWritePointer(c), original.getReadPointer(c), original.getNumSamples());
+				maxError = jmax(maxError, extracted.getMagnitude(c, 0, original.getNumSamples()));
+			}
+
+			expect(maxError * 32768.0f < 1.5f, f.getFileName() + ": extracted data error: " + String(maxError * 32768.0f, 2) + " LSB");
+		}
+
+		root.deleteRecursively();
+#else
+		logMessage("Skipping the archiver test (it needs HI_ENABLE_EXPANSION_EDITING)");
+#endif
 	}
 	
 
@@ -1126,6 +1351,49 @@ public:
 		expectEquals<int>(error, 0, "Error after reading");
 	}
 
+	void testMultithreadedEncoding(int numChannels)
+	{
+		beginTest("Testing multithreaded encoding with " + String(numChannels) + " channels");
+
+		ThreadPool pool(jmax(2, SystemStats::getNumCpus()));
+
+		Array<AudioSampleBuffer> buffers;
+
+		buffers.add(createTestBuffer(numChannels, 44100 * 60 + 1234));
+		buffers.add(createTestBuffer(numChannels, 3000));
+
+		auto start = Time::getMillisecondCounterHiRes();
+		auto single = writeIntoMemory(buffers);
+		auto singleTime = (Time::getMillisecondCounterHiRes() - start) * 0.001;
+
+		start = Time::getMillisecondCounterHiRes();
+		auto multi = writeIntoMemory(buffers, &pool);
+		auto multiTime = (Time::getMillisecondCounterHiRes() - start) * 0.001;
+
+		// The data is the same except for the random checksum of each block
+		expectEquals<int>((int)multi.getSize(), (int)single.getSize(), "Size");
+
+		auto singleBuffer = readIntoAudioBuffer(single, true);
+		auto multiBuffer = readIntoAudioBuffer(multi, true);
+
+		expectEquals<int>(multiBuffer.getNumSamples(), singleBuffer.getNumSamples(), "Length");
+
+		int error = (int)CompressionHelpers::checkBuffersEqual(multiBuffer, singleBuffer);
+		expectEquals<int>(error, 0, "buffers equal");
+
+		double mb = 0.0;
+
+		for (auto& b : buffers)
+			mb += (double)(b.getNumSamples() * numChannels * sizeof(int16)) / 1024.0 / 1024.0;
+
+		String m;
+		m << "Single thread: " << String(mb / singleTime, 1) << " MB/s, ";
+		m << String(pool.getNumThreads()) << " threads: " << String(mb / multiTime, 1) << " MB/s (";
+		m << String(mb / multiTime / (double)pool.getNumThreads(), 1) << " MB/s per core)";
+
+		logMessage(m);
+	}
+
 	int randomizeChannelAmount()
 	{
 		Random r;
@@ -47,6 +47,9 @@ struct BitCompressors::UnitTests : public UnitTest
 	void fillDataWithAllowedBitRange(int16* data, int size, int bitRange);
 	void testCompressor(Base* compressor);
 
+	/** Checks that the SIMD decoder matches the scalar decoder and logs the decoding speed of both. */
+	void testDecodeSpeed(Base* compressor);
+
 	void testAutomaticCompression(uint8 maxBitSize);
 
 };
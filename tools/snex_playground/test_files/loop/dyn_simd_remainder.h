@@ -0,0 +1,36 @@
+/*
+BEGIN_TEST_DATA
+  f: main
+  ret: int
+  args: float
+  input: 0.0f
+  output: 1
+  error: ""
+  compile_flags: AutoVectorisation
+  filename: "loop/dyn_simd_remainder"
+END_TEST_DATA
+*/
+
+span<float, 10> s = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f, 10.0f };
+
+dyn<float> d;
+
+int main(float input)
+{
+	d.referTo(s);
+
+	for(auto& v: d)
+    {
+        v = 8.0f;
+    }
+	
+	for(auto& v: d)
+    {
+        input += v;
+    }
+    
+    auto result = s.size() * 8;
+    
+    return  result == input;
+}
+
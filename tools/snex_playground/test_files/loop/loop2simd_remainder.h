@@ -0,0 +1,34 @@
+/*
+BEGIN_TEST_DATA
+  f: main
+  ret: int
+  args: int
+  input: 12
+  output: 35
+  error: ""
+  compile_flags: AutoVectorisation
+  filename: "loop/loop2simd_remainder"
+END_TEST_DATA
+*/
+
+span<float, 7> data = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f };
+
+int main(int input)
+{
+	float y = 1.0f;
+    
+	for(auto& s: data)
+    {
+        s += y;
+    }
+    
+    float x = 0.0f;
+    
+    for(auto& s: data)
+    {
+        x += s;
+    }
+    
+	return (int)x;
+}
+